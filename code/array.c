@@ -1,117 +1,693 @@
-#include "array.h" // Include your header file
-#include <stdio.h> // Keep includes needed for function bodies (printf, etc.)
-#include <stdlib.h> // Keep includes needed for function bodies (malloc, realloc, free, exit)
-#include <limits.h> // Keep includes needed for function bodies (if INT_MIN is used)
-
-// Function to initialize the dynamic array (MODIFIED)
-// Takes a pointer to an EXISTING Array struct and initializes its members.
-// Returns 1 on success, 0 on failure (e.g., memory allocation failed).
-int array_init(Array *arr) {
-    if (arr == NULL) {
-        fprintf(stderr, "Error: Cannot initialize NULL array pointer.\n");
-        return 0; // Indicate failure
-    }
-
-    // Allocate memory for the data buffer
-    arr->data = malloc(10 * sizeof(int));
-    if (arr->data == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed for array data.\n");
-        arr->capacity = 0; // Ensure consistent state on failure
-        arr->count = 0;
-        return 0; // Indicate failure
-    }
-
-    // Initialize capacity and count of the struct pointed to by arr
-    arr->capacity = 10;
-    arr->count = 0;
-    return 1; // Indicate success
-}
-
-// Function to insert an element into the dynamic array
-void array_append(Array *arr, int data) {
-    if (arr->count < arr->capacity) {
-        arr->data[arr->count] = data;
-        arr->count++;
-    } else {
-        int more_size = (arr->capacity * 2) * sizeof(int);
-        arr->data = realloc(arr->data, more_size);
-        if (arr->data == NULL) {
-            printf("Memory allocation failed\n");
-            exit(1);
-        }
-        arr->data[arr->count] = data;
-        arr->count++;
-        arr->capacity *= 2;
-    }
-}
-
-// Function to print the array elements
-void array_print(Array *arr) {
-    printf("Array elements: | ");
-    for (int i = 0; i < arr->count; i++) {
-        printf("%d | ", arr->data[i]);
-    }
-    printf("\n");
-}
-
-// Function to delete an element at a specific index
-void array_delete_at(Array *arr, int index) {
-    index -= 1; // Convert to 0-based index
-    if (index < 0 || index >= arr->count) {
-        printf("Index out of bounds\n");
-        return;
-    }
-    for (int i = index; i < arr->count - 1; i++) {
-        arr->data[i] = arr->data[i + 1];
-    }
-    arr->count--;
-}
-
-// Function to delete all elements and free internal data (MODIFIED)
-void array_destroy(Array *arr) {
-    if (arr == NULL) {
-        return; // Nothing to do if arr is NULL
-    }
-    if (arr->data != NULL) {
-        free(arr->data); // Free only the internal data buffer
-    }
-    // Reset members to represent an empty state
-    arr->data = NULL;
-    arr->count = 0;
-    arr->capacity = 0;
-
-    // DO NOT free(arr) here.
-    // DO NOT set arr = NULL here (it wouldn't affect the caller).
-}
-
-// Function to find the index of a specific value
-int array_find(Array *arr, int data) {
-    for (int i = 0; i < arr->count; i++) {
-        if (arr->data[i] == data) {
-            return i + 1; // Return 1-based index
-        }
-    }
-    return -1; // Element not found
-}
-
-// Function to get the element at a specific index
-int array_get(Array *arr, int index) {
-    index -= 1; // Convert to 0-based index
-    if (index < 0 || index >= arr->count) {
-        printf("Index out of bounds\n");
-        return INT_MIN; // Return a special value to indicate error
-    }
-    return arr->data[index];
-}
-
-int array_size(Array *arr) {
-    return arr->count; // Return the number of elements in the array
-}
-
-int array_capacity(Array *arr) {
-    return arr->capacity; // Return the current allocated capacity of the array
-}
-
-int array_is_empty(Array *arr) {
-    return arr->count == 0; // Return 1 if empty, 0 otherwise
-}
+#define _GNU_SOURCE // For mremap on Linux (must come before any system header)
+#include "array.h" // Include your header file
+#include "array_simd.h" // Vectorized scan kernels
+#include "stats.h" // Counters and histograms (compiled in with -DDS_STATS)
+#include <stdio.h> // Keep includes needed for function bodies (printf, etc.)
+#include <stdlib.h> // Keep includes needed for function bodies (malloc, realloc, free, exit)
+#include <limits.h> // Keep includes needed for function bodies (if INT_MIN is used)
+#include <string.h> // For memcpy, memmove
+#include <stdint.h> // For uintptr_t, SIZE_MAX
+
+#ifdef __linux__
+#include <sys/mman.h> // For mmap, mremap, madvise, munmap
+#include <unistd.h>   // For sysconf
+#endif
+
+// Function to initialize the dynamic array (MODIFIED)
+// Takes a pointer to an EXISTING Array struct and initializes its members.
+// Returns 1 on success, 0 on failure (e.g., memory allocation failed).
+int array_init(Array *arr) {
+    return array_init_with_policy(arr, NULL); // Default policy: doubling
+}
+
+// Function to initialize the dynamic array with a chosen growth policy
+int array_init_with_policy(Array *arr, const ArrayGrowthPolicy *policy) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL array pointer.\n");
+        return 0; // Indicate failure
+    }
+    if (policy != NULL && policy->kind == ARRAY_GROWTH_CALLBACK && policy->grow == NULL) {
+        fprintf(stderr, "Error: Callback growth policy needs a grow function.\n");
+        return 0;
+    }
+
+    // Store the policy first so the struct is consistent even if allocation fails
+    if (policy != NULL) {
+        arr->growth = *policy;
+    } else {
+        arr->growth.kind = ARRAY_GROWTH_DOUBLE;
+        arr->growth.chunk = 0;
+        arr->growth.grow = NULL;
+        arr->growth.ctx = NULL;
+    }
+    arr->storage = ARRAY_STORAGE_HEAP;
+    arr->sorted = 0;
+
+    // Allocate memory for the data buffer
+    arr->data = malloc(ARRAY_INITIAL_CAPACITY * sizeof(int));
+    if (arr->data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for array data.\n");
+        arr->capacity = 0; // Ensure consistent state on failure
+        arr->count = 0;
+        return 0; // Indicate failure
+    }
+
+    // Initialize capacity and count of the struct pointed to by arr
+    arr->capacity = ARRAY_INITIAL_CAPACITY;
+    arr->count = 0;
+    return 1; // Indicate success
+}
+
+// Function to initialize the dynamic array on its inline buffer (no allocation)
+int array_init_inline(Array *arr) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL array pointer.\n");
+        return 0;
+    }
+    arr->growth.kind = ARRAY_GROWTH_DOUBLE;
+    arr->growth.chunk = 0;
+    arr->growth.grow = NULL;
+    arr->growth.ctx = NULL;
+    arr->storage = ARRAY_STORAGE_INLINE;
+    arr->sorted = 0;
+    arr->data = arr->inline_data;
+    arr->capacity = ARRAY_INLINE_CAPACITY;
+    arr->count = 0;
+    return 1;
+}
+
+// Helper: frees the data buffer with the call that matches where it lives
+static void array_release(Array *arr) {
+    if (arr->data == NULL || arr->storage == ARRAY_STORAGE_INLINE) {
+        return; // Nothing allocated (inline data is part of the struct)
+    }
+#ifdef __linux__
+    if (arr->storage == ARRAY_STORAGE_MAPPED) {
+        munmap(arr->data, arr->capacity * sizeof(int)); // Capacity spans the whole mapping
+        return;
+    }
+    if (arr->storage == ARRAY_STORAGE_FILE_READONLY || arr->storage == ARRAY_STORAGE_FILE_COW) {
+        // The mapping starts at the file header, just before the elements
+        munmap((char *)arr->data - ARRAY_FILE_HEADER_SIZE, ARRAY_FILE_HEADER_SIZE + arr->capacity * sizeof(int));
+        return;
+    }
+#endif
+    free(arr->data);
+}
+
+// Position helper shared by the search functions (see array.h)
+int array_position(size_t index, const char *function) {
+    if (index >= (size_t)INT_MAX) {
+        fprintf(stderr, "Error: %s result at index %zu does not fit in an int.\n", function, index + 1);
+        return -1;
+    }
+    return (int)index + 1;
+}
+
+// Helper: 0-based slot that 'values' points at when it lies inside the array's own
+// elements (so growing or shifting would move it), or SIZE_MAX if it points elsewhere
+static size_t array_alias_offset(const Array *arr, const int *values) {
+    uintptr_t p = (uintptr_t)values;
+    uintptr_t lo = (uintptr_t)arr->data;
+    if (arr->data == NULL || p < lo || p >= lo + arr->count * sizeof(int)) {
+        return SIZE_MAX;
+    }
+    return (size_t)(p - lo) / sizeof(int);
+}
+
+// Helper: refuses changes to arrays opened with ARRAY_MAP_READONLY. Returns 1 if writable.
+static int array_writable(const Array *arr, const char *caller) {
+    if (arr->storage == ARRAY_STORAGE_FILE_READONLY) {
+        fprintf(stderr, "Error: %s on a read-only mapped array.\n", caller);
+        return 0;
+    }
+    return 1;
+}
+
+// Helper: picks the next capacity according to the growth policy.
+// Never returns less than 'min_capacity' and never more than ARRAY_MAX_CAPACITY.
+static size_t array_next_capacity(const Array *arr, size_t min_capacity) {
+    size_t current = arr->capacity > 0 ? arr->capacity : 1;
+    size_t next;
+
+    switch (arr->growth.kind) {
+    case ARRAY_GROWTH_ONE_HALF:
+        // current + current / 2 cannot overflow past SIZE_MAX when current <= MAX capacity
+        next = current + current / 2 + 1; // +1 so tiny capacities still make progress
+        break;
+    case ARRAY_GROWTH_CHUNK: {
+        size_t chunk = arr->growth.chunk > 0 ? arr->growth.chunk : ARRAY_INITIAL_CAPACITY;
+        next = (current > ARRAY_MAX_CAPACITY - chunk) ? ARRAY_MAX_CAPACITY : current + chunk;
+        break;
+    }
+    case ARRAY_GROWTH_CALLBACK:
+        next = arr->growth.grow(arr->capacity, min_capacity, arr->growth.ctx);
+        break;
+    case ARRAY_GROWTH_DOUBLE:
+    default:
+        next = (current > ARRAY_MAX_CAPACITY / 2) ? ARRAY_MAX_CAPACITY : current * 2;
+        break;
+    }
+
+    if (next < min_capacity) {
+        next = min_capacity;
+    }
+    if (next > ARRAY_MAX_CAPACITY) {
+        next = ARRAY_MAX_CAPACITY;
+    }
+    return next;
+}
+
+#ifdef __linux__
+// Helper: rounds a byte count up to a whole number of pages.
+static size_t array_page_round(size_t bytes) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return (bytes + page - 1) / page * page;
+}
+
+// Helper: moves the buffer to (or resizes) an anonymous mapping of 'bytes' bytes.
+// Growing an existing mapping uses mremap, which relinks pages instead of copying them.
+// Capacity is set to fill the whole mapping. Returns 1 on success, 0 on failure.
+static int array_map_resize(Array *arr, size_t bytes) {
+    size_t map_bytes = array_page_round(bytes);
+    void *mem;
+
+    if (arr->storage == ARRAY_STORAGE_MAPPED) {
+        mem = mremap(arr->data, arr->capacity * sizeof(int), map_bytes, MREMAP_MAYMOVE);
+        if (mem == MAP_FAILED) {
+            return 0;
+        }
+    } else {
+        mem = mmap(NULL, map_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) {
+            return 0;
+        }
+        memcpy(mem, arr->data, arr->count * sizeof(int)); // One-time copy off the heap or file
+        array_release(arr);
+        STATS_ADD(STATS_ARRAY_BYTES_MOVED, arr->count * sizeof(int));
+    }
+    STATS_ADD(STATS_ARRAY_REALLOCS, 1);
+#ifdef MADV_HUGEPAGE
+    madvise(mem, map_bytes, MADV_HUGEPAGE); // Only a hint, failure is harmless
+#endif
+
+    arr->data = mem;
+    arr->capacity = map_bytes / sizeof(int);
+    arr->storage = ARRAY_STORAGE_MAPPED;
+    return 1;
+}
+#endif
+
+// Helper: reallocates the buffer to exactly 'new_capacity' elements (at least 'count'),
+// picking heap or mapped storage by size. Returns 1 on success, 0 on failure
+// (the old buffer is left untouched).
+static int array_set_capacity(Array *arr, size_t new_capacity) {
+    size_t bytes = new_capacity * sizeof(int); // Cannot overflow, capacity <= ARRAY_MAX_CAPACITY
+
+#ifdef __linux__
+    if (bytes >= ARRAY_HUGE_THRESHOLD) {
+        return array_map_resize(arr, bytes);
+    }
+#endif
+    if (arr->storage != ARRAY_STORAGE_HEAP) {
+        // Shrinking below the threshold, or leaving a file mapping or the inline buffer:
+        // go (back) to the heap
+        int *heap = malloc(bytes);
+        if (heap == NULL) {
+            return 0;
+        }
+        memcpy(heap, arr->data, arr->count * sizeof(int));
+        array_release(arr);
+        STATS_ADD(STATS_ARRAY_REALLOCS, 1);
+        STATS_ADD(STATS_ARRAY_BYTES_MOVED, arr->count * sizeof(int));
+        arr->data = heap;
+        arr->capacity = new_capacity;
+        arr->storage = ARRAY_STORAGE_HEAP;
+        return 1;
+    }
+
+    STATS_ONLY(uintptr_t old_data = (uintptr_t)arr->data;)
+    int *new_data = realloc(arr->data, bytes);
+    if (new_data == NULL) {
+        return 0;
+    }
+    STATS_ADD(STATS_ARRAY_REALLOCS, 1);
+    STATS_ADD(STATS_ARRAY_BYTES_MOVED, (uintptr_t)new_data != old_data ? arr->count * sizeof(int) : 0);
+    arr->data = new_data;
+    arr->capacity = new_capacity;
+    return 1;
+}
+
+// Helper: grows the buffer so it can hold at least 'min_capacity' elements.
+// Growth follows the array's policy, so a batch triggers at most one reallocation.
+// Returns 1 on success, 0 on allocation failure or overflow.
+static int array_grow_to(Array *arr, size_t min_capacity) {
+    if (min_capacity <= arr->capacity) {
+        return 1; // Already large enough
+    }
+    if (min_capacity > ARRAY_MAX_CAPACITY) {
+        fprintf(stderr, "Error: Requested capacity exceeds array limits.\n");
+        return 0;
+    }
+    if (!array_set_capacity(arr, array_next_capacity(arr, min_capacity))) {
+        fprintf(stderr, "Error: Memory allocation failed while growing array.\n");
+        return 0; // Old buffer is still valid
+    }
+    return 1;
+}
+
+// Function to insert an element into the dynamic array
+void array_append(Array *arr, int data) {
+    if (!array_writable(arr, "array_append")) {
+        return;
+    }
+    STATS_TIMER_START(timer);
+    if (arr->count == arr->capacity) {
+        if (arr->count == ARRAY_MAX_CAPACITY || !array_grow_to(arr, arr->count + 1)) {
+            printf("Memory allocation failed\n");
+            exit(1);
+        }
+    }
+    if (arr->sorted && arr->count > 0 && data < arr->data[arr->count - 1]) {
+        arr->sorted = 0; // Out of order, leave sorted mode
+    }
+    arr->data[arr->count] = data;
+    arr->count++;
+    STATS_TIMER_STOP(timer, STATS_HIST_ARRAY_APPEND_NS);
+}
+
+// Function to print the array elements
+void array_print(Array *arr) {
+    array_fprint(arr, stdout, NULL);
+}
+
+// Layout used by array_print: "Array elements: | 1 | 2 | 3 | "
+static const struct FormatOptions array_print_layout = {
+    "Array elements: | ", " | ", 1, "... | ", "\n", 0, 0
+};
+
+// Helper: renders the selected range of the array into 'sink'
+static void array_render(Array *arr, struct FormatSink *sink, const struct FormatOptions *options) {
+    if (options == NULL) {
+        options = &array_print_layout;
+    }
+    size_t first = options->start < arr->count ? options->start : arr->count;
+    size_t shown = arr->count - first;
+    int cut_off = 0;
+    if (options->limit > 0 && options->limit < shown) {
+        shown = options->limit;
+        cut_off = 1;
+    }
+
+    format_begin(sink, options);
+    const int *values = arr->data + first;
+    for (size_t i = 0; i < shown; i++) {
+        format_element(sink, options, values[i], i);
+    }
+    format_end(sink, options, shown, cut_off);
+}
+
+// Function to format the array into a caller buffer
+size_t array_format(Array *arr, char *buffer, size_t size, const struct FormatOptions *options) {
+    struct FormatSink sink;
+    format_sink_buffer(&sink, buffer, size);
+    if (arr != NULL) {
+        array_render(arr, &sink, options);
+    }
+    return format_finish(&sink);
+}
+
+// Function to print the array to a stream in large writes
+int array_fprint(Array *arr, FILE *out, const struct FormatOptions *options) {
+    if (arr == NULL || out == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_fprint.\n");
+        return 0;
+    }
+    char chunk[FORMAT_CHUNK_SIZE];
+    struct FormatSink sink;
+    format_sink_file(&sink, out, chunk, sizeof(chunk));
+    array_render(arr, &sink, options);
+    return (int)format_finish(&sink);
+}
+
+// Function to delete an element at a specific index
+void array_delete_at(Array *arr, int index) {
+    if (!array_writable(arr, "array_delete_at")) {
+        return;
+    }
+    index -= 1; // Convert to 0-based index
+    if (index < 0 || (size_t)index >= arr->count) {
+        printf("Index out of bounds\n");
+        return;
+    }
+    // Shift the tail left by one with a single move
+    memmove(arr->data + index, arr->data + index + 1, (arr->count - index - 1) * sizeof(int));
+    STATS_ADD(STATS_ARRAY_BYTES_MOVED, (arr->count - index - 1) * sizeof(int));
+    arr->count--;
+}
+
+// Function to delete all elements and free internal data (MODIFIED)
+void array_destroy(Array *arr) {
+    if (arr == NULL) {
+        return; // Nothing to do if arr is NULL
+    }
+    array_release(arr); // Free only the internal data buffer
+    // Reset members to represent an empty state
+    arr->data = NULL;
+    arr->count = 0;
+    arr->capacity = 0;
+    arr->storage = ARRAY_STORAGE_HEAP;
+    arr->sorted = 0;
+
+    // DO NOT free(arr) here.
+    // DO NOT set arr = NULL here (it wouldn't affect the caller).
+}
+
+// Function to find the index of a specific value
+int array_find(Array *arr, int data) {
+    STATS_TIMER_START(timer);
+    int result = -1; // Element not found
+    if (arr->sorted) {
+        int pos = array_lower_bound(arr, data); // First element >= data, i.e. first occurrence
+        if (pos > 0 && (size_t)pos <= arr->count && arr->data[pos - 1] == data) {
+            result = pos;
+        }
+    } else {
+        size_t i = array_simd_find(arr->data, arr->count, data);
+        if (i < arr->count) {
+            result = array_position(i, "array_find"); // Return 1-based index
+        }
+    }
+    STATS_TIMER_STOP(timer, STATS_HIST_ARRAY_FIND_NS);
+    return result;
+}
+
+// Function to count occurrences of a value
+size_t array_count(Array *arr, int data) {
+    return array_simd_count(arr->data, arr->count, data);
+}
+
+// Function to get the smallest element
+int array_min(Array *arr) {
+    if (arr->count == 0) {
+        fprintf(stderr, "Error: array_min called on an empty array.\n");
+        return INT_MIN;
+    }
+    return array_simd_min(arr->data, arr->count);
+}
+
+// Function to get the largest element
+int array_max(Array *arr) {
+    if (arr->count == 0) {
+        fprintf(stderr, "Error: array_max called on an empty array.\n");
+        return INT_MIN;
+    }
+    return array_simd_max(arr->data, arr->count);
+}
+
+// Function to add up all elements
+long long array_sum(Array *arr) {
+    return array_simd_sum(arr->data, arr->count);
+}
+
+// Function to mark every position holding a value
+size_t array_find_all(Array *arr, int data, uint64_t *bitmap) {
+    if (bitmap == NULL) {
+        fprintf(stderr, "Error: array_find_all needs a bitmap buffer.\n");
+        return 0;
+    }
+    return array_simd_find_all(arr->data, arr->count, data, bitmap);
+}
+
+// Function to get the element at a specific index
+int array_get(Array *arr, int index) {
+    index -= 1; // Convert to 0-based index
+    if (index < 0 || (size_t)index >= arr->count) {
+        printf("Index out of bounds\n");
+        return INT_MIN; // Return a special value to indicate error
+    }
+    return arr->data[index];
+}
+
+size_t array_size(Array *arr) {
+    return arr->count; // Return the number of elements in the array
+}
+
+size_t array_capacity(Array *arr) {
+    return arr->capacity; // Return the current allocated capacity of the array
+}
+
+int array_is_empty(Array *arr) {
+    return arr->count == 0; // Return 1 if empty, 0 otherwise
+}
+
+// Function to make sure the array can hold 'min_capacity' elements
+int array_reserve(Array *arr, size_t min_capacity) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot reserve on NULL array pointer.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_reserve")) {
+        return 0;
+    }
+    return array_grow_to(arr, min_capacity);
+}
+
+// Function to release unused capacity
+int array_shrink_to_fit(Array *arr) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot shrink NULL array pointer.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_shrink_to_fit")) {
+        return 0;
+    }
+    if (arr->storage == ARRAY_STORAGE_INLINE) {
+        return 1; // Part of the struct, nothing to release
+    }
+    size_t new_capacity = arr->count > 0 ? arr->count : 1; // Keep data non-NULL
+    if (new_capacity == arr->capacity) {
+        return 1; // Nothing to release
+    }
+
+    if (!array_set_capacity(arr, new_capacity)) {
+        fprintf(stderr, "Error: Memory allocation failed in array_shrink_to_fit.\n");
+        return 0;
+    }
+    return 1;
+}
+
+// Function to append a batch of elements
+int array_append_n(Array *arr, const int *values, size_t n) {
+    if (arr == NULL || (values == NULL && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for array_append_n.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_append_n")) {
+        return 0;
+    }
+    if (n == 0) {
+        return 1;
+    }
+    size_t alias = array_alias_offset(arr, values); // e.g. appending the array to itself
+    if (n > ARRAY_MAX_CAPACITY - arr->count || !array_grow_to(arr, arr->count + n)) {
+        return 0;
+    }
+    if (alias != SIZE_MAX) {
+        values = arr->data + alias; // Growing may have moved the buffer
+    }
+    memcpy(arr->data + arr->count, values, n * sizeof(int));
+    if (arr->sorted) {
+        // Stay sorted only if the batch is ascending and continues from the current last element
+        for (size_t i = (arr->count == 0) ? 1 : 0; i < n && arr->sorted; i++) {
+            int previous = (i == 0) ? arr->data[arr->count - 1] : values[i - 1];
+            arr->sorted = values[i] >= previous;
+        }
+    }
+    arr->count += n;
+    return 1;
+}
+
+// Function to insert a batch of elements at a 1-based index
+int array_insert_range(Array *arr, size_t index, const int *values, size_t n) {
+    if (arr == NULL || (values == NULL && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for array_insert_range.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_insert_range")) {
+        return 0;
+    }
+    if (index < 1 || index > arr->count + 1) {
+        printf("Index out of bounds\n");
+        return 0;
+    }
+    if (n == 0) {
+        return 1;
+    }
+    size_t alias = array_alias_offset(arr, values);
+    if (n > ARRAY_MAX_CAPACITY - arr->count || !array_grow_to(arr, arr->count + n)) {
+        return 0;
+    }
+
+    size_t start = index - 1; // Convert to 0-based index
+    size_t tail = arr->count - start;
+    // Open a gap of 'n' slots with one move of the tail, then fill it
+    memmove(arr->data + start + n, arr->data + start, tail * sizeof(int));
+    STATS_ADD(STATS_ARRAY_BYTES_MOVED, tail * sizeof(int));
+    if (alias == SIZE_MAX) {
+        memcpy(arr->data + start, values, n * sizeof(int));
+    } else {
+        // The source is the array itself: the part before the gap stayed put, the rest
+        // moved up by 'n' along with the tail. Neither piece overlaps the gap.
+        size_t before = (alias < start) ? ((start - alias < n) ? start - alias : n) : 0;
+        memcpy(arr->data + start, arr->data + alias, before * sizeof(int));
+        memcpy(arr->data + start + before, arr->data + alias + before + n, (n - before) * sizeof(int));
+    }
+    arr->count += n;
+    arr->sorted = 0; // Not worth re-checking order here, call array_sort again
+    return 1;
+}
+
+// Function to delete a contiguous run of elements starting at a 1-based index
+int array_delete_range(Array *arr, size_t index, size_t n) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_delete_range.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_delete_range")) {
+        return 0;
+    }
+    if (index < 1 || index > arr->count || n > arr->count - (index - 1)) {
+        printf("Index out of bounds\n");
+        return 0;
+    }
+    if (n == 0) {
+        return 1;
+    }
+
+    size_t start = index - 1; // Convert to 0-based index
+    size_t tail = arr->count - start - n;
+    // Close the gap with a single move instead of shifting once per element
+    memmove(arr->data + start, arr->data + start + n, tail * sizeof(int));
+    STATS_ADD(STATS_ARRAY_BYTES_MOVED, tail * sizeof(int));
+    arr->count -= n;
+    return 1;
+}
+
+
+// ----- Iteration -----
+
+void array_iter_init(ArrayIterator *it, Array *arr) {
+    if (it == NULL) return; // Safety check
+    it->arr = arr;
+    it->index = 0;
+}
+
+int array_iter_valid(ArrayIterator *it) {
+    return it != NULL && it->arr != NULL && it->index < it->arr->count;
+}
+
+int array_iter_next(ArrayIterator *it) {
+    if (!array_iter_valid(it)) {
+        return 0;
+    }
+    it->index++;
+    return array_iter_valid(it);
+}
+
+size_t array_iter_position(ArrayIterator *it) {
+    return (it == NULL) ? 0 : it->index + 1;
+}
+
+int array_iter_get(ArrayIterator *it) {
+    return array_iter_valid(it) ? it->arr->data[it->index] : INT_MIN;
+}
+
+// Writes in place; only the two neighbours decide whether sorted mode survives
+int array_iter_set(ArrayIterator *it, int value) {
+    if (!array_iter_valid(it) || !array_writable(it->arr, "array_iter_set")) {
+        return 0;
+    }
+    Array *arr = it->arr;
+    size_t i = it->index;
+    arr->data[i] = value;
+    if (arr->sorted && ((i > 0 && arr->data[i - 1] > value) || (i + 1 < arr->count && value > arr->data[i + 1]))) {
+        arr->sorted = 0;
+    }
+    return 1;
+}
+
+int array_iter_insert_after(ArrayIterator *it, int value) {
+    if (it == NULL || it->arr == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_iter_insert_after.\n");
+        return 0;
+    }
+    if (!array_iter_valid(it)) {
+        // Past the end: append (keeps sorted mode when in order) and stay past the end
+        if (!array_append_n(it->arr, &value, 1)) {
+            return 0;
+        }
+        it->index = it->arr->count;
+        return 1;
+    }
+    return array_insert_range(it->arr, it->index + 2, &value, 1); // 1-based slot after ours
+}
+
+int array_iter_erase(ArrayIterator *it) {
+    if (!array_iter_valid(it)) {
+        return 0;
+    }
+    return array_delete_range(it->arr, it->index + 1, 1);
+}
+
+
+// ----- One-Pass Helpers -----
+
+// Maps in place and re-checks the order on the way
+int array_map(Array *arr, ArrayMapFn fn, void *ctx) {
+    if (arr == NULL || fn == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_map.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_map")) {
+        return 0;
+    }
+    int sorted = 1;
+    for (size_t i = 0; i < arr->count; i++) {
+        arr->data[i] = fn(arr->data[i], ctx);
+        if (i > 0 && arr->data[i] < arr->data[i - 1]) {
+            sorted = 0;
+        }
+    }
+    arr->sorted = arr->sorted && sorted;
+    return 1;
+}
+
+// Stable in-place compaction: kept elements slide down over the removed ones
+int array_filter(Array *arr, ArrayPredicate keep, void *ctx) {
+    if (arr == NULL || keep == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_filter.\n");
+        return 0;
+    }
+    if (!array_writable(arr, "array_filter")) {
+        return 0;
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < arr->count; i++) {
+        int value = arr->data[i];
+        if (keep(value, ctx)) {
+            arr->data[kept++] = value;
+        }
+    }
+    arr->count = kept;
+    return 1;
+}
+
+long long array_fold(Array *arr, long long init, ArrayFoldFn fn, void *ctx) {
+    if (arr == NULL || fn == NULL) return init; // Safety check
+    long long acc = init;
+    for (size_t i = 0; i < arr->count; i++) {
+        acc = fn(acc, arr->data[i], ctx);
+    }
+    return acc;
+}
@@ -0,0 +1,159 @@
+#define _POSIX_C_SOURCE 200112L // For fstat, mmap, sysconf
+#include "array.h"  // Include the header file
+#include <stdio.h>  // For fopen, fwrite, rename
+#include <stdlib.h> // For malloc, free
+#include <string.h> // For memcpy, memcmp, strlen
+#include <stdint.h> // For uint32_t, uint64_t
+
+#ifdef __linux__
+#include <fcntl.h>    // For open
+#include <sys/mman.h> // For mmap, munmap
+#include <sys/stat.h> // For fstat
+#include <unistd.h>   // For close, sysconf
+#endif
+
+// On-disk header, exactly ARRAY_FILE_HEADER_SIZE bytes, written in native byte order
+typedef struct ArrayFileHeader {
+    char magic[8];        // ARRAY_FILE_MAGIC
+    uint32_t version;     // ARRAY_FILE_VERSION
+    uint32_t elem_size;   // sizeof(int) of the writer
+    uint32_t byte_order;  // ARRAY_FILE_BYTE_ORDER as the writer stored it
+    uint32_t flags;       // ARRAY_FILE_SORTED
+    uint64_t count;       // Elements following the header
+    uint8_t reserved[32]; // Zero, room for later versions
+} ArrayFileHeader;
+
+_Static_assert(sizeof(ArrayFileHeader) == ARRAY_FILE_HEADER_SIZE, "ArrayFileHeader must be ARRAY_FILE_HEADER_SIZE bytes");
+
+#define ARRAY_FILE_MAGIC "DSARRAY"       // 7 chars + NUL fills magic[8]
+#define ARRAY_FILE_BYTE_ORDER 0x01020304u // Reads back differently on the other endianness
+#define ARRAY_FILE_SORTED 1u              // The array was in sorted mode when saved
+
+// Function to write the array to a file
+int array_save(Array *arr, const char *path) {
+    if (arr == NULL || path == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_save.\n");
+        return 0;
+    }
+
+    // Write next to the target and rename over it once complete
+    size_t path_len = strlen(path);
+    char *tmp_path = malloc(path_len + 5);
+    if (tmp_path == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in array_save.\n");
+        return 0;
+    }
+    memcpy(tmp_path, path, path_len);
+    memcpy(tmp_path + path_len, ".tmp", 5);
+
+    ArrayFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ARRAY_FILE_MAGIC, sizeof(header.magic));
+    header.version = ARRAY_FILE_VERSION;
+    header.elem_size = sizeof(int);
+    header.byte_order = ARRAY_FILE_BYTE_ORDER;
+    header.flags = arr->sorted ? ARRAY_FILE_SORTED : 0;
+    header.count = arr->count;
+
+    FILE *file = fopen(tmp_path, "wb");
+    int ok = file != NULL;
+    ok = ok && fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && fwrite(arr->data, sizeof(int), arr->count, file) == arr->count;
+    if (file != NULL && fclose(file) != 0) {
+        ok = 0;
+    }
+    ok = ok && rename(tmp_path, path) == 0;
+    if (!ok) {
+        fprintf(stderr, "Error: Could not write array file %s.\n", path);
+        remove(tmp_path);
+    }
+    free(tmp_path);
+    return ok;
+}
+
+// Helper: checks a header read from a 'file_size'-byte file. Returns 1 if usable.
+static int array_header_valid(const ArrayFileHeader *header, size_t file_size, const char *path) {
+    if (memcmp(header->magic, ARRAY_FILE_MAGIC, sizeof(header->magic)) != 0) {
+        fprintf(stderr, "Error: %s is not an array file.\n", path);
+        return 0;
+    }
+    if (header->version != ARRAY_FILE_VERSION) {
+        fprintf(stderr, "Error: %s has format version %u, expected %u.\n", path, (unsigned)header->version,
+                (unsigned)ARRAY_FILE_VERSION);
+        return 0;
+    }
+    if (header->byte_order != ARRAY_FILE_BYTE_ORDER || header->elem_size != sizeof(int)) {
+        fprintf(stderr, "Error: %s was written on a machine with a different int layout.\n", path);
+        return 0;
+    }
+    size_t data_bytes = file_size - sizeof(*header);
+    if (data_bytes % sizeof(int) != 0 || header->count != data_bytes / sizeof(int)) {
+        fprintf(stderr, "Error: %s is truncated or has trailing bytes.\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+// Function to map a saved array back in
+int array_open_mmap(Array *arr, const char *path, ArrayMapMode mode) {
+    if (arr == NULL || path == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_open_mmap.\n");
+        return 0;
+    }
+#ifdef __linux__
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: Cannot open array file %s.\n", path);
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(ArrayFileHeader)) {
+        fprintf(stderr, "Error: %s is too small to be an array file.\n", path);
+        close(fd);
+        return 0;
+    }
+
+    size_t file_size = (size_t)st.st_size;
+    int prot = (mode == ARRAY_MAP_READONLY) ? PROT_READ : PROT_READ | PROT_WRITE;
+    int flags = (mode == ARRAY_MAP_READONLY) ? MAP_SHARED : MAP_PRIVATE;
+    char *base = mmap(NULL, file_size, prot, flags, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "Error: Cannot map array file %s.\n", path);
+        return 0;
+    }
+
+    const ArrayFileHeader *header = (const ArrayFileHeader *)base;
+    if (!array_header_valid(header, file_size, path)) {
+        munmap(base, file_size);
+        return 0;
+    }
+
+    arr->data = (int *)(base + sizeof(ArrayFileHeader));
+    arr->count = (size_t)header->count;
+    if (mode == ARRAY_MAP_READONLY) {
+        arr->capacity = arr->count;
+        arr->storage = ARRAY_STORAGE_FILE_READONLY;
+    } else {
+        // The rest of the last page is mapped and private too, so appends can use it
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size_t mapped = (file_size + page - 1) / page * page;
+        arr->capacity = (mapped - sizeof(ArrayFileHeader)) / sizeof(int);
+        arr->storage = ARRAY_STORAGE_FILE_COW;
+    }
+    arr->growth.kind = ARRAY_GROWTH_DOUBLE;
+    arr->growth.chunk = 0;
+    arr->growth.grow = NULL;
+    arr->growth.ctx = NULL;
+    arr->sorted = (header->flags & ARRAY_FILE_SORTED) != 0;
+    return 1;
+#else
+    (void)mode;
+    fprintf(stderr, "Error: array_open_mmap is not supported on this platform.\n");
+    return 0;
+#endif
+}
+
+int array_is_read_only(Array *arr) {
+    return arr != NULL && arr->storage == ARRAY_STORAGE_FILE_READONLY;
+}
@@ -0,0 +1,222 @@
+#include "array_index.h" // Include the header file
+#include "array_simd.h"  // For array_simd_find when the first occurrence is deleted
+#include <stdio.h>       // For fprintf, printf
+#include <stdlib.h>      // For calloc, free
+#include <stdint.h>      // For uint64_t, uint32_t
+
+// Helper: home slot of 'key'. Fibonacci hashing: the multiply spreads every input bit into
+// the high bits, which 'shift' keeps, so consecutive keys do not land in consecutive slots.
+static size_t index_home(const ArrayIndex *index, int key) {
+    return (size_t)(((uint64_t)(uint32_t)key * 0x9E3779B97F4A7C15ull) >> index->shift);
+}
+
+// Helper: slot holding 'key', or NULL
+static ArrayIndexSlot *index_lookup(const ArrayIndex *index, int key) {
+    if (index->capacity == 0) {
+        return NULL; // Destroyed
+    }
+    size_t mask = index->capacity - 1;
+    size_t i = index_home(index, key);
+    for (unsigned int distance = 1;; distance++) {
+        ArrayIndexSlot *slot = &index->slots[i];
+        // An empty slot, or an entry closer to its home than we are to ours: had 'key'
+        // been inserted, it would have taken this slot, so it is not in the table.
+        if (slot->distance < distance) {
+            return NULL;
+        }
+        if (slot->key == key) {
+            return slot;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+// Helper: inserts an entry whose key is not in the table yet (room must be available)
+static void index_place(ArrayIndex *index, ArrayIndexSlot entry) {
+    size_t mask = index->capacity - 1;
+    size_t i = index_home(index, entry.key);
+    entry.distance = 1;
+    for (;;) {
+        ArrayIndexSlot *slot = &index->slots[i];
+        if (slot->distance == 0) {
+            *slot = entry;
+            return;
+        }
+        if (slot->distance < entry.distance) {
+            // Robin Hood: the poorer entry takes the slot, the richer one moves on
+            ArrayIndexSlot displaced = *slot;
+            *slot = entry;
+            entry = displaced;
+        }
+        i = (i + 1) & mask;
+        entry.distance++;
+    }
+}
+
+// Helper: empties a slot by shifting the following displaced entries back one place
+static void index_remove(ArrayIndex *index, ArrayIndexSlot *slot) {
+    size_t mask = index->capacity - 1;
+    size_t i = (size_t)(slot - index->slots);
+    for (;;) {
+        size_t next = (i + 1) & mask;
+        if (index->slots[next].distance <= 1) {
+            break; // Empty, or already at its home slot
+        }
+        index->slots[i] = index->slots[next];
+        index->slots[i].distance--;
+        i = next;
+    }
+    index->slots[i].distance = 0;
+    index->size--;
+}
+
+// Helper: replaces the table with an empty one of 'capacity' slots (a power of two >= 2)
+// and re-inserts the old entries. Returns 1 on success, 0 on failure (table unchanged).
+static int index_rehash(ArrayIndex *index, size_t capacity) {
+    ArrayIndexSlot *slots = calloc(capacity, sizeof(ArrayIndexSlot));
+    if (slots == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for array index.\n");
+        return 0;
+    }
+    ArrayIndexSlot *old_slots = index->slots;
+    size_t old_capacity = index->capacity;
+    unsigned int shift = 64;
+    for (size_t c = capacity; c > 1; c >>= 1) {
+        shift--;
+    }
+    index->slots = slots;
+    index->capacity = capacity;
+    index->shift = shift;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_slots[i].distance != 0) {
+            index_place(index, old_slots[i]);
+        }
+    }
+    free(old_slots);
+    return 1;
+}
+
+// Helper: makes sure 'distinct' keys fit within the 7/8 load limit
+static int index_reserve(ArrayIndex *index, size_t distinct) {
+    if (distinct <= index->capacity / 8 * 7) {
+        return 1;
+    }
+    size_t capacity = index->capacity > 0 ? index->capacity : ARRAY_INDEX_MIN_CAPACITY;
+    while (distinct > capacity / 8 * 7) {
+        if (capacity > SIZE_MAX / 2 / sizeof(ArrayIndexSlot)) {
+            fprintf(stderr, "Error: Array index is too large.\n");
+            return 0;
+        }
+        capacity <<= 1;
+    }
+    return index_rehash(index, capacity);
+}
+
+// Helper: records one more occurrence of 'key' at 'position' (room must be available)
+static void index_add(ArrayIndex *index, int key, size_t position) {
+    ArrayIndexSlot *slot = index_lookup(index, key);
+    if (slot != NULL) {
+        slot->count++; // An earlier occurrence stays the first one
+        return;
+    }
+    ArrayIndexSlot entry = { key, 0, position, 1 };
+    index_place(index, entry);
+    index->size++;
+}
+
+// Builds the table sized for the worst case (all values distinct), so it never grows
+// during the pass
+int array_index_build(ArrayIndex *index, Array *arr) {
+    if (index == NULL || arr == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_index_build.\n");
+        return 0;
+    }
+    index->slots = NULL;
+    index->capacity = 0;
+    index->size = 0;
+    index->shift = 64;
+    index->arr = arr;
+    if (!index_reserve(index, arr->count > 0 ? arr->count : 1)) {
+        return 0;
+    }
+    for (size_t i = 0; i < arr->count; i++) {
+        index_add(index, arr->data[i], i + 1);
+    }
+    return 1;
+}
+
+int array_index_find(ArrayIndex *index, int data) {
+    ArrayIndexSlot *slot = index_lookup(index, data);
+    return slot != NULL ? array_position(slot->position - 1, "array_index_find") : -1;
+}
+
+int array_index_contains(ArrayIndex *index, int data) {
+    return index_lookup(index, data) != NULL;
+}
+
+size_t array_index_count(ArrayIndex *index, int data) {
+    ArrayIndexSlot *slot = index_lookup(index, data);
+    return slot != NULL ? slot->count : 0;
+}
+
+size_t array_index_size(ArrayIndex *index) {
+    return index->size;
+}
+
+// Grows the table before touching the array, so a failure leaves both unchanged
+int array_index_append(ArrayIndex *index, int data) {
+    if (!index_reserve(index, index->size + 1)) {
+        return 0;
+    }
+    Array *arr = index->arr;
+    size_t count = arr->count;
+    array_append(arr, data);
+    if (arr->count == count) {
+        return 0; // array_append failed and has reported why
+    }
+    index_add(index, data, arr->count);
+    return 1;
+}
+
+int array_index_delete_at(ArrayIndex *index, int position) {
+    Array *arr = index->arr;
+    if (position < 1 || (size_t)position > arr->count) {
+        printf("Index out of bounds\n");
+        return 0;
+    }
+    size_t p = (size_t)position;
+    size_t count = arr->count;
+    int key = arr->data[p - 1];
+    array_delete_at(arr, position);
+    if (arr->count == count) {
+        return 0; // array_delete_at refused (read-only array) and has reported why
+    }
+
+    // Every first occurrence after the gap moved down one place
+    if (p <= arr->count) {
+        for (size_t i = 0; i < index->capacity; i++) {
+            if (index->slots[i].distance != 0 && index->slots[i].position > p) {
+                index->slots[i].position--;
+            }
+        }
+    }
+
+    ArrayIndexSlot *slot = index_lookup(index, key);
+    if (--slot->count == 0) {
+        index_remove(index, slot);
+    } else if (slot->position == p) {
+        // The first occurrence went away; the next one is somewhere after it
+        slot->position = p + array_simd_find(arr->data + p - 1, arr->count - (p - 1), key);
+    }
+    return 1;
+}
+
+void array_index_destroy(ArrayIndex *index) {
+    if (index == NULL) return; // Safety check
+    free(index->slots);
+    index->slots = NULL;
+    index->capacity = 0;
+    index->size = 0;
+    index->shift = 64;
+    index->arr = NULL;
+}
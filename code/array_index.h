@@ -0,0 +1,75 @@
+#ifndef ARRAY_INDEX_H // Start of include guard
+#define ARRAY_INDEX_H
+
+#include <stddef.h> // For size_t
+#include "array.h"  // The indexed container
+
+// --- Hash Index over an Array ---
+// Maps each distinct value of an Array to the 1-based position of its first occurrence
+// (what array_find returns) and to its number of occurrences, so membership tests cost
+// O(1) expected instead of a scan. Typical use is deduplication:
+//
+//     if (array_index_find(&index, value) == -1) array_index_append(&index, value);
+//
+// The table uses open addressing with Robin Hood probing: on insert, an entry that is
+// further from its home slot takes the place of one that is closer, so probe lengths stay
+// short and even, and a lookup can stop as soon as it meets an entry closer to home than
+// the one it is looking for. Deletes shift the following entries back instead of leaving
+// tombstones. The capacity is a power of two, kept at most 7/8 full.
+//
+// The index stays correct only while the array is changed through array_index_append and
+// array_index_delete_at. After any other change (array_append, array_sort, writes through
+// arr->data, ...) call array_index_build again.
+
+// Smallest table allocated by array_index_build.
+#define ARRAY_INDEX_MIN_CAPACITY 16
+
+typedef struct ArrayIndexSlot {
+    int key;
+    unsigned int distance; // Probe distance from the home slot + 1; 0 marks an empty slot
+    size_t position;       // 1-based index of the key's first occurrence in the array
+    size_t count;          // Occurrences of the key in the array
+} ArrayIndexSlot;
+
+typedef struct ArrayIndex {
+    ArrayIndexSlot *slots;
+    size_t capacity;    // Power of two
+    size_t size;        // Number of distinct keys
+    unsigned int shift; // 64 - log2(capacity), for the multiplicative hash
+    Array *arr;         // The indexed array (not owned)
+} ArrayIndex;
+
+
+// --- Function Prototypes ---
+
+// Indexes the current contents of 'arr' in one pass. Returns 1 on success, 0 on failure.
+// The index keeps a pointer to 'arr', which must outlive it. Like array_init, this starts
+// from scratch: destroy a previously built index first.
+int array_index_build(ArrayIndex *index, Array *arr);
+
+// Same contract as array_find: 1-based index of the first occurrence of 'data', or -1.
+int array_index_find(ArrayIndex *index, int data);
+
+// Returns 1 if 'data' occurs in the array, 0 otherwise.
+int array_index_contains(ArrayIndex *index, int data);
+
+// Same contract as array_count, in O(1).
+size_t array_index_count(ArrayIndex *index, int data);
+
+// Number of distinct values in the array.
+size_t array_index_size(ArrayIndex *index);
+
+// array_append that keeps the index in sync. Returns 1 on success, 0 on failure
+// (the array and the index are then unchanged).
+int array_index_append(ArrayIndex *index, int data);
+
+// array_delete_at (1-based) that keeps the index in sync. Deleting the last element is
+// O(1); anywhere else the later positions shift down, which costs O(capacity) on top of
+// the array's own O(n) move. Returns 1 on success, 0 on failure (prints
+// "Index out of bounds" for a bad index, like array_delete_at).
+int array_index_delete_at(ArrayIndex *index, int position);
+
+// Frees the table. Does NOT free the ArrayIndex struct itself or touch the array.
+void array_index_destroy(ArrayIndex *index);
+
+#endif // ARRAY_INDEX_H // End of include guard
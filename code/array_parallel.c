@@ -0,0 +1,346 @@
+#include "array_parallel.h" // Include the header file
+#include <stdio.h>          // For fprintf
+#include <stdlib.h>         // For malloc, free
+#include <string.h>         // For memcpy
+
+// Helper: number of ARRAY_PARALLEL_CHUNK-sized chunks covering 'n' elements
+static size_t chunk_count(size_t n) {
+    return (n + ARRAY_PARALLEL_CHUNK - 1) / ARRAY_PARALLEL_CHUNK;
+}
+
+// Helper: 0-based [*start, *end) of chunk 'chunk' out of 'n' elements
+static void chunk_bounds(size_t chunk, size_t n, size_t *start, size_t *end) {
+    *start = chunk * ARRAY_PARALLEL_CHUNK;
+    *end = (n - *start < ARRAY_PARALLEL_CHUNK) ? n : *start + ARRAY_PARALLEL_CHUNK;
+}
+
+// Helper: 1 if the parallel path is worth taking
+static int use_parallel(struct ThreadPool *pool, const Array *arr) {
+    return thread_pool_size(pool) > 1 && arr->count >= ARRAY_PARALLEL_THRESHOLD;
+}
+
+// Helper: refuses changes to read-only mapped arrays, like the serial mutators
+static int parallel_writable(Array *arr, const char *caller) {
+    if (array_is_read_only(arr)) {
+        fprintf(stderr, "Error: %s on a read-only mapped array.\n", caller);
+        return 0;
+    }
+    return 1;
+}
+
+
+// ----- For Each -----
+
+struct ForEachJob {
+    const int *data;
+    size_t count;
+    ArrayVisitFn fn;
+    void *ctx;
+};
+
+static void for_each_chunk(void *arg, size_t chunk) {
+    struct ForEachJob *job = arg;
+    size_t start, end;
+    chunk_bounds(chunk, job->count, &start, &end);
+    for (size_t i = start; i < end; i++) {
+        job->fn(job->data[i], i + 1, job->ctx);
+    }
+}
+
+int array_parallel_for_each(struct ThreadPool *pool, Array *arr, ArrayVisitFn fn, void *ctx) {
+    if (arr == NULL || fn == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_parallel_for_each.\n");
+        return 0;
+    }
+    struct ForEachJob job = { arr->data, arr->count, fn, ctx };
+    if (!use_parallel(pool, arr)) {
+        for (size_t i = 0; i < arr->count; i++) {
+            fn(arr->data[i], i + 1, ctx);
+        }
+        return 1;
+    }
+    thread_pool_run(pool, for_each_chunk, &job, chunk_count(arr->count));
+    return 1;
+}
+
+
+// ----- Reduce -----
+
+struct ReduceJob {
+    const int *data;
+    size_t count;
+    long long identity;
+    ArrayFoldFn fold;
+    void *ctx;
+    long long *partials; // One result per chunk
+};
+
+static void reduce_chunk(void *arg, size_t chunk) {
+    struct ReduceJob *job = arg;
+    size_t start, end;
+    chunk_bounds(chunk, job->count, &start, &end);
+    long long acc = job->identity;
+    for (size_t i = start; i < end; i++) {
+        acc = job->fold(acc, job->data[i], job->ctx);
+    }
+    job->partials[chunk] = acc; // One write per chunk, so no false sharing in the loop
+}
+
+long long array_parallel_reduce(struct ThreadPool *pool, Array *arr, long long identity,
+                                ArrayFoldFn fold, ArrayCombineFn combine, void *ctx) {
+    if (arr == NULL || fold == NULL || combine == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_parallel_reduce.\n");
+        return identity;
+    }
+    size_t chunks = chunk_count(arr->count);
+    long long *partials = use_parallel(pool, arr) ? malloc(chunks * sizeof(long long)) : NULL;
+    if (partials == NULL) {
+        return array_fold(arr, identity, fold, ctx); // Serial path
+    }
+    struct ReduceJob job = { arr->data, arr->count, identity, fold, ctx, partials };
+    thread_pool_run(pool, reduce_chunk, &job, chunks);
+
+    long long result = identity;
+    for (size_t c = 0; c < chunks; c++) {
+        result = combine(result, partials[c], ctx); // Left to right, so order-sensitive joins work
+    }
+    free(partials);
+    return result;
+}
+
+
+// ----- Transform -----
+
+// Order facts about one mapped chunk, enough to decide sorted mode afterwards
+struct ChunkOrder {
+    int first;
+    int last;
+    int sorted;
+};
+
+struct TransformJob {
+    int *data;
+    size_t count;
+    ArrayMapFn fn;
+    void *ctx;
+    struct ChunkOrder *order; // One per chunk
+};
+
+static void transform_chunk(void *arg, size_t chunk) {
+    struct TransformJob *job = arg;
+    size_t start, end;
+    chunk_bounds(chunk, job->count, &start, &end);
+    int *data = job->data;
+    int sorted = 1;
+    for (size_t i = start; i < end; i++) {
+        data[i] = job->fn(data[i], job->ctx);
+        if (i > start && data[i] < data[i - 1]) {
+            sorted = 0;
+        }
+    }
+    job->order[chunk].first = data[start];
+    job->order[chunk].last = data[end - 1];
+    job->order[chunk].sorted = sorted;
+}
+
+int array_parallel_transform(struct ThreadPool *pool, Array *arr, ArrayMapFn fn, void *ctx) {
+    if (arr == NULL || fn == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_parallel_transform.\n");
+        return 0;
+    }
+    if (!parallel_writable(arr, "array_parallel_transform")) {
+        return 0;
+    }
+    size_t chunks = chunk_count(arr->count);
+    struct ChunkOrder *order = use_parallel(pool, arr) ? malloc(chunks * sizeof(struct ChunkOrder)) : NULL;
+    if (order == NULL) {
+        return array_map(arr, fn, ctx); // Serial path
+    }
+    struct TransformJob job = { arr->data, arr->count, fn, ctx, order };
+    thread_pool_run(pool, transform_chunk, &job, chunks);
+
+    // Sorted overall = every chunk sorted and every seam in order
+    int sorted = 1;
+    for (size_t c = 0; c < chunks && sorted; c++) {
+        sorted = order[c].sorted && (c == 0 || order[c - 1].last <= order[c].first);
+    }
+    arr->sorted = arr->sorted && sorted;
+    free(order);
+    return 1;
+}
+
+
+// ----- Filter -----
+
+struct FilterJob {
+    int *data;
+    size_t count;
+    ArrayPredicate keep;
+    void *ctx;
+    int *scratch;   // Chunk c packs its kept elements at its own offset in here
+    size_t *counts;  // Kept per chunk
+    size_t *offsets; // Where each chunk's run goes: prefix sum of 'counts'
+};
+
+// Pass 1: evaluate the predicate once per element and pack the survivors
+static void filter_pack_chunk(void *arg, size_t chunk) {
+    struct FilterJob *job = arg;
+    size_t start, end;
+    chunk_bounds(chunk, job->count, &start, &end);
+    int *out = job->scratch + start;
+    size_t kept = 0;
+    for (size_t i = start; i < end; i++) {
+        int value = job->data[i];
+        out[kept] = value;
+        kept += (job->keep(value, job->ctx) != 0); // Branch-free: always write, advance on keep
+    }
+    job->counts[chunk] = kept;
+}
+
+// Pass 2: move each packed run to its final offset; the runs are disjoint
+static void filter_place_chunk(void *arg, size_t chunk) {
+    struct FilterJob *job = arg;
+    memcpy(job->data + job->offsets[chunk], job->scratch + chunk * ARRAY_PARALLEL_CHUNK,
+           job->counts[chunk] * sizeof(int));
+}
+
+int array_parallel_filter(struct ThreadPool *pool, Array *arr, ArrayPredicate keep, void *ctx) {
+    if (arr == NULL || keep == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for array_parallel_filter.\n");
+        return 0;
+    }
+    if (!parallel_writable(arr, "array_parallel_filter")) {
+        return 0;
+    }
+    if (!use_parallel(pool, arr)) {
+        return array_filter(arr, keep, ctx);
+    }
+    size_t chunks = chunk_count(arr->count);
+    int *scratch = malloc(arr->count * sizeof(int));
+    size_t *counts = malloc(2 * chunks * sizeof(size_t));
+    if (scratch == NULL || counts == NULL) {
+        free(scratch);
+        free(counts);
+        return array_filter(arr, keep, ctx); // In-place fallback, no extra memory
+    }
+    struct FilterJob job = { arr->data, arr->count, keep, ctx, scratch, counts, counts + chunks };
+    thread_pool_run(pool, filter_pack_chunk, &job, chunks);
+
+    // Exclusive prefix sum over the per-chunk counts: one entry per chunk, so it is cheap
+    size_t total = 0;
+    for (size_t c = 0; c < chunks; c++) {
+        job.offsets[c] = total;
+        total += counts[c];
+    }
+    thread_pool_run(pool, filter_place_chunk, &job, chunks);
+    arr->count = total; // Survivors keep their order, so sorted mode stands
+
+    free(counts);
+    free(scratch);
+    return 1;
+}
+
+
+// ----- Sort -----
+
+struct SortJob {
+    Array *arr;
+    size_t count;
+    int *src;       // Current merge round reads runs of 'width' from here...
+    int *dst;       // ...and writes runs of 2 * width here
+    size_t width;
+};
+
+static void sort_chunk(void *arg, size_t chunk) {
+    struct SortJob *job = arg;
+    size_t start, end;
+    chunk_bounds(chunk, job->count, &start, &end);
+    array_sort_range(job->arr, start + 1, end - start);
+}
+
+// Helper: how many of the first 'k' outputs of a stable merge of a[0..m) and b[0..n)
+// come from 'a' (ties go to 'a'). Binary search for the first i where a[i] would come
+// after b[k - i - 1].
+static size_t merge_split(const int *a, size_t m, const int *b, size_t n, size_t k) {
+    size_t lo = (k > n) ? k - n : 0;
+    size_t hi = (k < m) ? k : m;
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        if (a[i] <= b[k - i - 1]) {
+            lo = i + 1; // a[i] is among the first k
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// One chunk-sized piece of the output of a merge round. The piece lies inside one pair
+// of runs (2 * width is a multiple of the chunk size); merge_split finds where in the two
+// runs it starts and ends, so pieces are merged independently.
+static void merge_piece(void *arg, size_t piece) {
+    struct SortJob *job = arg;
+    size_t start, end;
+    chunk_bounds(piece, job->count, &start, &end);
+    size_t pair = start - start % (2 * job->width);
+    size_t left_len = (job->count - pair < job->width) ? job->count - pair : job->width;
+    size_t right_len = job->count - pair - left_len;
+    if (right_len > job->width) {
+        right_len = job->width;
+    }
+    const int *a = job->src + pair;
+    const int *b = a + left_len;
+
+    size_t k0 = start - pair, k1 = end - pair;
+    size_t i = merge_split(a, left_len, b, right_len, k0);
+    size_t i_end = merge_split(a, left_len, b, right_len, k1);
+    size_t j = k0 - i, j_end = k1 - i_end;
+    int *out = job->dst + start;
+    while (i < i_end && j < j_end) {
+        *out++ = (b[j] < a[i]) ? b[j++] : a[i++];
+    }
+    memcpy(out, a + i, (i_end - i) * sizeof(int));
+    out += i_end - i;
+    memcpy(out, b + j, (j_end - j) * sizeof(int));
+}
+
+static void copy_piece(void *arg, size_t piece) {
+    struct SortJob *job = arg;
+    size_t start, end;
+    chunk_bounds(piece, job->count, &start, &end);
+    memcpy(job->dst + start, job->src + start, (end - start) * sizeof(int));
+}
+
+int array_parallel_sort(struct ThreadPool *pool, Array *arr) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot sort NULL array pointer.\n");
+        return 0;
+    }
+    if (!parallel_writable(arr, "array_parallel_sort")) {
+        return 0;
+    }
+    if (!use_parallel(pool, arr)) {
+        return array_sort(arr);
+    }
+    int *scratch = malloc(arr->count * sizeof(int));
+    if (scratch == NULL) {
+        return array_sort(arr); // The serial sort can still fall back to introsort
+    }
+    size_t pieces = chunk_count(arr->count);
+    struct SortJob job = { arr, arr->count, arr->data, scratch, ARRAY_PARALLEL_CHUNK };
+    thread_pool_run(pool, sort_chunk, &job, pieces);
+
+    for (; job.width < job.count; job.width *= 2) {
+        thread_pool_run(pool, merge_piece, &job, pieces);
+        int *merged = job.dst;
+        job.dst = job.src; // The old input becomes the next round's output
+        job.src = merged;
+    }
+    if (job.src != arr->data) {
+        job.dst = arr->data; // Odd number of rounds: the result is in scratch
+        thread_pool_run(pool, copy_piece, &job, pieces);
+    }
+    free(scratch);
+    arr->sorted = 1;
+    return 1;
+}
@@ -0,0 +1,63 @@
+#ifndef ARRAY_PARALLEL_H // Start of include guard
+#define ARRAY_PARALLEL_H
+
+#include <stddef.h>      // For size_t
+#include "array.h"       // The container and its callback types
+#include "thread_pool.h" // The threads the work is spread over
+
+// --- Parallel Array Operations ---
+// Data-parallel versions of the one-pass helpers and of array_sort. The array is cut into
+// chunks of ARRAY_PARALLEL_CHUNK consecutive elements; each pool thread claims whole
+// chunks, so it streams through memory of its own and threads never write to the same
+// cache lines (except at chunk edges).
+//
+// With a NULL or one-thread pool, or fewer than ARRAY_PARALLEL_THRESHOLD elements, every
+// function takes the serial path (array_fold, array_map, array_filter, array_sort), since
+// waking the workers would cost more than the loop itself.
+//
+// Callbacks run on several threads at once and in no particular order: they must be safe
+// to call concurrently with the same 'ctx'.
+
+// Elements per chunk: 64 KiB of ints, which stays in a core's L2 cache while it works.
+#define ARRAY_PARALLEL_CHUNK 16384
+
+// Below this many elements the serial path is used.
+#define ARRAY_PARALLEL_THRESHOLD 65536
+
+typedef void (*ArrayVisitFn)(int value, size_t index, void *ctx);               // 'index' is 1-based
+typedef long long (*ArrayCombineFn)(long long left, long long right, void *ctx); // Joins two partial results
+
+
+// --- Function Prototypes ---
+
+// Calls fn(value, index, ctx) for every element. Returns 1 on success, 0 on bad arguments.
+int array_parallel_for_each(struct ThreadPool *pool, Array *arr, ArrayVisitFn fn, void *ctx);
+
+// Folds each chunk with 'fold' starting from 'identity', then joins the chunk results
+// left to right with 'combine', starting from 'identity'. The result matches
+// array_fold(arr, identity, fold, ctx) when 'combine' is associative, 'identity' is
+// neutral for it, and folding a run equals combining it with the run's own fold, as for
+// sums, counts, min and max. Returns 'identity' on bad arguments.
+long long array_parallel_reduce(struct ThreadPool *pool, Array *arr, long long identity,
+                                ArrayFoldFn fold, ArrayCombineFn combine, void *ctx);
+
+// Parallel array_map: replaces every element with fn(value, ctx), keeping sorted mode if
+// the results are still in order. Returns 1 on success, 0 on bad arguments or a
+// read-only array.
+int array_parallel_transform(struct ThreadPool *pool, Array *arr, ArrayMapFn fn, void *ctx);
+
+// Parallel array_filter, stable: each chunk packs the elements it keeps into a scratch
+// buffer and counts them, a prefix sum over the counts gives every chunk its output
+// offset, and the chunks then copy their runs into place side by side. 'keep' is called
+// once per element. Needs a scratch buffer of count ints. Returns 1 on success, 0 on
+// failure.
+int array_parallel_filter(struct ThreadPool *pool, Array *arr, ArrayPredicate keep, void *ctx);
+
+// Parallel array_sort: chunks are sorted independently (array_sort_range), then runs are
+// merged pairwise, doubling in length each round. Every round splits its merges into
+// chunk-sized output pieces by binary search, so all threads stay busy until the end,
+// including the last merge. Enters sorted mode. Needs a scratch buffer of count ints.
+// Returns 1 on success, 0 on failure.
+int array_parallel_sort(struct ThreadPool *pool, Array *arr);
+
+#endif // ARRAY_PARALLEL_H // End of include guard
@@ -0,0 +1,425 @@
+#include "array_simd.h" // Include the header file
+#include <stddef.h>     // For size_t
+#include <stdint.h>     // For uint64_t
+#include <limits.h>     // For INT_MIN, INT_MAX
+#include <stdatomic.h>  // The dispatch pointer is shared by every thread
+
+// x86 builds get SSE4.2 and AVX2 kernels compiled with per-function target attributes,
+// so the file builds without -mavx2 and the right version is chosen at runtime.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define ARRAY_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// Count kernels keep 32-bit per-lane counters; flush them before they can overflow.
+#define COUNT_FLUSH_ELEMENTS ((size_t)1 << 28)
+
+// Table of kernels for one instruction set level
+typedef struct SimdKernels {
+    size_t (*find)(const int *data, size_t n, int value);
+    size_t (*count)(const int *data, size_t n, int value);
+    int (*min)(const int *data, size_t n);
+    int (*max)(const int *data, size_t n);
+    long long (*sum)(const int *data, size_t n);
+    size_t (*find_all)(const int *data, size_t n, int value, uint64_t *bitmap);
+} SimdKernels;
+
+
+// ----- Scalar kernels (always available, also used for the tails of vector loops) -----
+
+static size_t find_scalar(const int *data, size_t n, int value) {
+    for (size_t i = 0; i < n; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+static size_t count_scalar(const int *data, size_t n, int value) {
+    size_t matches = 0;
+    for (size_t i = 0; i < n; i++) {
+        matches += (data[i] == value); // Branch-free so random data does not mispredict
+    }
+    return matches;
+}
+
+static int min_scalar(const int *data, size_t n) {
+    int result = INT_MAX;
+    for (size_t i = 0; i < n; i++) {
+        result = data[i] < result ? data[i] : result;
+    }
+    return result;
+}
+
+static int max_scalar(const int *data, size_t n) {
+    int result = INT_MIN;
+    for (size_t i = 0; i < n; i++) {
+        result = data[i] > result ? data[i] : result;
+    }
+    return result;
+}
+
+static long long sum_scalar(const int *data, size_t n) {
+    long long total = 0;
+    for (size_t i = 0; i < n; i++) {
+        total += data[i];
+    }
+    return total;
+}
+
+// Fills bitmap words from element 'start' onward (start must be a multiple of 64)
+static size_t find_all_scalar_from(const int *data, size_t start, size_t n, int value, uint64_t *bitmap) {
+    size_t matches = 0;
+    for (size_t base = start; base < n; base += 64) {
+        size_t end = (n - base < 64) ? n : base + 64;
+        uint64_t word = 0;
+        for (size_t i = base; i < end; i++) {
+            word |= (uint64_t)(data[i] == value) << (i - base);
+        }
+        bitmap[base / 64] = word;
+        matches += (size_t)__builtin_popcountll(word);
+    }
+    return matches;
+}
+
+static size_t find_all_scalar(const int *data, size_t n, int value, uint64_t *bitmap) {
+    return find_all_scalar_from(data, 0, n, value, bitmap);
+}
+
+static const SimdKernels scalar_kernels = {
+    find_scalar, count_scalar, min_scalar, max_scalar, sum_scalar, find_all_scalar
+};
+
+
+#ifdef ARRAY_SIMD_X86
+
+// ----- SSE4.2 kernels (4 ints per vector) -----
+
+__attribute__((target("sse4.2")))
+static size_t find_sse42(const int *data, size_t n, int value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    size_t i = 0;
+    // Test 16 elements per iteration, then narrow down once something matched
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 4)), needle);
+        __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 8)), needle);
+        __m128i d = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 12)), needle);
+        __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (!_mm_testz_si128(any, any)) {
+            break;
+        }
+    }
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask != 0) {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    size_t rest = find_scalar(data + i, n - i, value);
+    return i + rest;
+}
+
+__attribute__((target("sse4.2")))
+static size_t count_sse42(const int *data, size_t n, int value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    size_t matches = 0;
+    size_t i = 0;
+    while (i + 4 <= n) {
+        size_t block_end = (n - i > COUNT_FLUSH_ELEMENTS) ? i + COUNT_FLUSH_ELEMENTS : n;
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= block_end; i += 4) {
+            __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+            acc = _mm_sub_epi32(acc, eq); // Matching lanes are -1, so subtracting counts them
+        }
+        unsigned lanes[4];
+        _mm_storeu_si128((__m128i *)lanes, acc);
+        matches += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    return matches + count_scalar(data + i, n - i, value);
+}
+
+__attribute__((target("sse4.2")))
+static int min_sse42(const int *data, size_t n) {
+    __m128i acc = _mm_set1_epi32(INT_MAX);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_min_epi32(acc, _mm_loadu_si128((const __m128i *)(data + i)));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    int result = min_scalar(lanes, 4);
+    int tail = min_scalar(data + i, n - i);
+    return tail < result ? tail : result;
+}
+
+__attribute__((target("sse4.2")))
+static int max_sse42(const int *data, size_t n) {
+    __m128i acc = _mm_set1_epi32(INT_MIN);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_max_epi32(acc, _mm_loadu_si128((const __m128i *)(data + i)));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    int result = max_scalar(lanes, 4);
+    int tail = max_scalar(data + i, n - i);
+    return tail > result ? tail : result;
+}
+
+__attribute__((target("sse4.2")))
+static long long sum_sse42(const int *data, size_t n) {
+    __m128i acc_lo = _mm_setzero_si128();
+    __m128i acc_hi = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        acc_lo = _mm_add_epi64(acc_lo, _mm_cvtepi32_epi64(v));                    // Lanes 0-1
+        acc_hi = _mm_add_epi64(acc_hi, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8))); // Lanes 2-3
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc_lo, acc_hi));
+    return lanes[0] + lanes[1] + sum_scalar(data + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+static size_t find_all_sse42(const int *data, size_t n, int value, uint64_t *bitmap) {
+    const __m128i needle = _mm_set1_epi32(value);
+    size_t matches = 0;
+    size_t base = 0;
+    for (; base + 64 <= n; base += 64) {
+        uint64_t word = 0;
+        for (int group = 0; group < 16; group++) {
+            __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + base + group * 4)), needle);
+            word |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(eq)) << (group * 4);
+        }
+        bitmap[base / 64] = word;
+        matches += (size_t)__builtin_popcountll(word);
+    }
+    return matches + find_all_scalar_from(data, base, n, value, bitmap);
+}
+
+static const SimdKernels sse42_kernels = {
+    find_sse42, count_sse42, min_sse42, max_sse42, sum_sse42, find_all_sse42
+};
+
+
+// ----- AVX2 kernels (8 ints per vector) -----
+
+__attribute__((target("avx2")))
+static size_t find_avx2(const int *data, size_t n, int value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    size_t i = 0;
+    // Test 32 elements per iteration, then narrow down once something matched
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 8)), needle);
+        __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 16)), needle);
+        __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 24)), needle);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (!_mm256_testz_si256(any, any)) {
+            break;
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask != 0) {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    size_t rest = find_scalar(data + i, n - i, value);
+    return i + rest;
+}
+
+__attribute__((target("avx2")))
+static size_t count_avx2(const int *data, size_t n, int value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    size_t matches = 0;
+    size_t i = 0;
+    while (i + 8 <= n) {
+        size_t block_end = (n - i > COUNT_FLUSH_ELEMENTS) ? i + COUNT_FLUSH_ELEMENTS : n;
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= block_end; i += 8) {
+            __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+            acc = _mm256_sub_epi32(acc, eq); // Matching lanes are -1, so subtracting counts them
+        }
+        unsigned lanes[8];
+        _mm256_storeu_si256((__m256i *)lanes, acc);
+        for (int lane = 0; lane < 8; lane++) {
+            matches += lanes[lane];
+        }
+    }
+    return matches + count_scalar(data + i, n - i, value);
+}
+
+__attribute__((target("avx2")))
+static int min_avx2(const int *data, size_t n) {
+    __m256i acc = _mm256_set1_epi32(INT_MAX);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_min_epi32(acc, _mm256_loadu_si256((const __m256i *)(data + i)));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int result = min_scalar(lanes, 8);
+    int tail = min_scalar(data + i, n - i);
+    return tail < result ? tail : result;
+}
+
+__attribute__((target("avx2")))
+static int max_avx2(const int *data, size_t n) {
+    __m256i acc = _mm256_set1_epi32(INT_MIN);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_max_epi32(acc, _mm256_loadu_si256((const __m256i *)(data + i)));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int result = max_scalar(lanes, 8);
+    int tail = max_scalar(data + i, n - i);
+    return tail > result ? tail : result;
+}
+
+__attribute__((target("avx2")))
+static long long sum_avx2(const int *data, size_t n) {
+    __m256i acc_lo = _mm256_setzero_si256();
+    __m256i acc_hi = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        acc_lo = _mm256_add_epi64(acc_lo, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc_hi = _mm256_add_epi64(acc_hi, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(acc_lo, acc_hi));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(data + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static size_t find_all_avx2(const int *data, size_t n, int value, uint64_t *bitmap) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    size_t matches = 0;
+    size_t base = 0;
+    for (; base + 64 <= n; base += 64) {
+        uint64_t word = 0;
+        for (int group = 0; group < 8; group++) {
+            __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + base + group * 8)), needle);
+            word |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(eq)) << (group * 8);
+        }
+        bitmap[base / 64] = word;
+        matches += (size_t)__builtin_popcountll(word);
+    }
+    return matches + find_all_scalar_from(data, base, n, value, bitmap);
+}
+
+static const SimdKernels avx2_kernels = {
+    find_avx2, count_avx2, min_avx2, max_avx2, sum_avx2, find_all_avx2
+};
+
+#endif // ARRAY_SIMD_X86
+
+
+// ----- Runtime dispatch -----
+
+// Chosen on first use, which may happen on several threads at once (concurrent_array
+// readers, for instance). Each of them detects the same level and stores the same
+// values, so the race is harmless as long as the stores are atomic. The level is
+// stored before the kernels (release), so whoever sees the kernels (acquire) also
+// sees the level that goes with them.
+static _Atomic(const SimdKernels *) active_kernels = NULL;
+static _Atomic ArraySimdLevel active_level = ARRAY_SIMD_SCALAR;
+
+// Helper: best level this CPU can run
+static ArraySimdLevel detect_level(void) {
+#ifdef ARRAY_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return ARRAY_SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return ARRAY_SIMD_SSE42;
+    }
+#endif
+    return ARRAY_SIMD_SCALAR;
+}
+
+ArraySimdLevel array_simd_set_level(ArraySimdLevel level) {
+    ArraySimdLevel best = detect_level();
+    if (level > best) {
+        level = best; // Cannot run what the CPU lacks
+    }
+
+    const SimdKernels *chosen;
+    switch (level) {
+#ifdef ARRAY_SIMD_X86
+    case ARRAY_SIMD_AVX2:
+        chosen = &avx2_kernels;
+        break;
+    case ARRAY_SIMD_SSE42:
+        chosen = &sse42_kernels;
+        break;
+#endif
+    default:
+        level = ARRAY_SIMD_SCALAR;
+        chosen = &scalar_kernels;
+        break;
+    }
+    atomic_store_explicit(&active_level, level, memory_order_relaxed);
+    atomic_store_explicit(&active_kernels, chosen, memory_order_release);
+    return level;
+}
+
+ArraySimdLevel array_simd_level(void) {
+    if (atomic_load_explicit(&active_kernels, memory_order_acquire) == NULL) {
+        array_simd_set_level(detect_level());
+    }
+    return atomic_load_explicit(&active_level, memory_order_relaxed);
+}
+
+const char *array_simd_level_name(ArraySimdLevel level) {
+    switch (level) {
+    case ARRAY_SIMD_AVX2:
+        return "avx2";
+    case ARRAY_SIMD_SSE42:
+        return "sse4.2";
+    default:
+        return "scalar";
+    }
+}
+
+// Helper: kernels for the active level, detecting it on first use
+static const SimdKernels *kernels(void) {
+    const SimdKernels *k = atomic_load_explicit(&active_kernels, memory_order_acquire);
+    if (k == NULL) {
+        array_simd_level();
+        k = atomic_load_explicit(&active_kernels, memory_order_acquire);
+    }
+    return k;
+}
+
+size_t array_simd_find(const int *data, size_t n, int value) {
+    return kernels()->find(data, n, value);
+}
+
+size_t array_simd_count(const int *data, size_t n, int value) {
+    return kernels()->count(data, n, value);
+}
+
+int array_simd_min(const int *data, size_t n) {
+    return kernels()->min(data, n);
+}
+
+int array_simd_max(const int *data, size_t n) {
+    return kernels()->max(data, n);
+}
+
+long long array_simd_sum(const int *data, size_t n) {
+    return kernels()->sum(data, n);
+}
+
+size_t array_simd_find_all(const int *data, size_t n, int value, uint64_t *bitmap) {
+    return kernels()->find_all(data, n, value, bitmap);
+}
@@ -0,0 +1,47 @@
+#ifndef ARRAY_SIMD_H // Start of include guard
+#define ARRAY_SIMD_H
+
+#include <stddef.h> // For size_t
+#include <stdint.h> // For uint64_t
+
+// Vectorized scan kernels behind array_find, array_count, array_min, array_max,
+// array_sum and array_find_all. The best level the CPU supports is picked on first
+// use (AVX2, then SSE4.2, then plain C); benchmarks and tests can pin a level.
+// All kernels take raw 0-based buffers; array.c does the Array bookkeeping.
+
+typedef enum ArraySimdLevel {
+    ARRAY_SIMD_SCALAR,
+    ARRAY_SIMD_SSE42,
+    ARRAY_SIMD_AVX2
+} ArraySimdLevel;
+
+// Returns the level currently in use (detects it on first call).
+ArraySimdLevel array_simd_level(void);
+
+// Forces a level. Levels the CPU cannot run fall back to the best supported one.
+// Returns the level actually selected. The automatic choice on first use is
+// thread-safe; forcing a level is meant for setup code and tests, before other
+// threads are scanning.
+ArraySimdLevel array_simd_set_level(ArraySimdLevel level);
+
+// Human-readable name of a level ("avx2", "sse4.2", "scalar").
+const char *array_simd_level_name(ArraySimdLevel level);
+
+// Returns the 0-based index of the first element equal to 'value', or 'n' if absent.
+size_t array_simd_find(const int *data, size_t n, int value);
+
+// Returns how many elements equal 'value'.
+size_t array_simd_count(const int *data, size_t n, int value);
+
+// Smallest / largest element. 'n' must be at least 1.
+int array_simd_min(const int *data, size_t n);
+int array_simd_max(const int *data, size_t n);
+
+// Sum of all elements with a 64-bit accumulator.
+long long array_simd_sum(const int *data, size_t n);
+
+// Sets bit i of 'bitmap' when data[i] == value (bitmap needs (n + 63) / 64 words,
+// all of which are overwritten). Returns the number of matches.
+size_t array_simd_find_all(const int *data, size_t n, int value, uint64_t *bitmap);
+
+#endif // ARRAY_SIMD_H // End of include guard
@@ -0,0 +1,375 @@
+#include "array.h"  // Include the header file
+#include <stdio.h>  // For fprintf
+#include <stdlib.h> // For malloc, free
+#include <string.h> // For memcpy, memset
+
+// Below this many elements introsort beats the four radix passes
+#define RADIX_SORT_THRESHOLD 512
+
+// Partitions smaller than this are finished by insertion sort
+#define INSERTION_SORT_THRESHOLD 16
+
+// Number of binary searches array_find_many keeps in flight at once
+#define FIND_MANY_BATCH 16
+
+
+// ----- Sorting -----
+
+// Helper: plain insertion sort, fast for tiny ranges
+static void insertion_sort(int *a, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        int value = a[i];
+        size_t j = i;
+        while (j > 0 && a[j - 1] > value) {
+            a[j] = a[j - 1];
+            j--;
+        }
+        a[j] = value;
+    }
+}
+
+// Helper: moves a[root] down until the max-heap property holds
+static void sift_down(int *a, size_t root, size_t n) {
+    int value = a[root];
+    for (;;) {
+        size_t child = 2 * root + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && a[child + 1] > a[child]) {
+            child++; // Pick the larger child
+        }
+        if (a[child] <= value) {
+            break;
+        }
+        a[root] = a[child];
+        root = child;
+    }
+    a[root] = value;
+}
+
+// Helper: heap sort, the O(n log n) guarantee when quicksort recursion gets too deep
+static void heap_sort(int *a, size_t n) {
+    for (size_t i = n / 2; i-- > 0;) {
+        sift_down(a, i, n);
+    }
+    for (size_t end = n; end-- > 1;) {
+        int top = a[0];
+        a[0] = a[end];
+        a[end] = top;
+        sift_down(a, 0, end);
+    }
+}
+
+// Helper: quicksort with median-of-three pivots that switches to heap sort after
+// 'depth' levels, leaving small partitions for a final insertion sort pass
+static void introsort_loop(int *a, size_t n, int depth) {
+    while (n > INSERTION_SORT_THRESHOLD) {
+        if (depth == 0) {
+            heap_sort(a, n);
+            return;
+        }
+        depth--;
+
+        // Order first, middle and last so they act as sentinels for the scans below
+        size_t mid = n / 2;
+        int tmp;
+        if (a[mid] < a[0])     { tmp = a[mid]; a[mid] = a[0]; a[0] = tmp; }
+        if (a[n - 1] < a[0])   { tmp = a[n - 1]; a[n - 1] = a[0]; a[0] = tmp; }
+        if (a[n - 1] < a[mid]) { tmp = a[n - 1]; a[n - 1] = a[mid]; a[mid] = tmp; }
+        int pivot = a[mid];
+
+        // Hoare partition: afterwards [0, j] <= pivot <= [j + 1, n)
+        size_t i = 0;
+        size_t j = n - 1;
+        for (;;) {
+            while (a[i] < pivot) i++;
+            while (a[j] > pivot) j--;
+            if (i >= j) {
+                break;
+            }
+            tmp = a[i]; a[i] = a[j]; a[j] = tmp;
+            i++;
+            j--;
+        }
+
+        // Recurse into the smaller side, loop on the larger one to bound stack depth
+        size_t left = j + 1;
+        if (left < n - left) {
+            introsort_loop(a, left, depth);
+            a += left;
+            n -= left;
+        } else {
+            introsort_loop(a + left, n - left, depth);
+            n = left;
+        }
+    }
+}
+
+// Helper: introsort entry point
+static void introsort(int *a, size_t n) {
+    int depth = 0;
+    for (size_t m = n; m > 1; m >>= 1) {
+        depth += 2; // 2 * log2(n) levels before falling back to heap sort
+    }
+    introsort_loop(a, n, depth);
+    insertion_sort(a, n); // Everything is now within INSERTION_SORT_THRESHOLD of its place
+}
+
+// Helper: LSD radix sort on the four bytes of each key, using 'scratch' (n ints).
+// Flipping the sign bit makes negative numbers order before positive ones.
+static void radix_sort(int *data, int *scratch, size_t n) {
+    size_t counts[4][256];
+    memset(counts, 0, sizeof(counts));
+
+    // One read pass builds all four histograms
+    for (size_t i = 0; i < n; i++) {
+        unsigned key = (unsigned)data[i] ^ 0x80000000u;
+        counts[0][key & 0xFF]++;
+        counts[1][(key >> 8) & 0xFF]++;
+        counts[2][(key >> 16) & 0xFF]++;
+        counts[3][key >> 24]++;
+    }
+
+    int *src = data;
+    int *dst = scratch;
+    unsigned first_key = (unsigned)data[0] ^ 0x80000000u;
+    for (int pass = 0; pass < 4; pass++) {
+        int shift = pass * 8;
+        size_t *count = counts[pass];
+        if (count[(first_key >> shift) & 0xFF] == n) {
+            continue; // Every key shares this byte, the pass would not move anything
+        }
+
+        size_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t c = count[b];
+            count[b] = offset; // Histogram becomes the start offset of each bucket
+            offset += c;
+        }
+        for (size_t i = 0; i < n; i++) {
+            unsigned key = (unsigned)src[i] ^ 0x80000000u;
+            dst[count[(key >> shift) & 0xFF]++] = src[i];
+        }
+
+        int *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != data) {
+        memcpy(data, src, n * sizeof(int)); // Odd number of passes ran
+    }
+}
+
+// Function to sort the array and enter sorted mode
+int array_sort(Array *arr) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot sort NULL array pointer.\n");
+        return 0;
+    }
+    if (array_is_read_only(arr)) {
+        fprintf(stderr, "Error: array_sort on a read-only mapped array.\n");
+        return 0;
+    }
+
+    if (arr->count >= RADIX_SORT_THRESHOLD) {
+        int *scratch = malloc(arr->count * sizeof(int));
+        if (scratch != NULL) {
+            radix_sort(arr->data, scratch, arr->count);
+            free(scratch);
+        } else {
+            introsort(arr->data, arr->count); // In-place fallback, no extra memory
+        }
+    } else {
+        introsort(arr->data, arr->count);
+    }
+    arr->sorted = 1;
+    return 1;
+}
+
+// Same algorithms on one 1-based range; only a whole-array sort enters sorted mode
+int array_sort_range(Array *arr, size_t index, size_t n) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot sort NULL array pointer.\n");
+        return 0;
+    }
+    if (index < 1 || index > arr->count || n > arr->count - (index - 1)) {
+        printf("Index out of bounds\n");
+        return 0;
+    }
+    if (n == arr->count) {
+        return array_sort(arr);
+    }
+    if (array_is_read_only(arr)) {
+        fprintf(stderr, "Error: array_sort_range on a read-only mapped array.\n");
+        return 0;
+    }
+
+    int *range = arr->data + (index - 1);
+    int *scratch = (n >= RADIX_SORT_THRESHOLD) ? malloc(n * sizeof(int)) : NULL;
+    if (scratch != NULL) {
+        radix_sort(range, scratch, n);
+        free(scratch);
+    } else {
+        introsort(range, n);
+    }
+    // Sorted mode is unchanged: a sorted array has sorted ranges, so nothing moved
+    return 1;
+}
+
+int array_is_sorted(Array *arr) {
+    return arr->sorted;
+}
+
+
+// ----- Binary Search -----
+
+// Helper: 0-based index of the first element >= 'data' (or > 'data' when 'upper').
+// Each step is a conditional move, so there are no branch mispredictions to pay for.
+static size_t bound_index(const int *a, size_t n, int data, int upper) {
+    if (n == 0) {
+        return 0;
+    }
+    const int *base = a;
+    while (n > 1) {
+        size_t half = n / 2;
+        int go_right = upper ? (base[half] <= data) : (base[half] < data);
+        base = go_right ? base + half : base;
+        n -= half;
+    }
+    int past = upper ? (*base <= data) : (*base < data);
+    return (size_t)(base - a) + (size_t)past;
+}
+
+// Helper: reports misuse of the bound functions on unsorted data
+static int require_sorted(Array *arr, const char *function) {
+    if (arr == NULL || !arr->sorted) {
+        fprintf(stderr, "Error: %s requires a sorted array (call array_sort first).\n", function);
+        return 0;
+    }
+    return 1;
+}
+
+int array_lower_bound(Array *arr, int data) {
+    if (!require_sorted(arr, "array_lower_bound")) {
+        return -1;
+    }
+    return array_position(bound_index(arr->data, arr->count, data, 0), "array_lower_bound"); // 1-based
+}
+
+int array_upper_bound(Array *arr, int data) {
+    if (!require_sorted(arr, "array_upper_bound")) {
+        return -1;
+    }
+    return array_position(bound_index(arr->data, arr->count, data, 1), "array_upper_bound"); // 1-based
+}
+
+// Function to look up many keys at once
+int array_find_many(Array *arr, const int *keys, size_t n, int *positions) {
+    if (arr == NULL || ((keys == NULL || positions == NULL) && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for array_find_many.\n");
+        return 0;
+    }
+
+    if (!arr->sorted || arr->count == 0) {
+        for (size_t i = 0; i < n; i++) {
+            positions[i] = array_find(arr, keys[i]);
+        }
+        return 1;
+    }
+
+    const int *data = arr->data;
+    for (size_t start = 0; start < n; start += FIND_MANY_BATCH) {
+        size_t batch = (n - start < FIND_MANY_BATCH) ? n - start : FIND_MANY_BATCH;
+        const int *base[FIND_MANY_BATCH];
+        for (size_t j = 0; j < batch; j++) {
+            base[j] = data;
+        }
+
+        // All searches share the same length sequence, so they advance in lockstep:
+        // while one key waits on its cache miss the others issue theirs
+        size_t len = arr->count;
+        while (len > 1) {
+            size_t half = len / 2;
+            size_t next_half = (len - half) / 2;
+            for (size_t j = 0; j < batch; j++) {
+                base[j] = (base[j][half] < keys[start + j]) ? base[j] + half : base[j];
+                __builtin_prefetch(base[j] + next_half); // Next probe for this key
+            }
+            len -= half;
+        }
+
+        for (size_t j = 0; j < batch; j++) {
+            size_t index = (size_t)(base[j] - data) + (size_t)(*base[j] < keys[start + j]);
+            positions[start + j] = (index < arr->count && data[index] == keys[start + j]) ? array_position(index, "array_find_many") : -1;
+        }
+    }
+    return 1;
+}
+
+
+// ----- Eytzinger Layout -----
+
+// Helper: fills tree/rank in BFS order by walking the implicit tree in-order,
+// which visits the sorted input front to back. Returns the next sorted index.
+static size_t eytzinger_fill(ArrayEytzinger *ey, const int *sorted, size_t i, size_t k) {
+    if (k <= ey->count) {
+        i = eytzinger_fill(ey, sorted, i, 2 * k);
+        ey->tree[k] = sorted[i];
+        ey->rank[k] = i + 1; // 1-based index in the source array
+        i++;
+        i = eytzinger_fill(ey, sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+// Function to build the Eytzinger copy of a sorted array
+int array_eytzinger_build(ArrayEytzinger *ey, Array *arr) {
+    if (ey == NULL || !require_sorted(arr, "array_eytzinger_build")) {
+        return 0;
+    }
+
+    ey->count = arr->count;
+    ey->tree = malloc((arr->count + 1) * sizeof(int));
+    ey->rank = malloc((arr->count + 1) * sizeof(size_t));
+    if (ey->tree == NULL || ey->rank == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in array_eytzinger_build.\n");
+        array_eytzinger_destroy(ey);
+        return 0;
+    }
+    eytzinger_fill(ey, arr->data, 0, 1);
+    return 1;
+}
+
+// Helper: tree slot of the first element >= 'data', or 0 if there is none
+static size_t eytzinger_slot(const ArrayEytzinger *ey, int data) {
+    size_t k = 1;
+    while (k <= ey->count) {
+        __builtin_prefetch(ey->tree + k * 16); // Four levels ahead: 16 descendants share a cache line
+        k = 2 * k + (size_t)(ey->tree[k] < data);
+    }
+    // Undo the trailing right turns (1 bits) and the last left turn to reach the answer
+    return k >> __builtin_ffsll((long long)~k);
+}
+
+int array_eytzinger_lower_bound(const ArrayEytzinger *ey, int data) {
+    size_t k = eytzinger_slot(ey, data);
+    return array_position((k == 0) ? ey->count : ey->rank[k] - 1, "array_eytzinger_lower_bound");
+}
+
+int array_eytzinger_find(const ArrayEytzinger *ey, int data) {
+    size_t k = eytzinger_slot(ey, data);
+    return (k != 0 && ey->tree[k] == data) ? array_position(ey->rank[k] - 1, "array_eytzinger_find") : -1;
+}
+
+void array_eytzinger_destroy(ArrayEytzinger *ey) {
+    if (ey == NULL) {
+        return;
+    }
+    free(ey->tree);
+    free(ey->rank);
+    ey->tree = NULL;
+    ey->rank = NULL;
+    ey->count = 0;
+}
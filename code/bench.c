@@ -0,0 +1,127 @@
+#define _POSIX_C_SOURCE 199309L // For clock_gettime
+#include "bench.h"  // Include the header file
+#include <stdio.h>  // For fprintf
+#include <stdlib.h> // For malloc, free, qsort
+#include <time.h>   // For clock_gettime
+
+void bench_options_default(BenchOptions *opts) {
+    opts->warmup = 3;
+    opts->repetitions = 25;
+    opts->format = BENCH_FORMAT_TEXT;
+    opts->out = stdout;
+    opts->reported = 0;
+}
+
+double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Helper: qsort comparator for doubles
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Helper: one repetition, returns nanoseconds per operation
+static double run_once(const BenchCase *bench, void *ctx, size_t *ops) {
+    if (bench->mutates && bench->setup != NULL) {
+        bench->setup(ctx);
+    }
+    double start = bench_now_ns();
+    size_t done = bench->run(ctx);
+    double elapsed = bench_now_ns() - start;
+    if (bench->mutates && bench->teardown != NULL) {
+        bench->teardown(ctx);
+    }
+    *ops = done;
+    return elapsed / (double)(done > 0 ? done : 1);
+}
+
+int bench_measure(const BenchOptions *opts, const BenchCase *bench, void *ctx, BenchResult *result) {
+    size_t reps = opts->repetitions > 0 ? opts->repetitions : 1;
+    double *samples = malloc(reps * sizeof(double));
+    if (samples == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in bench_measure.\n");
+        return 0;
+    }
+
+    // Read-only cases build their input once and reuse it for every repetition
+    if (!bench->mutates && bench->setup != NULL) {
+        bench->setup(ctx);
+    }
+
+    size_t ops = 0;
+    for (size_t i = 0; i < opts->warmup; i++) {
+        run_once(bench, ctx, &ops);
+    }
+    double total = 0;
+    for (size_t i = 0; i < reps; i++) {
+        samples[i] = run_once(bench, ctx, &ops);
+        total += samples[i];
+    }
+
+    if (!bench->mutates && bench->teardown != NULL) {
+        bench->teardown(ctx);
+    }
+
+    qsort(samples, reps, sizeof(double), compare_doubles);
+    size_t p99_index = (reps * 99 + 99) / 100; // Nearest-rank percentile (1-based)
+    result->ops = ops;
+    result->median_ns = (reps % 2) ? samples[reps / 2] : (samples[reps / 2 - 1] + samples[reps / 2]) / 2;
+    result->p99_ns = samples[(p99_index > reps ? reps : p99_index) - 1];
+    result->mean_ns = total / (double)reps;
+    result->min_ns = samples[0];
+    result->ops_per_sec = result->median_ns > 0 ? 1e9 / result->median_ns : 0;
+
+    free(samples);
+    return 1;
+}
+
+void bench_report_begin(BenchOptions *opts) {
+    opts->reported = 0;
+    switch (opts->format) {
+    case BENCH_FORMAT_CSV:
+        fprintf(opts->out, "benchmark,container,size,pattern,ops,reps,median_ns,p99_ns,mean_ns,min_ns,ops_per_sec\n");
+        break;
+    case BENCH_FORMAT_JSON:
+        fprintf(opts->out, "{\"warmup\": %zu, \"repetitions\": %zu, \"results\": [", opts->warmup, opts->repetitions);
+        break;
+    default:
+        fprintf(opts->out, "%-40s %-6s %10s %-7s %8s %12s %12s %14s\n", "benchmark", "kind", "size", "pattern",
+                "ops", "median ns", "p99 ns", "ops/sec");
+        break;
+    }
+}
+
+void bench_report(BenchOptions *opts, const BenchCase *bench, size_t size, const char *pattern,
+                  const BenchResult *r) {
+    switch (opts->format) {
+    case BENCH_FORMAT_CSV:
+        fprintf(opts->out, "%s,%s,%zu,%s,%zu,%zu,%.2f,%.2f,%.2f,%.2f,%.0f\n", bench->name, bench->container, size,
+                pattern, r->ops, opts->repetitions, r->median_ns, r->p99_ns, r->mean_ns, r->min_ns, r->ops_per_sec);
+        break;
+    case BENCH_FORMAT_JSON:
+        fprintf(opts->out,
+                "%s\n  {\"benchmark\": \"%s\", \"container\": \"%s\", \"size\": %zu, \"pattern\": \"%s\", "
+                "\"ops\": %zu, \"median_ns\": %.2f, \"p99_ns\": %.2f, \"mean_ns\": %.2f, \"min_ns\": %.2f, "
+                "\"ops_per_sec\": %.0f}",
+                opts->reported > 0 ? "," : "", bench->name, bench->container, size, pattern, r->ops, r->median_ns,
+                r->p99_ns, r->mean_ns, r->min_ns, r->ops_per_sec);
+        break;
+    default:
+        fprintf(opts->out, "%-40s %-6s %10zu %-7s %8zu %12.2f %12.2f %14.0f\n", bench->name, bench->container, size,
+                pattern, r->ops, r->median_ns, r->p99_ns, r->ops_per_sec);
+        break;
+    }
+    opts->reported++;
+    fflush(opts->out);
+}
+
+void bench_report_end(BenchOptions *opts) {
+    if (opts->format == BENCH_FORMAT_JSON) {
+        fprintf(opts->out, "\n]}\n");
+    }
+}
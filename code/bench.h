@@ -0,0 +1,65 @@
+#ifndef BENCH_H // Include guard start
+#define BENCH_H
+
+#include <stdio.h>  // For FILE
+#include <stddef.h> // For size_t
+
+// --- Microbenchmark Harness ---
+// Runs a benchmark case for a number of warmup and measured repetitions and reports
+// per-operation timings (median, p99, mean, min, ops/sec) as a text table, CSV or JSON.
+// Each case's run function performs a batch of operations and returns how many it did,
+// so timings are per operation rather than per batch.
+
+typedef enum BenchFormat {
+    BENCH_FORMAT_TEXT, // Aligned table for humans
+    BENCH_FORMAT_CSV,  // One header line, one line per result
+    BENCH_FORMAT_JSON  // {"results": [ {...}, ... ]}
+} BenchFormat;
+
+typedef struct BenchOptions {
+    size_t warmup;      // Unmeasured repetitions before timing starts
+    size_t repetitions; // Measured repetitions (each yields one sample)
+    BenchFormat format;
+    FILE *out;          // Where results go
+    size_t reported;    // Results written so far (used for JSON separators)
+} BenchOptions;
+
+typedef struct BenchCase {
+    const char *name;      // Function(s) being measured, e.g. "array_find"
+    const char *container; // "array", "list" or "stack"
+    int mutates;           // 1 if run changes the structure: setup/teardown wrap every repetition
+    void (*setup)(void *ctx);    // Builds the input (not timed), may be NULL
+    size_t (*run)(void *ctx);    // Timed: performs the operations, returns how many
+    void (*teardown)(void *ctx); // Releases the input (not timed), may be NULL
+} BenchCase;
+
+typedef struct BenchResult {
+    size_t ops;            // Operations per repetition
+    double median_ns;      // Per-operation times across repetitions
+    double p99_ns;
+    double mean_ns;
+    double min_ns;
+    double ops_per_sec;    // Derived from the median
+} BenchResult;
+
+
+// --- Function Prototypes ---
+
+// Fills 'opts' with defaults: 3 warmup, 25 measured repetitions, text to stdout.
+void bench_options_default(BenchOptions *opts);
+
+// Monotonic clock in nanoseconds.
+double bench_now_ns(void);
+
+// Runs one case against 'ctx'. Returns 1 on success, 0 on failure (e.g. out of memory).
+int bench_measure(const BenchOptions *opts, const BenchCase *bench, void *ctx, BenchResult *result);
+
+// Writes the header / one result / the footer in the configured format.
+// 'size' and 'pattern' describe the input the case ran on.
+void bench_report_begin(BenchOptions *opts);
+void bench_report(BenchOptions *opts, const BenchCase *bench, size_t size, const char *pattern,
+                  const BenchResult *result);
+void bench_report_end(BenchOptions *opts);
+
+
+#endif // BENCH_H // Include guard end
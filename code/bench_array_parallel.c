@@ -0,0 +1,110 @@
+#define _POSIX_C_SOURCE 200112L // For clock_gettime
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "array_parallel.h" // Parallel operations and the thread pool
+
+// Serial vs parallel Array operations. Each operation runs on the same random data with
+// pools of 1, 2, 4 ... up to max_threads threads (1 thread = the serial path) and the
+// table shows the time and the speedup over the serial run. Times are the best of REPS.
+// Usage: ./bench_array_parallel [max_threads] [elements]   (defaults: 8, 10,000,000)
+
+#define REPS 5
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static long long add_value(long long acc, int value, void *ctx) {
+    (void)ctx;
+    return acc + value;
+}
+
+static long long add_partials(long long left, long long right, void *ctx) {
+    (void)ctx;
+    return left + right;
+}
+
+static int scale(int value, void *ctx) {
+    (void)ctx;
+    return value * 3 + 1;
+}
+
+static int is_even(int value, void *ctx) {
+    (void)ctx;
+    return (value & 1) == 0;
+}
+
+enum Op { OP_REDUCE, OP_TRANSFORM, OP_FILTER, OP_SORT };
+static const char *op_names[] = { "reduce (sum)", "transform", "filter (stable)", "sort" };
+
+static volatile long long sink; // Keeps reduce results alive
+
+// Helper: best time of REPS runs of 'op' on a fresh copy of 'input'
+static double time_op(enum Op op, struct ThreadPool *pool, const int *input, size_t n) {
+    double best = 1e30;
+    for (int rep = 0; rep < REPS; rep++) {
+        Array arr;
+        if (!array_init(&arr) || !array_append_n(&arr, input, n)) {
+            fprintf(stderr, "Error: Cannot set up the benchmark array.\n");
+            exit(1);
+        }
+        double start = now_seconds();
+        switch (op) {
+        case OP_REDUCE:
+            sink += array_parallel_reduce(pool, &arr, 0, add_value, add_partials, NULL);
+            break;
+        case OP_TRANSFORM:
+            array_parallel_transform(pool, &arr, scale, NULL);
+            break;
+        case OP_FILTER:
+            array_parallel_filter(pool, &arr, is_even, NULL);
+            break;
+        case OP_SORT:
+            array_parallel_sort(pool, &arr);
+            break;
+        }
+        double elapsed = now_seconds() - start;
+        best = elapsed < best ? elapsed : best;
+        array_destroy(&arr);
+    }
+    return best;
+}
+
+int main(int argc, char **argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    size_t n = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 10000000;
+    int *input = malloc(n * sizeof(int));
+    if (input == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for the input.\n");
+        return 1;
+    }
+    srand(42);
+    for (size_t i = 0; i < n; i++) {
+        input[i] = rand();
+    }
+
+    printf("Parallel Array operations on %zu elements (best of %d, chunk %d elements)\n", n, REPS,
+           ARRAY_PARALLEL_CHUNK);
+    printf("%-18s %8s %12s %10s\n", "operation", "threads", "ms", "speedup");
+    for (int op = OP_REDUCE; op <= OP_SORT; op++) {
+        double serial = 0;
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            struct ThreadPool pool;
+            if (!thread_pool_init(&pool, (size_t)threads)) {
+                return 1;
+            }
+            double seconds = time_op((enum Op)op, &pool, input, n);
+            thread_pool_destroy(&pool);
+            if (threads == 1) {
+                serial = seconds;
+            }
+            printf("%-18s %8d %12.2f %9.2fx\n", op_names[op], threads, seconds * 1e3, serial / seconds);
+        }
+    }
+    free(input);
+    return 0;
+}
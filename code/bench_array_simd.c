@@ -0,0 +1,113 @@
+#define _POSIX_C_SOURCE 199309L // For clock_gettime
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "array.h"      // Array container
+#include "array_simd.h" // To pin the vector level per run
+
+// Compares scalar, SSE4.2 and AVX2 scan throughput for array_find (worst case: value
+// absent), array_count, array_min, array_max, array_sum and array_find_all.
+// Usage: ./bench_array_simd [size ...]   (default sizes: 1K, 10K, 100K, 1M, 10M, 100M)
+
+// Each measurement scans roughly this many elements in total, split over repetitions
+#define ELEMENTS_PER_MEASUREMENT 200000000ULL
+
+static volatile long long sink; // Keeps results alive so the calls are not optimized out
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+enum { OP_FIND, OP_COUNT, OP_MIN, OP_MAX, OP_SUM, OP_FIND_ALL, OP_TOTAL };
+static const char *op_names[OP_TOTAL] = { "find", "count", "min", "max", "sum", "find_all" };
+
+// Runs one operation 'reps' times and returns the average nanoseconds per call
+static double run_op(int op, Array *arr, uint64_t *bitmap, size_t reps) {
+    double start = now_seconds();
+    for (size_t r = 0; r < reps; r++) {
+        switch (op) {
+        case OP_FIND:     sink += array_find(arr, -1); break; // -1 is never stored
+        case OP_COUNT:    sink += (long long)array_count(arr, 7); break;
+        case OP_MIN:      sink += array_min(arr); break;
+        case OP_MAX:      sink += array_max(arr); break;
+        case OP_SUM:      sink += array_sum(arr); break;
+        case OP_FIND_ALL: sink += (long long)array_find_all(arr, 7, bitmap); break;
+        }
+    }
+    return (now_seconds() - start) * 1e9 / (double)reps;
+}
+
+int main(int argc, char **argv) {
+    size_t default_sizes[] = { 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    size_t size_count = sizeof(default_sizes) / sizeof(default_sizes[0]);
+    size_t *sizes = default_sizes;
+
+    if (argc > 1) {
+        size_count = (size_t)(argc - 1);
+        sizes = malloc(size_count * sizeof(size_t));
+        if (sizes == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed for size list.\n");
+            return 1;
+        }
+        for (size_t i = 0; i < size_count; i++) {
+            sizes[i] = (size_t)strtoull(argv[i + 1], NULL, 10);
+        }
+    }
+
+    ArraySimdLevel levels[] = { ARRAY_SIMD_SCALAR, ARRAY_SIMD_SSE42, ARRAY_SIMD_AVX2 };
+    ArraySimdLevel best = array_simd_level();
+    printf("Best vector level on this CPU: %s\n", array_simd_level_name(best));
+    printf("%-10s %-9s %-7s %14s %12s %9s\n", "size", "op", "level", "ns/call", "Melem/s", "speedup");
+
+    for (size_t s = 0; s < size_count; s++) {
+        size_t n = sizes[s];
+        Array arr;
+        if (!array_init(&arr) || !array_reserve(&arr, n)) {
+            fprintf(stderr, "Error: Could not allocate %zu elements.\n", n);
+            return 1;
+        }
+        for (size_t i = 0; i < n; i++) {
+            array_append(&arr, (int)(i % 1000)); // Never -1; 7 matches 0.1% of elements
+        }
+        uint64_t *bitmap = malloc(ARRAY_BITMAP_WORDS(n > 0 ? n : 1) * sizeof(uint64_t));
+        if (bitmap == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed for bitmap.\n");
+            return 1;
+        }
+
+        size_t reps = n > 0 ? (size_t)(ELEMENTS_PER_MEASUREMENT / n) : 1;
+        if (reps == 0) {
+            reps = 1;
+        }
+
+        for (int op = 0; op < OP_TOTAL; op++) {
+            double scalar_ns = 0;
+            for (int l = 0; l < 3; l++) {
+                if (levels[l] > best) {
+                    continue; // Not runnable here
+                }
+                array_simd_set_level(levels[l]);
+                run_op(op, &arr, bitmap, reps / 10 + 1); // Warm up caches and page tables
+                double ns = run_op(op, &arr, bitmap, reps);
+                if (levels[l] == ARRAY_SIMD_SCALAR) {
+                    scalar_ns = ns;
+                }
+                printf("%-10zu %-9s %-7s %14.1f %12.1f %8.2fx\n", n, op_names[op],
+                       array_simd_level_name(levels[l]), ns, (double)n / ns * 1e3, scalar_ns / ns);
+            }
+        }
+
+        free(bitmap);
+        array_destroy(&arr);
+    }
+
+    array_simd_set_level(best);
+    if (sizes != default_sizes) {
+        free(sizes);
+    }
+    return 0;
+}
@@ -0,0 +1,237 @@
+#define _POSIX_C_SOURCE 200112L // For clock_gettime and pthread barriers
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h> // For sched_yield
+#include <time.h>
+
+#include "bounded_queue.h" // SPSC and MPMC queues
+#include "linked_list.h"   // Mutex-guarded baseline
+
+// Handoff benchmark for the bounded queues, against a struct LinkedList behind a pthread
+// mutex (append at the tail, delete_first at the head).
+//   Throughput: P producers and P consumers move 'items' values each, for P = 1, 2, 4 ...
+//               up to max_threads; the SPSC queue (single and batched) runs at P = 1 only.
+//   Latency:    two threads bounce one value back and forth through a pair of queues;
+//               the figure is half a round trip.
+// Threads that find a queue full or empty call sched_yield, so the numbers stay
+// meaningful when there are fewer cores than threads.
+// Usage: ./bench_bounded_queue [max_threads] [items_per_producer]   (defaults: 4, 1,000,000)
+
+#define QUEUE_CAPACITY 1024
+#define BATCH 64 // Values per spsc_queue_push_n / spsc_queue_pop_n call
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// The queues under test, one implementation per run
+enum Impl { IMPL_SPSC, IMPL_SPSC_BATCH, IMPL_MPMC, IMPL_MUTEX };
+static const char *impl_names[] = { "spsc", "spsc/batch", "mpmc", "mutex" };
+
+struct LockedList {
+    pthread_mutex_t lock;
+    struct LinkedList list;
+};
+
+struct Shared {
+    enum Impl impl;
+    size_t items;              // Per producer
+    struct SpscQueue spsc[2];  // [1] is the return path for the latency test
+    struct MpmcQueue mpmc[2];
+    struct LockedList locked[2];
+    pthread_barrier_t start;   // Releases all threads at once
+    volatile long long sink;   // Keeps consumed values alive
+};
+
+// Helper: one push into path 'which', retrying (with a yield) until it fits
+static void put(struct Shared *s, int which, int value) {
+    for (;;) {
+        if (s->impl == IMPL_MPMC) {
+            if (mpmc_queue_push(&s->mpmc[which], value)) return;
+        } else if (s->impl == IMPL_MUTEX) {
+            struct LockedList *l = &s->locked[which];
+            pthread_mutex_lock(&l->lock);
+            bool ok = l->list.length < QUEUE_CAPACITY && linked_list_append(&l->list, value);
+            pthread_mutex_unlock(&l->lock);
+            if (ok) return;
+        } else {
+            if (spsc_queue_push(&s->spsc[which], value)) return;
+        }
+        sched_yield();
+    }
+}
+
+// Helper: one pop from path 'which', retrying (with a yield) until a value arrives
+static int take(struct Shared *s, int which) {
+    int value = 0;
+    for (;;) {
+        if (s->impl == IMPL_MPMC) {
+            if (mpmc_queue_pop(&s->mpmc[which], &value)) return value;
+        } else if (s->impl == IMPL_MUTEX) {
+            struct LockedList *l = &s->locked[which];
+            pthread_mutex_lock(&l->lock);
+            bool ok = l->list.head != NULL;
+            if (ok) {
+                value = l->list.head->data;
+                linked_list_delete_first(&l->list);
+            }
+            pthread_mutex_unlock(&l->lock);
+            if (ok) return value;
+        } else {
+            if (spsc_queue_pop(&s->spsc[which], &value)) return value;
+        }
+        sched_yield();
+    }
+}
+
+static void *producer(void *arg) {
+    struct Shared *s = arg;
+    pthread_barrier_wait(&s->start);
+    if (s->impl == IMPL_SPSC_BATCH) {
+        int batch[BATCH];
+        for (size_t i = 0; i < s->items; i += BATCH) {
+            size_t n = s->items - i < BATCH ? s->items - i : BATCH;
+            for (size_t k = 0; k < n; k++) {
+                batch[k] = (int)(i + k);
+            }
+            size_t done = 0;
+            while (done < n) {
+                size_t pushed = spsc_queue_push_n(&s->spsc[0], batch + done, n - done);
+                if (pushed == 0) sched_yield();
+                done += pushed;
+            }
+        }
+        return NULL;
+    }
+    for (size_t i = 0; i < s->items; i++) {
+        put(s, 0, (int)i);
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    struct Shared *s = arg;
+    long long sum = 0;
+    pthread_barrier_wait(&s->start);
+    if (s->impl == IMPL_SPSC_BATCH) {
+        int batch[BATCH];
+        for (size_t got = 0; got < s->items;) {
+            size_t n = spsc_queue_pop_n(&s->spsc[0], batch, BATCH);
+            if (n == 0) sched_yield();
+            for (size_t k = 0; k < n; k++) {
+                sum += batch[k];
+            }
+            got += n;
+        }
+    } else {
+        for (size_t i = 0; i < s->items; i++) {
+            sum += take(s, 0); // Each consumer takes as many as one producer makes
+        }
+    }
+    s->sink += sum;
+    return NULL;
+}
+
+// Latency: the initiator sends on path 0 and waits for the echo on path 1
+static void *pinger(void *arg) {
+    struct Shared *s = arg;
+    pthread_barrier_wait(&s->start);
+    for (size_t i = 0; i < s->items; i++) {
+        put(s, 0, (int)i);
+        s->sink += take(s, 1);
+    }
+    return NULL;
+}
+
+static void *ponger(void *arg) {
+    struct Shared *s = arg;
+    pthread_barrier_wait(&s->start);
+    for (size_t i = 0; i < s->items; i++) {
+        put(s, 1, take(s, 0));
+    }
+    return NULL;
+}
+
+static void setup(struct Shared *s, enum Impl impl) {
+    s->impl = impl;
+    for (int i = 0; i < 2; i++) {
+        spsc_queue_init(&s->spsc[i], QUEUE_CAPACITY);
+        mpmc_queue_init(&s->mpmc[i], QUEUE_CAPACITY);
+        pthread_mutex_init(&s->locked[i].lock, NULL);
+        linked_list_init(&s->locked[i].list);
+    }
+}
+
+static void teardown(struct Shared *s) {
+    for (int i = 0; i < 2; i++) {
+        spsc_queue_destroy(&s->spsc[i]);
+        mpmc_queue_destroy(&s->mpmc[i]);
+        pthread_mutex_destroy(&s->locked[i].lock);
+        linked_list_destroy(&s->locked[i].list);
+    }
+}
+
+// Runs 'pairs' threads of each worker and returns the elapsed seconds
+static double run(struct Shared *s, int pairs, void *(*first)(void *), void *(*second)(void *)) {
+    pthread_t *ids = malloc((size_t)pairs * 2 * sizeof(pthread_t));
+    if (ids == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for thread ids.\n");
+        exit(1);
+    }
+    pthread_barrier_init(&s->start, NULL, (unsigned)pairs * 2 + 1);
+    for (int t = 0; t < pairs; t++) {
+        pthread_create(&ids[2 * t], NULL, first, s);
+        pthread_create(&ids[2 * t + 1], NULL, second, s);
+    }
+    double start = now_seconds();
+    pthread_barrier_wait(&s->start);
+    for (int t = 0; t < 2 * pairs; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    double elapsed = now_seconds() - start;
+    pthread_barrier_destroy(&s->start);
+    free(ids);
+    return elapsed;
+}
+
+int main(int argc, char **argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 4;
+    static struct Shared shared; // Large and cache-line aligned; keep it off the stack
+    shared.items = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000000;
+
+    printf("Throughput (P producers + P consumers, %zu items per producer)\n", shared.items);
+    printf("%-8s %-12s %12s %12s\n", "P", "impl", "Mitems/s", "ns/item");
+    for (int pairs = 1; pairs <= max_threads; pairs *= 2) {
+        for (int impl = IMPL_SPSC; impl <= IMPL_MUTEX; impl++) {
+            if (pairs > 1 && (impl == IMPL_SPSC || impl == IMPL_SPSC_BATCH)) {
+                continue; // One producer and one consumer only
+            }
+            setup(&shared, (enum Impl)impl);
+            double seconds = run(&shared, pairs, producer, consumer);
+            teardown(&shared);
+            double items = (double)shared.items * pairs;
+            printf("%-8d %-12s %12.2f %12.1f\n", pairs, impl_names[impl], items / seconds / 1e6,
+                   seconds * 1e9 / items);
+        }
+    }
+
+    size_t rounds = shared.items / 10 > 0 ? shared.items / 10 : 1;
+    size_t saved = shared.items;
+    shared.items = rounds;
+    printf("\nLatency (ping-pong between two threads, %zu round trips)\n", rounds);
+    printf("%-12s %16s\n", "impl", "ns one-way");
+    for (int impl = IMPL_SPSC; impl <= IMPL_MUTEX; impl++) {
+        if (impl == IMPL_SPSC_BATCH) {
+            continue; // Batching does not apply to a single value in flight
+        }
+        setup(&shared, (enum Impl)impl);
+        double seconds = run(&shared, 1, pinger, ponger);
+        teardown(&shared);
+        printf("%-12s %16.1f\n", impl_names[impl], seconds * 1e9 / (2.0 * (double)rounds));
+    }
+    shared.items = saved;
+    return 0;
+}
@@ -0,0 +1,99 @@
+#define _POSIX_C_SOURCE 200112L // For clock_gettime and pthread barriers
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "stack.h"          // Mutex-guarded baseline
+#include "lockfree_stack.h" // Lock-free stack
+
+// Contention benchmark: every thread runs push/pop pairs on one shared stack.
+// Compares the lock-free stack with a struct Stack behind a pthread mutex.
+// Usage: ./bench_lockfree_stack [max_threads] [pairs_per_thread]   (defaults: 8, 1,000,000)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+struct Shared {
+    struct LockFreeStack lockfree;
+    struct Stack locked;
+    pthread_mutex_t lock;
+    size_t pairs;
+    pthread_barrier_t start; // Releases all threads at once
+};
+
+static void *lockfree_worker(void *arg) {
+    struct Shared *shared = arg;
+    int value;
+    pthread_barrier_wait(&shared->start);
+    for (size_t i = 0; i < shared->pairs; i++) {
+        lockfree_stack_push(&shared->lockfree, (int)i);
+        lockfree_stack_pop(&shared->lockfree, &value);
+    }
+    return NULL;
+}
+
+static void *locked_worker(void *arg) {
+    struct Shared *shared = arg;
+    pthread_barrier_wait(&shared->start);
+    for (size_t i = 0; i < shared->pairs; i++) {
+        pthread_mutex_lock(&shared->lock);
+        stack_push(&shared->locked, (int)i);
+        pthread_mutex_unlock(&shared->lock);
+        pthread_mutex_lock(&shared->lock);
+        if (!stack_is_empty(&shared->locked)) {
+            stack_pop(&shared->locked);
+        }
+        pthread_mutex_unlock(&shared->lock);
+    }
+    return NULL;
+}
+
+// Runs 'threads' copies of 'worker' and returns the elapsed seconds
+static double run(struct Shared *shared, int threads, void *(*worker)(void *)) {
+    pthread_t *ids = malloc((size_t)threads * sizeof(pthread_t));
+    if (ids == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for thread ids.\n");
+        exit(1);
+    }
+    pthread_barrier_init(&shared->start, NULL, (unsigned)threads + 1);
+    for (int t = 0; t < threads; t++) {
+        pthread_create(&ids[t], NULL, worker, shared);
+    }
+    double start = now_seconds();
+    pthread_barrier_wait(&shared->start);
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    double elapsed = now_seconds() - start;
+    pthread_barrier_destroy(&shared->start);
+    free(ids);
+    return elapsed;
+}
+
+int main(int argc, char **argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    struct Shared shared;
+    shared.pairs = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000000;
+
+    printf("%-8s %-10s %12s %12s\n", "threads", "impl", "Mops/s", "ns/op");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double ops = 2.0 * (double)shared.pairs * threads;
+
+        lockfree_stack_init(&shared.lockfree);
+        double seconds = run(&shared, threads, lockfree_worker);
+        lockfree_stack_destroy(&shared.lockfree);
+        printf("%-8d %-10s %12.2f %12.1f\n", threads, "lockfree", ops / seconds / 1e6, seconds * 1e9 / ops);
+
+        stack_init(&shared.locked);
+        pthread_mutex_init(&shared.lock, NULL);
+        seconds = run(&shared, threads, locked_worker);
+        pthread_mutex_destroy(&shared.lock);
+        stack_destroy(&shared.locked);
+        printf("%-8d %-10s %12.2f %12.1f\n", threads, "mutex", ops / seconds / 1e6, seconds * 1e9 / ops);
+    }
+    return 0;
+}
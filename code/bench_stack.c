@@ -0,0 +1,100 @@
+#define _POSIX_C_SOURCE 199309L // For clock_gettime
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "stack.h" // Stack container
+
+// Compares the node-based stack (stack_init) with the array-backed one (stack_init_array).
+// Usage: ./bench_stack [operations]   (default: 10,000,000 per workload)
+
+#define BATCH 64 // Elements per stack_push_n / stack_pop_n call
+
+static volatile long long sink; // Keeps results alive so the work is not optimized out
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Each workload returns the number of push/pop operations it performed
+
+// Fill to n elements, then drain
+static size_t workload_push_pop(struct Stack *s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        stack_push(s, (int)i);
+    }
+    for (size_t i = 0; i < n; i++) {
+        sink += stack_pop(s);
+    }
+    return 2 * n;
+}
+
+// Same volume through the bulk calls
+static size_t workload_bulk(struct Stack *s, size_t n) {
+    int buffer[BATCH];
+    for (int i = 0; i < BATCH; i++) {
+        buffer[i] = i;
+    }
+    for (size_t i = 0; i < n; i += BATCH) {
+        stack_push_n(s, buffer, BATCH);
+    }
+    size_t ops = 0;
+    for (size_t i = 0; i < n; i += BATCH) {
+        sink += (long long)stack_pop_n(s, buffer, BATCH);
+        ops += 2 * BATCH; // Counted per element moved
+    }
+    return ops;
+}
+
+// Expression-evaluator pattern: shallow stack, push two operands, combine them
+static size_t workload_evaluator(struct Stack *s, size_t n) {
+    stack_push(s, 1);
+    for (size_t i = 0; i < n / 3; i++) {
+        stack_push(s, (int)i);
+        int b = stack_pop(s);
+        int a = stack_pop(s);
+        stack_push(s, a + b);
+    }
+    sink += stack_pop(s);
+    return 4 * (n / 3) + 2;
+}
+
+typedef size_t (*Workload)(struct Stack *s, size_t n);
+
+int main(int argc, char **argv) {
+    size_t n = 10000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+
+    const char *names[] = { "push_pop", "bulk_64", "evaluator" };
+    Workload workloads[] = { workload_push_pop, workload_bulk, workload_evaluator };
+
+    printf("%-10s %-8s %12s %14s %9s\n", "workload", "kind", "ns/op", "Mops/s", "speedup");
+    for (int w = 0; w < 3; w++) {
+        double linked_ns = 0;
+        for (int kind = 0; kind < 2; kind++) {
+            struct Stack s;
+            if (kind == 0) {
+                stack_init(&s);
+            } else if (!stack_init_array(&s, 0)) {
+                return 1;
+            }
+
+            workloads[w](&s, n / 10); // Warm up the allocator
+            double start = now_seconds();
+            size_t ops = workloads[w](&s, n);
+            double ns = (now_seconds() - start) * 1e9 / (double)ops;
+            stack_destroy(&s);
+
+            if (kind == 0) {
+                linked_ns = ns;
+            }
+            printf("%-10s %-8s %12.2f %14.1f %8.2fx\n", names[w], kind == 0 ? "linked" : "array",
+                   ns, 1e3 / ns, linked_ns / ns);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,285 @@
+#define _POSIX_C_SOURCE 200112L // For clock_gettime and pthread barriers
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h> // For sched_yield
+#include <stdatomic.h>
+#include <time.h>
+
+#include "steal_deque.h" // Per-worker deques for the stealing scheduler
+#include "stack.h"       // Per-worker and shared task stacks for the baselines
+
+// Task scheduling on an irregular recursive workload: a randomly unbalanced tree (in the
+// style of the Unbalanced Tree Search benchmark). The root has ROOT_CHILDREN children;
+// every other node has BRANCH children with probability 1 in BRANCH_ODDS, else none. The
+// shape comes from hashing, so it is the same on every run, but subtree sizes vary
+// wildly: a few of the root's children own most of the tree and nobody knows which in
+// advance. Visiting a node costs NODE_WORK rounds of hashing.
+//
+// Schedulers (tasks are node ids; a task visits its node and spawns its children):
+//   steal   - each worker pops its own struct StealDeque and, when it runs dry, steals
+//             from a random other worker. All root children start on worker 0.
+//   static  - each worker runs its own struct Stack and never shares; the root children
+//             are dealt out round-robin up front (the current per-worker task stacks).
+//   shared  - one struct Stack behind a mutex that every worker pushes to and pops from.
+// The table shows the time, the speedup over 'steal' with one thread, how evenly the
+// nodes were spread (busiest worker / average; 1.00 is perfect) and the steals.
+// Idle workers call sched_yield, so the numbers stay meaningful with fewer cores than
+// threads.
+// Usage: ./bench_steal_deque [max_threads] [root_children]   (defaults: 8, 2000)
+
+#define BRANCH 8
+#define BRANCH_ODDS 9 // BRANCH / BRANCH_ODDS < 1, so the tree is finite (~9 nodes per root child)
+#define NODE_WORK 2000
+#define MAX_THREADS 64
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Helper: 31-bit mix of a 32-bit value, so node ids stay non-negative ints
+static int mix(unsigned int x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return (int)(x & 0x7fffffff);
+}
+
+// Helper: the node's busy work; the result feeds a checksum so it cannot be skipped
+static unsigned int visit(int node) {
+    unsigned int h = (unsigned int)node;
+    for (int i = 0; i < NODE_WORK; i++) {
+        h = (unsigned int)mix(h + (unsigned int)i);
+    }
+    return h;
+}
+
+// Helper: number of children of a non-root node
+static int child_count(int node) {
+    return (mix((unsigned int)node ^ 0x9e3779b9U) % BRANCH_ODDS == 0) ? BRANCH : 0;
+}
+
+static int child(int node, int i) {
+    return mix((unsigned int)node * BRANCH + (unsigned int)i + 1);
+}
+
+enum Sched { SCHED_STEAL, SCHED_STATIC, SCHED_SHARED };
+static const char *sched_names[] = { "steal", "static", "shared" };
+
+struct Worker {
+    _Alignas(64) struct StealDeque deque; // SCHED_STEAL
+    struct Stack stack;                   // SCHED_STATIC
+    long nodes;                           // Nodes this worker visited
+    long steals;                          // Successful steals
+    unsigned int checksum;
+    unsigned long long rng;               // Victim choice
+    int id;
+    struct Shared *shared;
+};
+
+struct Shared {
+    enum Sched sched;
+    int threads;
+    int root_children;
+    struct Worker workers[MAX_THREADS];
+    atomic_long pending;       // Tasks spawned but not yet finished (steal and shared)
+    pthread_mutex_t lock;      // Guards 'stack' for SCHED_SHARED
+    struct Stack stack;
+    pthread_barrier_t start;
+};
+
+// Helper: visits 'node' and hands its children to 'spawn'
+static void run_task(struct Worker *w, int node, void (*spawn)(struct Worker *, int)) {
+    w->checksum += visit(node);
+    w->nodes++;
+    int children = child_count(node);
+    for (int i = 0; i < children; i++) {
+        spawn(w, child(node, i));
+    }
+}
+
+// --- steal ---
+
+static void spawn_local(struct Worker *w, int node) {
+    atomic_fetch_add_explicit(&w->shared->pending, 1, memory_order_relaxed);
+    if (!steal_deque_push(&w->deque, node)) {
+        exit(1); // Out of memory; the error is already printed
+    }
+}
+
+// Helper: one sweep over the other workers starting at a random one
+static int try_steal(struct Worker *w, int *node) {
+    struct Shared *s = w->shared;
+    w->rng ^= w->rng << 13;
+    w->rng ^= w->rng >> 7;
+    w->rng ^= w->rng << 17;
+    int first = (int)(w->rng % (unsigned long long)s->threads);
+    for (int k = 0; k < s->threads; k++) {
+        int victim = (first + k) % s->threads;
+        if (victim != w->id && steal_deque_steal(&s->workers[victim].deque, node)) {
+            w->steals++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *steal_worker(void *arg) {
+    struct Worker *w = arg;
+    struct Shared *s = w->shared;
+    pthread_barrier_wait(&s->start);
+    int node;
+    for (;;) {
+        if (steal_deque_pop(&w->deque, &node) || try_steal(w, &node)) {
+            run_task(w, node, spawn_local);
+            atomic_fetch_sub_explicit(&s->pending, 1, memory_order_release);
+        } else if (atomic_load_explicit(&s->pending, memory_order_acquire) == 0) {
+            break; // Nothing queued anywhere and nothing running that could spawn more
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// --- static ---
+
+static void spawn_own_stack(struct Worker *w, int node) {
+    stack_push(&w->stack, node);
+}
+
+static void *static_worker(void *arg) {
+    struct Worker *w = arg;
+    pthread_barrier_wait(&w->shared->start);
+    while (!stack_is_empty(&w->stack)) {
+        run_task(w, stack_pop(&w->stack), spawn_own_stack);
+    }
+    return NULL;
+}
+
+// --- shared ---
+
+static void spawn_shared(struct Worker *w, int node) {
+    struct Shared *s = w->shared;
+    atomic_fetch_add_explicit(&s->pending, 1, memory_order_relaxed);
+    pthread_mutex_lock(&s->lock);
+    stack_push(&s->stack, node);
+    pthread_mutex_unlock(&s->lock);
+}
+
+static void *shared_worker(void *arg) {
+    struct Worker *w = arg;
+    struct Shared *s = w->shared;
+    pthread_barrier_wait(&s->start);
+    for (;;) {
+        pthread_mutex_lock(&s->lock);
+        int have = !stack_is_empty(&s->stack);
+        int node = have ? stack_pop(&s->stack) : 0;
+        pthread_mutex_unlock(&s->lock);
+        if (have) {
+            run_task(w, node, spawn_shared);
+            atomic_fetch_sub_explicit(&s->pending, 1, memory_order_release);
+        } else if (atomic_load_explicit(&s->pending, memory_order_acquire) == 0) {
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// Runs one scheduler on 'threads' threads; returns the elapsed seconds
+static double run(struct Shared *s, enum Sched sched, int threads) {
+    s->sched = sched;
+    s->threads = threads;
+    atomic_init(&s->pending, 0);
+    pthread_mutex_init(&s->lock, NULL);
+    stack_init_array(&s->stack, 0);
+    for (int t = 0; t < threads; t++) {
+        struct Worker *w = &s->workers[t];
+        w->nodes = w->steals = 0;
+        w->checksum = 0;
+        w->rng = 0x9E3779B97F4A7C15ull * (unsigned long long)(t + 1);
+        w->id = t;
+        w->shared = s;
+        steal_deque_init(&w->deque, 0);
+        stack_init_array(&w->stack, 0);
+    }
+
+    // Seed the root's children: all on worker 0, dealt out, or on the shared stack
+    for (int i = 0; i < s->root_children; i++) {
+        int node = child(0x2545F491, i);
+        if (sched == SCHED_STEAL) {
+            spawn_local(&s->workers[0], node);
+        } else if (sched == SCHED_STATIC) {
+            stack_push(&s->workers[i % threads].stack, node);
+        } else {
+            spawn_shared(&s->workers[0], node);
+        }
+    }
+
+    void *(*body)(void *) = (sched == SCHED_STEAL) ? steal_worker
+                          : (sched == SCHED_STATIC) ? static_worker : shared_worker;
+    pthread_t ids[MAX_THREADS];
+    pthread_barrier_init(&s->start, NULL, (unsigned)threads + 1);
+    for (int t = 0; t < threads; t++) {
+        pthread_create(&ids[t], NULL, body, &s->workers[t]);
+    }
+    double start = now_seconds();
+    pthread_barrier_wait(&s->start);
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    double elapsed = now_seconds() - start;
+
+    pthread_barrier_destroy(&s->start);
+    for (int t = 0; t < threads; t++) {
+        steal_deque_destroy(&s->workers[t].deque);
+        stack_destroy(&s->workers[t].stack);
+    }
+    stack_destroy(&s->stack);
+    pthread_mutex_destroy(&s->lock);
+    return elapsed;
+}
+
+int main(int argc, char **argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    max_threads = max_threads < 1 ? 1 : (max_threads > MAX_THREADS ? MAX_THREADS : max_threads);
+    static struct Shared shared; // Large and cache-line aligned; keep it off the stack
+    shared.root_children = argc > 2 ? atoi(argv[2]) : 2000;
+
+    printf("Unbalanced tree: %d root children, %d-way branching with odds 1/%d, %d hash rounds per node\n",
+           shared.root_children, BRANCH, BRANCH_ODDS, NODE_WORK);
+    printf("%-8s %-8s %10s %9s %10s %10s %10s\n", "threads", "sched", "ms", "speedup", "nodes",
+           "imbalance", "steals");
+    double baseline = 0;
+    long expected_nodes = -1;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        for (int sched = SCHED_STEAL; sched <= SCHED_SHARED; sched++) {
+            double seconds = run(&shared, (enum Sched)sched, threads);
+            long nodes = 0, busiest = 0, steals = 0;
+            for (int t = 0; t < threads; t++) {
+                struct Worker *w = &shared.workers[t];
+                nodes += w->nodes;
+                steals += w->steals;
+                busiest = w->nodes > busiest ? w->nodes : busiest;
+            }
+            if (expected_nodes < 0) {
+                expected_nodes = nodes;
+                baseline = seconds;
+            } else if (nodes != expected_nodes) {
+                fprintf(stderr, "Error: %s visited %ld nodes, expected %ld.\n", sched_names[sched], nodes,
+                        expected_nodes);
+                return 1;
+            }
+            printf("%-8d %-8s %10.2f %8.2fx %10ld %10.2f %10ld\n", threads, sched_names[sched],
+                   seconds * 1e3, baseline / seconds, nodes, (double)busiest * threads / (double)nodes,
+                   steals);
+        }
+    }
+    return 0;
+}
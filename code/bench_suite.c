@@ -0,0 +1,1387 @@
+#define _POSIX_C_SOURCE 200112L // For clock_gettime, dup, dup2
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>  // For open
+#include <unistd.h> // For dup, dup2, close
+
+#include "bench.h"       // Harness
+#include "array.h"       // Array container
+#include "array_index.h" // Hash index over an Array (compared against array_find scans)
+#include "linked_list.h" // Linked list container
+#include "stack.h"       // Stack container
+#include "deque.h"       // Ring-buffer deque (compared against Array used as a queue)
+#include "skip_list.h"   // Ordered skip list (compared against linked list scans)
+
+// Microbenchmarks for every public function in array.h, linked_list.h and stack.h, plus
+// the ring-buffer deque against an Array used as a queue.
+// Usage: ./bench_suite [options]
+//   --sizes=N[,N...]       Elements in the structure before each run (default 1000,100000)
+//   --ops=N                Operations per repetition for O(1)/O(log n) functions (default 1000)
+//   --reps=N --warmup=N    Measured / unmeasured repetitions (default 25 / 3)
+//   --pattern=seq|random|all  Position/key order for indexed and search functions (default all)
+//   --format=text|csv|json --output=FILE --filter=SUBSTRING --seed=N
+//
+// Functions that walk the whole structure (list_find, array_sum, ...) run fewer calls per
+// repetition so one repetition touches about LINEAR_BUDGET elements. The 'ops' column
+// always says how many calls were timed, so ns/op is per call.
+
+#define LINEAR_BUDGET (1u << 20) // Elements visited per repetition by O(n) functions
+#define BULK 16                  // Elements per bulk call (append_n, insert_range, push_n, ...)
+
+static volatile long long sink; // Keeps results alive so the work is not optimized out
+
+// Everything a case can work on. Setup functions fill in one structure, teardown frees it.
+struct SuiteCtx {
+    size_t size;        // Elements loaded by setup
+    size_t ops;         // Calls per repetition for cheap functions
+    size_t linear_ops;  // Calls per repetition for O(n) functions
+    const int *values;  // size values in load order (a shuffled permutation of 0..size-1)
+    const int *sorted;  // 0..size-1
+    const int *index;   // ops positions in [0, size), sequential or random
+    const int *keys;    // ops values that are present (values[index[i]])
+    int *scratch;       // ops ints of output space
+    uint64_t *bitmap;   // ARRAY_BITMAP_WORDS(size) words
+    Array arr;
+    ArrayEytzinger ey;
+    ArrayIndex array_index;
+    struct Node *head;
+    struct NodePool pool;
+    struct LinkedList list;
+    struct Stack stack;
+    Deque deque;
+    struct SkipList skip;
+};
+
+// One row of the suite. Cases that do not use positions or keys run once per size.
+struct SuiteCase {
+    BenchCase bench;
+    int patterned;
+};
+
+
+// --- Helpers ---
+
+static int saved_stdout = -1;
+
+// Helper: points stdout at /dev/null so the print functions can be timed
+static void stdout_silence(void) {
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, STDOUT_FILENO);
+        close(null_fd);
+    }
+}
+
+// Helper: undoes stdout_silence
+static void stdout_restore(void) {
+    fflush(stdout);
+    if (saved_stdout >= 0) {
+        dup2(saved_stdout, STDOUT_FILENO);
+        close(saved_stdout);
+        saved_stdout = -1;
+    }
+}
+
+// Helper: xorshift64* generator, deterministic for a given seed
+static unsigned long long rng_state = 0x9E3779B97F4A7C15ull;
+static unsigned long long rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+// Helper: clamps a stored position to the current length of a shrinking structure
+static int position_in(const struct SuiteCtx *c, size_t i, size_t length) {
+    return length > 0 ? (int)((size_t)c->index[i] % length) : 0;
+}
+
+
+// --- Setup / Teardown ---
+
+static void setup_array(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    array_init(&c->arr);
+    array_reserve(&c->arr, c->size);
+    array_append_n(&c->arr, c->values, c->size);
+}
+
+// Leaves spare capacity so array_shrink_to_fit has something to do
+static void setup_array_slack(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    setup_array(c);
+    array_reserve(&c->arr, 2 * c->size + ARRAY_INITIAL_CAPACITY);
+}
+
+static void setup_array_sorted(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    array_init(&c->arr);
+    array_append_n(&c->arr, c->sorted, c->size);
+    array_sort(&c->arr); // Already in order; turns on sorted mode
+}
+
+static void teardown_array(void *ctx) {
+    array_destroy(&((struct SuiteCtx *)ctx)->arr);
+}
+
+static void setup_eytzinger(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    setup_array_sorted(c);
+    array_eytzinger_build(&c->ey, &c->arr);
+}
+
+static void teardown_eytzinger(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    array_eytzinger_destroy(&c->ey);
+    array_destroy(&c->arr);
+}
+
+static void setup_array_index(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    setup_array(c);
+    array_index_build(&c->array_index, &c->arr);
+}
+
+static void teardown_array_index(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    array_index_destroy(&c->array_index);
+    array_destroy(&c->arr);
+}
+
+static void setup_list(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    list_init(&c->head);
+    for (size_t i = c->size; i > 0; i--) {
+        list_prepend(&c->head, c->values[i - 1]);
+    }
+}
+
+static void teardown_list(void *ctx) {
+    list_destroy(&((struct SuiteCtx *)ctx)->head);
+}
+
+static void setup_pool_list(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    list_pool_init(&c->pool, 0);
+    list_init(&c->head);
+    for (size_t i = c->size; i > 0; i--) {
+        list_pool_prepend(&c->pool, &c->head, c->values[i - 1]);
+    }
+}
+
+static void teardown_pool_list(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    list_pool_destroy(&c->pool, &c->head);
+    node_pool_destroy(&c->pool);
+}
+
+static void setup_handle(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    linked_list_init(&c->list);
+    for (size_t i = 0; i < c->size; i++) {
+        linked_list_append(&c->list, c->values[i]);
+    }
+}
+
+static void teardown_handle(void *ctx) {
+    linked_list_destroy(&((struct SuiteCtx *)ctx)->list);
+}
+
+static void setup_stack_linked(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    stack_init(&c->stack);
+    stack_push_n(&c->stack, c->values, c->size);
+}
+
+static void setup_stack_array(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    stack_init_array(&c->stack, 0);
+    stack_push_n(&c->stack, c->values, c->size);
+}
+
+static void teardown_stack(void *ctx) {
+    stack_destroy(&((struct SuiteCtx *)ctx)->stack);
+}
+
+static void setup_deque(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    deque_init(&c->deque, c->size);
+    deque_push_back_n(&c->deque, c->values, c->size);
+}
+
+static void teardown_deque(void *ctx) {
+    deque_destroy(&((struct SuiteCtx *)ctx)->deque);
+}
+
+static void setup_skip(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    skip_list_init(&c->skip);
+    for (size_t i = 0; i < c->size; i++) {
+        skip_list_insert(&c->skip, c->values[i]);
+    }
+}
+
+static void teardown_skip(void *ctx) {
+    skip_list_destroy(&((struct SuiteCtx *)ctx)->skip);
+}
+
+
+// --- Array ---
+
+static size_t run_array_init(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        Array a;
+        array_init(&a);
+        sink += (long long)a.capacity;
+        array_destroy(&a);
+    }
+    return c->ops;
+}
+
+static size_t run_array_init_with_policy(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    ArrayGrowthPolicy policy = { ARRAY_GROWTH_ONE_HALF, 0, NULL, NULL };
+    for (size_t i = 0; i < c->ops; i++) {
+        Array a;
+        array_init_with_policy(&a, &policy);
+        sink += (long long)a.capacity;
+        array_destroy(&a);
+    }
+    return c->ops;
+}
+
+static size_t run_array_init_inline(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        Array a;
+        array_init_inline(&a);
+        sink += (long long)a.capacity;
+        array_destroy(&a);
+    }
+    return c->ops;
+}
+
+// A typical tiny array: build five elements, read them back, drop it
+static size_t run_array_tiny(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        Array a;
+        array_init(&a);
+        for (int k = 0; k < 5; k++) {
+            array_append(&a, c->values[(i + (size_t)k) % c->size]);
+        }
+        sink += array_get(&a, 1) + array_get(&a, 5);
+        array_destroy(&a);
+    }
+    return c->ops;
+}
+
+static size_t run_array_tiny_inline(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        Array a;
+        array_init_inline(&a);
+        for (int k = 0; k < 5; k++) {
+            array_append(&a, c->values[(i + (size_t)k) % c->size]);
+        }
+        sink += array_get(&a, 1) + array_get(&a, 5);
+        array_destroy(&a);
+    }
+    return c->ops;
+}
+
+static size_t run_array_append(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        array_append(&c->arr, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_array_print(void *ctx) {
+    stdout_silence();
+    array_print(&((struct SuiteCtx *)ctx)->arr);
+    stdout_restore();
+    return 1;
+}
+
+// Text past the end of this buffer is still rendered (and counted), just not kept
+static char format_buffer[1 << 16];
+
+static size_t run_array_format(void *ctx) {
+    array_format(&((struct SuiteCtx *)ctx)->arr, format_buffer, sizeof(format_buffer), NULL);
+    return 1;
+}
+
+static size_t run_array_delete_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        array_delete_at(&c->arr, position_in(c, i, c->arr.count) + 1); // 1-based
+    }
+    return n;
+}
+
+static size_t run_array_destroy(void *ctx) {
+    array_destroy(&((struct SuiteCtx *)ctx)->arr);
+    return 1;
+}
+
+static size_t run_array_find(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += array_find(&c->arr, c->keys[i % c->ops]);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_find_sorted(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_find(&c->arr, c->keys[i]);
+    }
+    return c->ops;
+}
+
+static size_t run_array_count(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += (long long)array_count(&c->arr, (int)i);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_min(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += array_min(&c->arr);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_max(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += array_max(&c->arr);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_sum(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += array_sum(&c->arr);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_find_all(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += (long long)array_find_all(&c->arr, (int)i, c->bitmap);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_get(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_get(&c->arr, c->index[i] + 1); // 1-based
+    }
+    return c->ops;
+}
+
+static size_t run_array_size(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += (long long)array_size(&c->arr);
+    }
+    return c->ops;
+}
+
+static size_t run_array_capacity(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += (long long)array_capacity(&c->arr);
+    }
+    return c->ops;
+}
+
+static size_t run_array_is_empty(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_is_empty(&c->arr);
+    }
+    return c->ops;
+}
+
+// First call grows the buffer, the rest take the already-big-enough path
+static size_t run_array_reserve(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_reserve(&c->arr, c->size + c->ops - i);
+    }
+    return c->ops;
+}
+
+static size_t run_array_shrink_to_fit(void *ctx) {
+    sink += array_shrink_to_fit(&((struct SuiteCtx *)ctx)->arr);
+    return 1;
+}
+
+static size_t run_array_append_n(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t calls = c->ops / BULK + 1;
+    for (size_t i = 0; i < calls; i++) {
+        array_append_n(&c->arr, c->sorted, c->size < BULK ? c->size : BULK);
+    }
+    return calls;
+}
+
+static size_t run_array_insert_range(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->size < BULK ? c->size : BULK;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        array_insert_range(&c->arr, (size_t)position_in(c, i % c->ops, c->arr.count) + 1, c->sorted, n);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_array_delete_range(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t calls = c->size / BULK;
+    if (calls > c->linear_ops) {
+        calls = c->linear_ops;
+    }
+    for (size_t i = 0; i < calls; i++) {
+        size_t room = c->arr.count - BULK + 1; // Valid 1-based starts
+        array_delete_range(&c->arr, (size_t)position_in(c, i % c->ops, room) + 1, BULK);
+    }
+    return calls;
+}
+
+static size_t run_array_sort(void *ctx) {
+    sink += array_sort(&((struct SuiteCtx *)ctx)->arr);
+    return 1;
+}
+
+static size_t run_array_is_sorted(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_is_sorted(&c->arr);
+    }
+    return c->ops;
+}
+
+static size_t run_array_lower_bound(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_lower_bound(&c->arr, c->keys[i]);
+    }
+    return c->ops;
+}
+
+static size_t run_array_upper_bound(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_upper_bound(&c->arr, c->keys[i]);
+    }
+    return c->ops;
+}
+
+static size_t run_array_find_many(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    array_find_many(&c->arr, c->keys, c->ops, c->scratch);
+    sink += c->scratch[c->ops - 1];
+    return c->ops; // Counted per key
+}
+
+static size_t run_array_eytzinger_build(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    ArrayEytzinger ey;
+    sink += array_eytzinger_build(&ey, &c->arr);
+    array_eytzinger_destroy(&ey);
+    return 1;
+}
+
+static size_t run_array_eytzinger_lower_bound(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_eytzinger_lower_bound(&c->ey, c->keys[i]);
+    }
+    return c->ops;
+}
+
+static size_t run_array_eytzinger_find(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_eytzinger_find(&c->ey, c->keys[i]);
+    }
+    return c->ops;
+}
+
+
+// --- Linked list (bare head pointer, optionally pooled) ---
+
+static size_t run_list_init(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        struct Node *head;
+        list_init(&head);
+        sink += (head == NULL);
+    }
+    return c->ops;
+}
+
+static size_t run_list_prepend(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        list_prepend(&c->head, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_list_append(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        list_append(&c->head, (int)i);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_list_insert_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        list_insert_at(&c->head, (int)i, c->index[i % c->ops]);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_list_delete_first(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->ops < c->size ? c->ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        list_delete_first(&c->head);
+    }
+    return n;
+}
+
+static size_t run_list_delete_last(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        list_delete_last(&c->head);
+    }
+    return n;
+}
+
+static size_t run_list_delete_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        list_delete_at(&c->head, position_in(c, i % c->ops, c->size - i));
+    }
+    return n;
+}
+
+static size_t run_list_print(void *ctx) {
+    stdout_silence();
+    list_print(((struct SuiteCtx *)ctx)->head);
+    stdout_restore();
+    return 1;
+}
+
+static size_t run_list_format(void *ctx) {
+    list_format(((struct SuiteCtx *)ctx)->head, format_buffer, sizeof(format_buffer), NULL);
+    return 1;
+}
+
+static size_t run_list_find(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += (list_find(c->head, c->keys[i % c->ops]) != NULL);
+    }
+    return c->linear_ops;
+}
+
+// Writes back the value already there, so the list stays as setup built it
+static size_t run_list_set_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        size_t k = i % c->ops;
+        sink += list_set_at(c->head, c->index[k], c->keys[k]);
+    }
+    return c->linear_ops;
+}
+
+// The same writes done in one cursor pass: O(1) per element instead of a walk per call
+static size_t run_list_cursor_set(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    struct ListCursor cursor;
+    for (list_cursor_init(&cursor, &c->head); list_cursor_valid(&cursor); list_cursor_next(&cursor)) {
+        sink += list_cursor_set(&cursor, list_cursor_get(&cursor));
+    }
+    return c->size;
+}
+
+static size_t run_list_length(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += list_length(c->head);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_list_reverse(void *ctx) {
+    list_reverse(&((struct SuiteCtx *)ctx)->head);
+    return 1;
+}
+
+static size_t run_list_destroy(void *ctx) {
+    list_destroy(&((struct SuiteCtx *)ctx)->head);
+    return 1;
+}
+
+static size_t run_list_pool_init(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        struct NodePool pool;
+        sink += list_pool_init(&pool, 0);
+        node_pool_destroy(&pool);
+    }
+    return c->ops;
+}
+
+static size_t run_list_pool_prepend(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        list_pool_prepend(&c->pool, &c->head, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_list_pool_append(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        list_pool_append(&c->pool, &c->head, (int)i);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_list_pool_insert_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        list_pool_insert_at(&c->pool, &c->head, (int)i, c->index[i % c->ops]);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_list_pool_delete_first(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->ops < c->size ? c->ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        list_pool_delete_first(&c->pool, &c->head);
+    }
+    return n;
+}
+
+static size_t run_list_pool_delete_last(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        list_pool_delete_last(&c->pool, &c->head);
+    }
+    return n;
+}
+
+static size_t run_list_pool_delete_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        list_pool_delete_at(&c->pool, &c->head, position_in(c, i % c->ops, c->size - i));
+    }
+    return n;
+}
+
+static size_t run_list_pool_destroy(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    list_pool_destroy(&c->pool, &c->head);
+    return 1;
+}
+
+
+// --- Linked list handle ---
+
+static size_t run_linked_list_init(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        struct LinkedList list;
+        linked_list_init(&list);
+        sink += list.length;
+    }
+    return c->ops;
+}
+
+static size_t run_linked_list_init_pooled(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        struct LinkedList list;
+        linked_list_init_pooled(&list, &c->pool);
+        sink += list.length;
+    }
+    return c->ops;
+}
+
+static size_t run_linked_list_prepend(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        linked_list_prepend(&c->list, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_linked_list_append(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        linked_list_append(&c->list, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_linked_list_insert_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        linked_list_insert_at(&c->list, (int)i, c->index[i % c->ops]);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_linked_list_delete_first(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->ops < c->size ? c->ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        linked_list_delete_first(&c->list);
+    }
+    return n;
+}
+
+static size_t run_linked_list_delete_last(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        linked_list_delete_last(&c->list);
+    }
+    return n;
+}
+
+static size_t run_linked_list_delete_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->linear_ops < c->size ? c->linear_ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        linked_list_delete_at(&c->list, position_in(c, i % c->ops, (size_t)c->list.length));
+    }
+    return n;
+}
+
+static size_t run_linked_list_find(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        sink += (linked_list_find(&c->list, c->keys[i % c->ops]) != NULL);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_linked_list_set_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        size_t k = i % c->ops;
+        sink += linked_list_set_at(&c->list, c->index[k], c->keys[k]);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_linked_list_length(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += linked_list_length(&c->list);
+    }
+    return c->ops;
+}
+
+static size_t run_linked_list_is_empty(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += linked_list_is_empty(&c->list);
+    }
+    return c->ops;
+}
+
+static size_t run_linked_list_reverse(void *ctx) {
+    linked_list_reverse(&((struct SuiteCtx *)ctx)->list);
+    return 1;
+}
+
+static size_t run_linked_list_print(void *ctx) {
+    stdout_silence();
+    linked_list_print(&((struct SuiteCtx *)ctx)->list);
+    stdout_restore();
+    return 1;
+}
+
+static size_t run_linked_list_destroy(void *ctx) {
+    linked_list_destroy(&((struct SuiteCtx *)ctx)->list);
+    return 1;
+}
+
+// One call sorts the whole list by relinking
+static size_t run_list_sort(void *ctx) {
+    list_sort(&((struct SuiteCtx *)ctx)->head);
+    return 1;
+}
+
+// The copy-out approach list_sort replaces: values into an Array, sort, rebuild the nodes
+static size_t run_list_sort_via_array(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    Array values;
+    array_init(&values);
+    for (struct Node *n = c->head; n != NULL; n = n->next) {
+        array_append(&values, n->data);
+    }
+    array_sort(&values);
+    list_destroy(&c->head);
+    for (size_t i = values.count; i > 0; i--) {
+        list_prepend(&c->head, values.data[i - 1]);
+    }
+    array_destroy(&values);
+    return 1;
+}
+
+// Cut at a position and glue the halves back the other way round (a rotation)
+static size_t run_linked_list_split_concat(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    struct LinkedList rest;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        linked_list_init(&rest);
+        linked_list_split_at(&c->list, c->index[i % c->ops], &rest);
+        linked_list_concat(&rest, &c->list);
+        c->list = rest;
+    }
+    return c->linear_ops;
+}
+
+
+// --- Stack (the same runs cover linked and array stacks, setup picks the kind) ---
+
+static size_t run_stack_init(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        struct Stack s;
+        stack_init(&s);
+        stack_push(&s, (int)i); // One element so destroy has a node to free
+        stack_destroy(&s);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_init_array(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        struct Stack s;
+        stack_init_array(&s, 0);
+        stack_push(&s, (int)i);
+        stack_destroy(&s);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_push(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        stack_push(&c->stack, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_pop(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->ops < c->size ? c->ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        sink += stack_pop(&c->stack);
+    }
+    return n;
+}
+
+static size_t run_stack_peek(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += stack_peek(&c->stack);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_is_empty(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += stack_is_empty(&c->stack);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_size(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += (long long)stack_size(&c->stack);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_reserve(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += stack_reserve(&c->stack, c->size + c->ops - i);
+    }
+    return c->ops;
+}
+
+static size_t run_stack_push_n(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t calls = c->ops / BULK + 1;
+    for (size_t i = 0; i < calls; i++) {
+        stack_push_n(&c->stack, c->sorted, c->size < BULK ? c->size : BULK);
+    }
+    return calls;
+}
+
+static size_t run_stack_pop_n(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t calls = 0;
+    while (calls < c->ops && stack_pop_n(&c->stack, c->scratch, BULK) > 0) {
+        calls++;
+    }
+    return calls;
+}
+
+static size_t run_stack_destroy(void *ctx) {
+    stack_destroy(&((struct SuiteCtx *)ctx)->stack);
+    return 1;
+}
+
+
+// --- Queue: Array used as a FIFO vs the ring-buffer deque ---
+
+// One enqueue + one dequeue per call; array_delete_at(arr, 1) shifts the whole array
+static size_t run_queue_array(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        array_append(&c->arr, (int)i);
+        sink += array_get(&c->arr, 1);
+        array_delete_at(&c->arr, 1);
+    }
+    return c->linear_ops;
+}
+
+static size_t run_queue_deque(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        deque_push_back(&c->deque, (int)i);
+        sink += deque_pop_front(&c->deque);
+    }
+    return c->ops;
+}
+
+static size_t run_queue_deque_bulk(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t calls = c->ops / BULK + 1;
+    for (size_t i = 0; i < calls; i++) {
+        deque_push_back_n(&c->deque, c->sorted, c->size < BULK ? c->size : BULK);
+        sink += (long long)deque_pop_front_n(&c->deque, c->scratch, BULK);
+    }
+    return calls;
+}
+
+static size_t run_deque_push_front(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        deque_push_front(&c->deque, (int)i);
+    }
+    return c->ops;
+}
+
+static size_t run_deque_pop_back(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->ops < c->size ? c->ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        sink += deque_pop_back(&c->deque);
+    }
+    return n;
+}
+
+static size_t run_deque_get(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += deque_get(&c->deque, (size_t)c->index[i] + 1); // 1-based
+    }
+    return c->ops;
+}
+
+
+// --- Dedup: array_find scans vs the hash index ---
+
+// Every other value is new, so half the calls append
+static size_t run_dedup_array(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->linear_ops; i++) {
+        int value = (i & 1) ? c->keys[i % c->ops] : (int)(c->size + i);
+        if (array_find(&c->arr, value) == -1) {
+            array_append(&c->arr, value);
+        }
+    }
+    return c->linear_ops;
+}
+
+static size_t run_dedup_index(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        int value = (i & 1) ? c->keys[i] : (int)(c->size + i);
+        if (array_index_find(&c->array_index, value) == -1) {
+            array_index_append(&c->array_index, value);
+        }
+    }
+    return c->ops;
+}
+
+static size_t run_array_index_build(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    ArrayIndex index;
+    array_index_build(&index, &c->arr);
+    sink += (long long)array_index_size(&index);
+    array_index_destroy(&index);
+    return 1;
+}
+
+static size_t run_array_index_find(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += array_index_find(&c->array_index, c->keys[i]);
+    }
+    return c->ops;
+}
+
+
+// --- Skip list ---
+
+static size_t run_skip_list_insert(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        skip_list_insert(&c->skip, c->keys[i]);
+    }
+    return c->ops;
+}
+
+static size_t run_skip_list_find(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += skip_list_find(&c->skip, c->keys[i]) != NULL;
+    }
+    return c->ops;
+}
+
+static size_t run_skip_list_get_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    for (size_t i = 0; i < c->ops; i++) {
+        sink += skip_list_get_at(&c->skip, c->index[i]);
+    }
+    return c->ops;
+}
+
+static size_t run_skip_list_delete_at(void *ctx) {
+    struct SuiteCtx *c = ctx;
+    size_t n = c->ops < c->size ? c->ops : c->size;
+    for (size_t i = 0; i < n; i++) {
+        skip_list_delete_at(&c->skip, position_in(c, i, c->size - i));
+    }
+    return n;
+}
+
+
+// --- Case table ---
+
+#define CASE(name, kind, mutates, setup, run, teardown, patterned) \
+    { { name, kind, mutates, setup, run, teardown }, patterned }
+
+static const struct SuiteCase cases[] = {
+    CASE("array_init+array_destroy", "array", 0, NULL, run_array_init, NULL, 0),
+    CASE("array_init_with_policy+array_destroy", "array", 0, NULL, run_array_init_with_policy, NULL, 0),
+    CASE("array_init_inline+array_destroy", "array", 0, NULL, run_array_init_inline, NULL, 0),
+    CASE("tiny array (init, 5 appends, destroy)", "array", 0, NULL, run_array_tiny, NULL, 0),
+    CASE("tiny array/inline", "array", 0, NULL, run_array_tiny_inline, NULL, 0),
+    CASE("array_append", "array", 1, setup_array, run_array_append, teardown_array, 0),
+    CASE("array_print", "array", 0, setup_array, run_array_print, teardown_array, 0),
+    CASE("array_format", "array", 0, setup_array, run_array_format, teardown_array, 0),
+    CASE("array_delete_at", "array", 1, setup_array, run_array_delete_at, teardown_array, 1),
+    CASE("array_destroy", "array", 1, setup_array, run_array_destroy, NULL, 0),
+    CASE("array_find", "array", 0, setup_array, run_array_find, teardown_array, 1),
+    CASE("array_find/sorted", "array", 0, setup_array_sorted, run_array_find_sorted, teardown_array, 1),
+    CASE("array_count", "array", 0, setup_array, run_array_count, teardown_array, 0),
+    CASE("array_min", "array", 0, setup_array, run_array_min, teardown_array, 0),
+    CASE("array_max", "array", 0, setup_array, run_array_max, teardown_array, 0),
+    CASE("array_sum", "array", 0, setup_array, run_array_sum, teardown_array, 0),
+    CASE("array_find_all", "array", 0, setup_array, run_array_find_all, teardown_array, 0),
+    CASE("array_get", "array", 0, setup_array, run_array_get, teardown_array, 1),
+    CASE("array_size", "array", 0, setup_array, run_array_size, teardown_array, 0),
+    CASE("array_capacity", "array", 0, setup_array, run_array_capacity, teardown_array, 0),
+    CASE("array_is_empty", "array", 0, setup_array, run_array_is_empty, teardown_array, 0),
+    CASE("array_reserve", "array", 1, setup_array, run_array_reserve, teardown_array, 0),
+    CASE("array_shrink_to_fit", "array", 1, setup_array_slack, run_array_shrink_to_fit, teardown_array, 0),
+    CASE("array_append_n", "array", 1, setup_array, run_array_append_n, teardown_array, 0),
+    CASE("array_insert_range", "array", 1, setup_array, run_array_insert_range, teardown_array, 1),
+    CASE("array_delete_range", "array", 1, setup_array, run_array_delete_range, teardown_array, 1),
+    CASE("array_sort", "array", 1, setup_array, run_array_sort, teardown_array, 0),
+    CASE("array_is_sorted", "array", 0, setup_array_sorted, run_array_is_sorted, teardown_array, 0),
+    CASE("array_lower_bound", "array", 0, setup_array_sorted, run_array_lower_bound, teardown_array, 1),
+    CASE("array_upper_bound", "array", 0, setup_array_sorted, run_array_upper_bound, teardown_array, 1),
+    CASE("array_find_many", "array", 0, setup_array_sorted, run_array_find_many, teardown_array, 1),
+    CASE("array_eytzinger_build+destroy", "array", 0, setup_array_sorted, run_array_eytzinger_build,
+         teardown_array, 0),
+    CASE("array_eytzinger_lower_bound", "array", 0, setup_eytzinger, run_array_eytzinger_lower_bound,
+         teardown_eytzinger, 1),
+    CASE("array_eytzinger_find", "array", 0, setup_eytzinger, run_array_eytzinger_find, teardown_eytzinger, 1),
+
+    CASE("list_init", "list", 0, NULL, run_list_init, NULL, 0),
+    CASE("list_prepend", "list", 1, setup_list, run_list_prepend, teardown_list, 0),
+    CASE("list_append", "list", 1, setup_list, run_list_append, teardown_list, 0),
+    CASE("list_insert_at", "list", 1, setup_list, run_list_insert_at, teardown_list, 1),
+    CASE("list_delete_first", "list", 1, setup_list, run_list_delete_first, teardown_list, 0),
+    CASE("list_delete_last", "list", 1, setup_list, run_list_delete_last, teardown_list, 0),
+    CASE("list_delete_at", "list", 1, setup_list, run_list_delete_at, teardown_list, 1),
+    CASE("list_print", "list", 0, setup_list, run_list_print, teardown_list, 0),
+    CASE("list_format", "list", 0, setup_list, run_list_format, teardown_list, 0),
+    CASE("list_find", "list", 0, setup_list, run_list_find, teardown_list, 1),
+    CASE("list_set_at", "list", 0, setup_list, run_list_set_at, teardown_list, 1),
+    CASE("list_cursor_set (full pass)", "list", 0, setup_list, run_list_cursor_set, teardown_list, 0),
+    CASE("list_length", "list", 0, setup_list, run_list_length, teardown_list, 0),
+    CASE("list_reverse", "list", 0, setup_list, run_list_reverse, teardown_list, 0),
+    CASE("list_destroy", "list", 1, setup_list, run_list_destroy, NULL, 0),
+    CASE("list_pool_init", "list", 0, NULL, run_list_pool_init, NULL, 0),
+    CASE("list_pool_prepend", "list", 1, setup_pool_list, run_list_pool_prepend, teardown_pool_list, 0),
+    CASE("list_pool_append", "list", 1, setup_pool_list, run_list_pool_append, teardown_pool_list, 0),
+    CASE("list_pool_insert_at", "list", 1, setup_pool_list, run_list_pool_insert_at, teardown_pool_list, 1),
+    CASE("list_pool_delete_first", "list", 1, setup_pool_list, run_list_pool_delete_first, teardown_pool_list, 0),
+    CASE("list_pool_delete_last", "list", 1, setup_pool_list, run_list_pool_delete_last, teardown_pool_list, 0),
+    CASE("list_pool_delete_at", "list", 1, setup_pool_list, run_list_pool_delete_at, teardown_pool_list, 1),
+    CASE("list_pool_destroy", "list", 1, setup_pool_list, run_list_pool_destroy, teardown_pool_list, 0),
+    CASE("linked_list_init", "list", 0, NULL, run_linked_list_init, NULL, 0),
+    CASE("linked_list_init_pooled", "list", 0, NULL, run_linked_list_init_pooled, NULL, 0),
+    CASE("linked_list_prepend", "list", 1, setup_handle, run_linked_list_prepend, teardown_handle, 0),
+    CASE("linked_list_append", "list", 1, setup_handle, run_linked_list_append, teardown_handle, 0),
+    CASE("linked_list_insert_at", "list", 1, setup_handle, run_linked_list_insert_at, teardown_handle, 1),
+    CASE("linked_list_delete_first", "list", 1, setup_handle, run_linked_list_delete_first, teardown_handle, 0),
+    CASE("linked_list_delete_last", "list", 1, setup_handle, run_linked_list_delete_last, teardown_handle, 0),
+    CASE("linked_list_delete_at", "list", 1, setup_handle, run_linked_list_delete_at, teardown_handle, 1),
+    CASE("linked_list_find", "list", 0, setup_handle, run_linked_list_find, teardown_handle, 1),
+    CASE("linked_list_set_at", "list", 0, setup_handle, run_linked_list_set_at, teardown_handle, 1),
+    CASE("linked_list_length", "list", 0, setup_handle, run_linked_list_length, teardown_handle, 0),
+    CASE("linked_list_is_empty", "list", 0, setup_handle, run_linked_list_is_empty, teardown_handle, 0),
+    CASE("linked_list_reverse", "list", 0, setup_handle, run_linked_list_reverse, teardown_handle, 0),
+    CASE("linked_list_print", "list", 0, setup_handle, run_linked_list_print, teardown_handle, 0),
+    CASE("linked_list_destroy", "list", 1, setup_handle, run_linked_list_destroy, NULL, 0),
+    CASE("list_sort", "list", 1, setup_list, run_list_sort, teardown_list, 0),
+    CASE("list_sort/copy+array_sort+rebuild", "list", 1, setup_list, run_list_sort_via_array, teardown_list, 0),
+    CASE("linked_list_split_at+concat", "list", 0, setup_handle, run_linked_list_split_concat, teardown_handle, 1),
+
+    CASE("stack_init+stack_destroy", "stack", 0, NULL, run_stack_init, NULL, 0),
+    CASE("stack_init_array+stack_destroy", "stack", 0, NULL, run_stack_init_array, NULL, 0),
+    CASE("stack_push/linked", "stack", 1, setup_stack_linked, run_stack_push, teardown_stack, 0),
+    CASE("stack_push/array", "stack", 1, setup_stack_array, run_stack_push, teardown_stack, 0),
+    CASE("stack_pop/linked", "stack", 1, setup_stack_linked, run_stack_pop, teardown_stack, 0),
+    CASE("stack_pop/array", "stack", 1, setup_stack_array, run_stack_pop, teardown_stack, 0),
+    CASE("stack_peek/linked", "stack", 0, setup_stack_linked, run_stack_peek, teardown_stack, 0),
+    CASE("stack_peek/array", "stack", 0, setup_stack_array, run_stack_peek, teardown_stack, 0),
+    CASE("stack_is_empty", "stack", 0, setup_stack_array, run_stack_is_empty, teardown_stack, 0),
+    CASE("stack_size", "stack", 0, setup_stack_array, run_stack_size, teardown_stack, 0),
+    CASE("stack_reserve/array", "stack", 1, setup_stack_array, run_stack_reserve, teardown_stack, 0),
+    CASE("stack_push_n/linked", "stack", 1, setup_stack_linked, run_stack_push_n, teardown_stack, 0),
+    CASE("stack_push_n/array", "stack", 1, setup_stack_array, run_stack_push_n, teardown_stack, 0),
+    CASE("stack_pop_n/linked", "stack", 1, setup_stack_linked, run_stack_pop_n, teardown_stack, 0),
+    CASE("stack_pop_n/array", "stack", 1, setup_stack_array, run_stack_pop_n, teardown_stack, 0),
+    CASE("stack_destroy/linked", "stack", 1, setup_stack_linked, run_stack_destroy, NULL, 0),
+    CASE("stack_destroy/array", "stack", 1, setup_stack_array, run_stack_destroy, NULL, 0),
+    CASE("queue/array_append+array_delete_at", "array", 1, setup_array, run_queue_array, teardown_array, 0),
+    CASE("queue/deque_push_back+deque_pop_front", "deque", 1, setup_deque, run_queue_deque, teardown_deque, 0),
+    CASE("queue/deque_push_back_n+deque_pop_front_n", "deque", 1, setup_deque, run_queue_deque_bulk, teardown_deque, 0),
+    CASE("deque_push_front", "deque", 1, setup_deque, run_deque_push_front, teardown_deque, 0),
+    CASE("deque_pop_back", "deque", 1, setup_deque, run_deque_pop_back, teardown_deque, 0),
+    CASE("deque_get", "deque", 0, setup_deque, run_deque_get, teardown_deque, 1),
+    CASE("skip_list_insert", "skip", 1, setup_skip, run_skip_list_insert, teardown_skip, 1),
+    CASE("skip_list_find", "skip", 0, setup_skip, run_skip_list_find, teardown_skip, 1),
+    CASE("skip_list_get_at", "skip", 0, setup_skip, run_skip_list_get_at, teardown_skip, 1),
+    CASE("skip_list_delete_at", "skip", 1, setup_skip, run_skip_list_delete_at, teardown_skip, 1),
+    CASE("array_index_build+destroy", "array", 0, setup_array, run_array_index_build, teardown_array, 0),
+    CASE("array_index_find", "array", 0, setup_array_index, run_array_index_find, teardown_array_index, 1),
+    CASE("dedup/array_find+array_append", "array", 1, setup_array, run_dedup_array, teardown_array, 1),
+    CASE("dedup/array_index_find+array_index_append", "array", 1, setup_array_index, run_dedup_index,
+         teardown_array_index, 1),
+};
+
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+
+// --- Driver ---
+
+// Helper: parses "1000,100000" into a newly allocated list
+static size_t *parse_sizes(const char *text, size_t *count) {
+    size_t n = 1;
+    for (const char *p = text; *p; p++) {
+        n += (*p == ',');
+    }
+    size_t *sizes = malloc(n * sizeof(size_t));
+    if (sizes == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for size list.\n");
+        return NULL;
+    }
+    const char *p = text;
+    for (size_t i = 0; i < n; i++) {
+        char *end;
+        sizes[i] = (size_t)strtoull(p, &end, 10);
+        p = (*end == ',') ? end + 1 : end;
+    }
+    *count = n;
+    return sizes;
+}
+
+// Helper: builds positions and the keys found at them for one access pattern
+static void fill_pattern(int *index, int *keys, const int *values, size_t size, size_t ops, int random) {
+    for (size_t i = 0; i < ops; i++) {
+        index[i] = (int)(random ? rng_next() % size : i % size);
+        keys[i] = values[index[i]];
+    }
+}
+
+int main(int argc, char **argv) {
+    BenchOptions opts;
+    bench_options_default(&opts);
+    size_t default_sizes[] = { 1000, 100000 };
+    size_t *sizes = default_sizes;
+    size_t size_count = sizeof(default_sizes) / sizeof(default_sizes[0]);
+    size_t ops = 1000;
+    const char *filter = NULL;
+    const char *pattern = "all";
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strncmp(arg, "--sizes=", 8) == 0) {
+            sizes = parse_sizes(arg + 8, &size_count);
+            if (sizes == NULL) return 1;
+        } else if (strncmp(arg, "--ops=", 6) == 0) {
+            ops = (size_t)strtoull(arg + 6, NULL, 10);
+        } else if (strncmp(arg, "--reps=", 7) == 0) {
+            opts.repetitions = (size_t)strtoull(arg + 7, NULL, 10);
+        } else if (strncmp(arg, "--warmup=", 9) == 0) {
+            opts.warmup = (size_t)strtoull(arg + 9, NULL, 10);
+        } else if (strncmp(arg, "--pattern=", 10) == 0) {
+            pattern = arg + 10;
+        } else if (strncmp(arg, "--filter=", 9) == 0) {
+            filter = arg + 9;
+        } else if (strncmp(arg, "--seed=", 7) == 0) {
+            rng_state = strtoull(arg + 7, NULL, 10) | 1; // xorshift state must not be 0
+        } else if (strcmp(arg, "--format=csv") == 0) {
+            opts.format = BENCH_FORMAT_CSV;
+        } else if (strcmp(arg, "--format=json") == 0) {
+            opts.format = BENCH_FORMAT_JSON;
+        } else if (strcmp(arg, "--format=text") == 0) {
+            opts.format = BENCH_FORMAT_TEXT;
+        } else if (strncmp(arg, "--output=", 9) == 0) {
+            opts.out = fopen(arg + 9, "w");
+            if (opts.out == NULL) {
+                fprintf(stderr, "Error: Cannot open %s for writing.\n", arg + 9);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Error: Unknown option %s (see the top of bench_suite.c).\n", arg);
+            return 1;
+        }
+    }
+    if (ops == 0) {
+        ops = 1;
+    }
+    int run_seq = strcmp(pattern, "random") != 0;
+    int run_random = strcmp(pattern, "seq") != 0;
+
+    bench_report_begin(&opts);
+    for (size_t s = 0; s < size_count; s++) {
+        size_t size = sizes[s] > 0 ? sizes[s] : 1;
+        int *values = malloc(size * sizeof(int));
+        int *sorted = malloc(size * sizeof(int));
+        int *index = malloc(ops * sizeof(int));
+        int *keys = malloc(ops * sizeof(int));
+        int *scratch = malloc((ops > BULK ? ops : BULK) * sizeof(int));
+        uint64_t *bitmap = malloc(ARRAY_BITMAP_WORDS(size + (ops / BULK + 1) * BULK) * sizeof(uint64_t));
+        if (!values || !sorted || !index || !keys || !scratch || !bitmap) {
+            fprintf(stderr, "Error: Could not allocate inputs for size %zu.\n", size);
+            return 1;
+        }
+
+        // Shuffled permutation (Fisher-Yates) so unsorted data has no exploitable order
+        for (size_t i = 0; i < size; i++) {
+            sorted[i] = (int)i;
+            values[i] = (int)i;
+        }
+        for (size_t i = size - 1; i > 0; i--) {
+            size_t j = (size_t)(rng_next() % (i + 1));
+            int tmp = values[i];
+            values[i] = values[j];
+            values[j] = tmp;
+        }
+
+        size_t linear_ops = LINEAR_BUDGET / size;
+        linear_ops = linear_ops < 1 ? 1 : (linear_ops > ops ? ops : linear_ops);
+        struct SuiteCtx ctx = { .size = size, .ops = ops, .linear_ops = linear_ops, .values = values,
+                                .sorted = sorted, .index = index, .keys = keys, .scratch = scratch,
+                                .bitmap = bitmap };
+        node_pool_init(&ctx.pool, sizeof(struct Node), 0); // For linked_list_init_pooled
+
+        for (int random = 0; random <= 1; random++) {
+            if ((random && !run_random) || (!random && !run_seq)) {
+                continue;
+            }
+            const char *pattern_name = random ? "random" : "seq";
+            fill_pattern(index, keys, values, size, ops, random);
+            for (size_t i = 0; i < CASE_COUNT; i++) {
+                const struct SuiteCase *sc = &cases[i];
+                if (filter != NULL && strstr(sc->bench.name, filter) == NULL) {
+                    continue;
+                }
+                // Unpatterned cases only depend on the size; report them with the first pattern
+                if (!sc->patterned && random && run_seq) {
+                    continue;
+                }
+                BenchResult result;
+                if (!bench_measure(&opts, &sc->bench, &ctx, &result)) {
+                    return 1;
+                }
+                bench_report(&opts, &sc->bench, size, sc->patterned ? pattern_name : "-", &result);
+            }
+        }
+
+        node_pool_destroy(&ctx.pool);
+        free(values);
+        free(sorted);
+        free(index);
+        free(keys);
+        free(scratch);
+        free(bitmap);
+    }
+    bench_report_end(&opts);
+
+    if (opts.out != stdout) {
+        fclose(opts.out);
+    }
+    if (sizes != default_sizes) {
+        free(sizes);
+    }
+    return 0;
+}
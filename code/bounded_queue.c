@@ -0,0 +1,246 @@
+#include "bounded_queue.h" // Include the header file
+#include <stdio.h>         // For fprintf, stderr
+#include <stdlib.h>        // For malloc, free
+#include <string.h>        // For memcpy
+#include <stdint.h>        // For SIZE_MAX, intptr_t
+
+// Helper: smallest power of two >= 'n', or 0 if that does not fit in 'max'
+static size_t queue_capacity_for(size_t n, size_t max) {
+    size_t capacity = 1;
+    while (capacity < n) {
+        if (capacity > max / 2) {
+            return 0;
+        }
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+
+// ----- SPSC Queue -----
+
+int spsc_queue_init(struct SpscQueue *q, size_t capacity) {
+    if (q == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL queue pointer.\n");
+        return 0;
+    }
+    q->slots = NULL;
+    q->mask = 0;
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    q->cached_head = 0;
+    q->cached_tail = 0;
+
+    capacity = queue_capacity_for(capacity > 0 ? capacity : BOUNDED_QUEUE_DEFAULT_CAPACITY,
+                                  SIZE_MAX / sizeof(int));
+    if (capacity == 0) {
+        fprintf(stderr, "Error: Requested queue capacity is too large.\n");
+        return 0;
+    }
+    q->slots = malloc(capacity * sizeof(int));
+    if (q->slots == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in spsc_queue_init.\n");
+        return 0;
+    }
+    q->mask = capacity - 1;
+    return 1;
+}
+
+// Producer side: only re-reads the consumer's index when the cached one says "full"
+bool spsc_queue_push(struct SpscQueue *q, int value) {
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed); // Only we write it
+    if (tail - q->cached_head > q->mask) {
+        q->cached_head = atomic_load_explicit(&q->head, memory_order_acquire);
+        if (tail - q->cached_head > q->mask) {
+            return false; // Full
+        }
+    }
+    q->slots[tail & q->mask] = value;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release); // Publishes the slot
+    return true;
+}
+
+// Consumer side: only re-reads the producer's index when the cached one says "empty"
+bool spsc_queue_pop(struct SpscQueue *q, int *out) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed); // Only we write it
+    if (head == q->cached_tail) {
+        q->cached_tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+        if (head == q->cached_tail) {
+            return false; // Empty
+        }
+    }
+    *out = q->slots[head & q->mask];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release); // Hands the slot back
+    return true;
+}
+
+// Batch push: at most two memcpy calls (the free slots may wrap) and one publish
+size_t spsc_queue_push_n(struct SpscQueue *q, const int *values, size_t n) {
+    size_t capacity = q->mask + 1;
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t space = capacity - (tail - q->cached_head);
+    if (space < n) {
+        q->cached_head = atomic_load_explicit(&q->head, memory_order_acquire);
+        space = capacity - (tail - q->cached_head);
+    }
+    if (n > space) {
+        n = space;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    size_t start = tail & q->mask;
+    size_t first = capacity - start < n ? capacity - start : n;
+    memcpy(q->slots + start, values, first * sizeof(int));
+    memcpy(q->slots, values + first, (n - first) * sizeof(int));
+    atomic_store_explicit(&q->tail, tail + n, memory_order_release);
+    return n;
+}
+
+// Batch pop: at most two memcpy calls and one release of the slots
+size_t spsc_queue_pop_n(struct SpscQueue *q, int *out, size_t n) {
+    size_t capacity = q->mask + 1;
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t available = q->cached_tail - head;
+    if (available < n) {
+        q->cached_tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+        available = q->cached_tail - head;
+    }
+    if (n > available) {
+        n = available;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    size_t start = head & q->mask;
+    size_t first = capacity - start < n ? capacity - start : n;
+    memcpy(out, q->slots + start, first * sizeof(int));
+    memcpy(out + first, q->slots, (n - first) * sizeof(int));
+    atomic_store_explicit(&q->head, head + n, memory_order_release);
+    return n;
+}
+
+size_t spsc_queue_size(struct SpscQueue *q) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    return tail - head; // Unsigned wrap keeps this right even after the indices overflow
+}
+
+size_t spsc_queue_capacity(struct SpscQueue *q) {
+    return q->mask + 1;
+}
+
+void spsc_queue_destroy(struct SpscQueue *q) {
+    if (q == NULL) return; // Robustness check
+    free(q->slots);
+    q->slots = NULL;
+    q->mask = 0;
+    atomic_store(&q->head, 0);
+    atomic_store(&q->tail, 0);
+    q->cached_head = 0;
+    q->cached_tail = 0;
+}
+
+
+// ----- MPMC Queue -----
+
+int mpmc_queue_init(struct MpmcQueue *q, size_t capacity) {
+    if (q == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL queue pointer.\n");
+        return 0;
+    }
+    q->slots = NULL;
+    q->mask = 0;
+    atomic_init(&q->enqueue_pos, 0);
+    atomic_init(&q->dequeue_pos, 0);
+
+    if (capacity == 0) {
+        capacity = BOUNDED_QUEUE_DEFAULT_CAPACITY;
+    }
+    capacity = queue_capacity_for(capacity < 2 ? 2 : capacity, SIZE_MAX / sizeof(struct MpmcSlot));
+    if (capacity == 0) {
+        fprintf(stderr, "Error: Requested queue capacity is too large.\n");
+        return 0;
+    }
+    q->slots = malloc(capacity * sizeof(struct MpmcSlot));
+    if (q->slots == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in mpmc_queue_init.\n");
+        return 0;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&q->slots[i].sequence, i); // Slot i is free for position i
+    }
+    q->mask = capacity - 1;
+    return 1;
+}
+
+// Claims the next position whose slot is free for this lap, then fills and releases it
+bool mpmc_queue_push(struct MpmcQueue *q, int value) {
+    struct MpmcSlot *slot;
+    size_t pos = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed);
+    for (;;) {
+        slot = &q->slots[pos & q->mask];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            // Slot is free for 'pos'; try to claim the position (updates 'pos' on failure)
+            if (atomic_compare_exchange_weak_explicit(&q->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false; // Slot still holds last lap's element: full
+        } else {
+            pos = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed); // Someone got ahead
+        }
+    }
+    slot->value = value;
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release); // Ready for its consumer
+    return true;
+}
+
+// Claims the next position whose slot is filled for this lap, then empties and recycles it
+bool mpmc_queue_pop(struct MpmcQueue *q, int *out) {
+    struct MpmcSlot *slot;
+    size_t pos = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed);
+    for (;;) {
+        slot = &q->slots[pos & q->mask];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false; // Not filled yet: empty
+        } else {
+            pos = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed);
+        }
+    }
+    *out = slot->value;
+    atomic_store_explicit(&slot->sequence, pos + q->mask + 1, memory_order_release); // Free for next lap
+    return true;
+}
+
+size_t mpmc_queue_size(struct MpmcQueue *q) {
+    size_t dequeued = atomic_load_explicit(&q->dequeue_pos, memory_order_acquire);
+    size_t enqueued = atomic_load_explicit(&q->enqueue_pos, memory_order_acquire);
+    size_t size = enqueued - dequeued;
+    // The two loads are not a snapshot: pops between them make the difference overshoot
+    // the real size, on a busy full queue even past the capacity
+    return size > q->mask + 1 ? q->mask + 1 : size;
+}
+
+size_t mpmc_queue_capacity(struct MpmcQueue *q) {
+    return q->mask + 1;
+}
+
+void mpmc_queue_destroy(struct MpmcQueue *q) {
+    if (q == NULL) return; // Robustness check
+    free(q->slots);
+    q->slots = NULL;
+    q->mask = 0;
+    atomic_store(&q->enqueue_pos, 0);
+    atomic_store(&q->dequeue_pos, 0);
+}
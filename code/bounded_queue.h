@@ -0,0 +1,109 @@
+#ifndef BOUNDED_QUEUE_H // Include guard start
+#define BOUNDED_QUEUE_H
+
+#include <stdatomic.h> // For atomic_size_t
+#include <stdbool.h>   // For bool return types
+#include <stddef.h>    // For size_t
+
+// --- Structure Definitions ---
+
+// Fixed-capacity FIFO queues of ints for handing work between threads without a mutex.
+// Both keep their elements in one power-of-two ring buffer allocated at init time, so
+// pushing never allocates; a push onto a full queue or a pop from an empty one simply
+// returns false and the caller decides whether to spin, yield or drop.
+//
+// struct SpscQueue: exactly one producer thread and one consumer thread. Each side owns
+// one index and keeps a cached copy of the other side's index, so in the common case a
+// push or pop touches only its own cache line. The _n variants move a whole batch and
+// publish it with one atomic store.
+//
+// struct MpmcQueue: any number of producers and consumers. Every slot carries a sequence
+// number telling whether it is ready to be written or read for the current lap, so
+// threads claim slots with one compare-and-swap on the shared position and never wait
+// on each other's pointers (Vyukov's bounded queue).
+
+// Capacity used when an init function gets 0.
+#define BOUNDED_QUEUE_DEFAULT_CAPACITY 1024
+
+// Assumed cache line size for padding the shared indices apart.
+#define BOUNDED_QUEUE_CACHE_LINE 64
+
+struct SpscQueue {
+    _Alignas(BOUNDED_QUEUE_CACHE_LINE) atomic_size_t head; // Next slot to read (consumer writes)
+    size_t cached_tail;                                     // Consumer's last view of 'tail'
+    _Alignas(BOUNDED_QUEUE_CACHE_LINE) atomic_size_t tail; // Next slot to write (producer writes)
+    size_t cached_head;                                     // Producer's last view of 'head'
+    _Alignas(BOUNDED_QUEUE_CACHE_LINE) int *slots;         // Read-only after init
+    size_t mask;                                            // Capacity - 1
+};
+
+// Slot of an MPMC queue: 'sequence' == position means free for the producer of that
+// position, position + 1 means filled and ready for its consumer.
+struct MpmcSlot {
+    atomic_size_t sequence;
+    int value;
+};
+
+struct MpmcQueue {
+    _Alignas(BOUNDED_QUEUE_CACHE_LINE) atomic_size_t enqueue_pos; // Next position to claim for a push
+    _Alignas(BOUNDED_QUEUE_CACHE_LINE) atomic_size_t dequeue_pos; // Next position to claim for a pop
+    _Alignas(BOUNDED_QUEUE_CACHE_LINE) struct MpmcSlot *slots;    // Read-only pointer after init
+    size_t mask;                                                   // Capacity - 1
+};
+
+
+// --- SPSC Function Prototypes ---
+
+// Initializes an empty queue holding up to 'capacity' elements (rounded up to a power of
+// two; 0 means BOUNDED_QUEUE_DEFAULT_CAPACITY). Not thread-safe: call before sharing.
+// Returns 1 on success, 0 on failure.
+int spsc_queue_init(struct SpscQueue *q, size_t capacity);
+
+// Producer only. Appends 'value'; returns false if the queue is full.
+bool spsc_queue_push(struct SpscQueue *q, int value);
+
+// Consumer only. Removes the oldest element into '*out'; returns false if the queue is empty.
+bool spsc_queue_pop(struct SpscQueue *q, int *out);
+
+// Producer only. Appends as many of values[0..n) as fit, in order, and publishes them
+// together. Returns how many were pushed.
+size_t spsc_queue_push_n(struct SpscQueue *q, const int *values, size_t n);
+
+// Consumer only. Removes up to 'n' elements into out[] (oldest first) and releases their
+// slots together. Returns how many were popped.
+size_t spsc_queue_pop_n(struct SpscQueue *q, int *out, size_t n);
+
+// Number of elements at the moment of the call (exact only when both sides are idle).
+size_t spsc_queue_size(struct SpscQueue *q);
+
+// Maximum number of elements.
+size_t spsc_queue_capacity(struct SpscQueue *q);
+
+// Frees the buffer. Not thread-safe. Does NOT free the SpscQueue struct itself.
+void spsc_queue_destroy(struct SpscQueue *q);
+
+
+// --- MPMC Function Prototypes ---
+
+// Initializes an empty queue like spsc_queue_init (capacity is at least 2).
+// Not thread-safe: call before sharing. Returns 1 on success, 0 on failure.
+int mpmc_queue_init(struct MpmcQueue *q, size_t capacity);
+
+// Any thread. Appends 'value'; returns false if the queue is full.
+bool mpmc_queue_push(struct MpmcQueue *q, int value);
+
+// Any thread. Removes the oldest available element into '*out'; returns false
+// (leaving '*out' untouched) if the queue is empty.
+bool mpmc_queue_pop(struct MpmcQueue *q, int *out);
+
+// Number of elements at the moment of the call (approximate under contention).
+size_t mpmc_queue_size(struct MpmcQueue *q);
+
+// Maximum number of elements.
+size_t mpmc_queue_capacity(struct MpmcQueue *q);
+
+// Frees the buffer. Not thread-safe. Does NOT free the MpmcQueue struct itself.
+void mpmc_queue_destroy(struct MpmcQueue *q);
+
+
+#endif // BOUNDED_QUEUE_H // Include guard end
@@ -0,0 +1,203 @@
+#include "concurrent_array.h" // Include the header file
+#include "array_simd.h"       // Vectorized scan for the find functions
+#include <stdio.h>            // For fprintf, printf
+#include <stdlib.h>           // For calloc, free, exit
+
+#define FIRST_SEGMENT_SIZE ((size_t)1 << CONCURRENT_ARRAY_FIRST_SEGMENT_BITS)
+
+// Helper: splits a 0-based index into segment number and offset.
+// Segment s starts at FIRST_SEGMENT_SIZE * (2^s - 1), so shifting the index by the first
+// segment's size makes the segment number the position of the highest set bit.
+static size_t locate(size_t index, size_t *offset) {
+    size_t shifted = index + FIRST_SEGMENT_SIZE;
+    size_t top_bit = (size_t)(63 - __builtin_clzll((unsigned long long)shifted));
+    size_t segment = top_bit - CONCURRENT_ARRAY_FIRST_SEGMENT_BITS;
+    *offset = shifted - ((size_t)1 << top_bit);
+    return segment;
+}
+
+// Helper: number of elements in a segment
+static size_t segment_size(size_t segment) {
+    return FIRST_SEGMENT_SIZE << segment;
+}
+
+// Helper: the per-slot "written" flags stored right after a segment's elements
+static atomic_uchar *segment_ready(int *seg, size_t segment) {
+    return (atomic_uchar *)(seg + segment_size(segment));
+}
+
+// Helper: returns a segment, allocating it if no thread has yet. Racing threads may
+// both allocate; the first to install wins and the others free their copy.
+// calloc leaves every ready flag clear.
+static int *ensure_segment(ConcurrentArray *arr, size_t segment) {
+    int *seg = atomic_load_explicit(&arr->segments[segment], memory_order_acquire);
+    if (seg != NULL) {
+        return seg;
+    }
+    size_t size = segment_size(segment);
+    int *fresh = calloc(1, size * sizeof(int) + size * sizeof(atomic_uchar));
+    if (fresh == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1); // Same policy as array_append: the reserved slot cannot be abandoned
+    }
+    if (atomic_compare_exchange_strong_explicit(&arr->segments[segment], &seg, fresh,
+                                                memory_order_acq_rel, memory_order_acquire)) {
+        return fresh;
+    }
+    free(fresh); // Another thread installed it first; 'seg' now holds theirs
+    return seg;
+}
+
+// Helper: 1 if the slot at a 0-based index has been written
+static int slot_ready(ConcurrentArray *arr, size_t index) {
+    size_t offset;
+    size_t segment = locate(index, &offset);
+    int *seg = atomic_load_explicit(&arr->segments[segment], memory_order_acquire);
+    return seg != NULL && atomic_load(&segment_ready(seg, segment)[offset]);
+}
+
+// Helper: marks slots [first, first + n) written, then moves 'committed' forward over
+// every leading written slot. Nobody waits for a slower appender: if an earlier slot is
+// still being written, its owner advances 'committed' over ours when it finishes.
+// (Marking uses seq_cst so either we see the owner's advance or it sees our flag.)
+// Each CAS jumps over the whole run of written slots found, so a batch of n costs n
+// flag stores but usually a single CAS on the shared counter.
+static void publish(ConcurrentArray *arr, size_t first, size_t n) {
+    for (size_t i = first; i < first + n; i++) {
+        size_t offset;
+        size_t segment = locate(i, &offset);
+        int *seg = atomic_load_explicit(&arr->segments[segment], memory_order_acquire);
+        atomic_store(&segment_ready(seg, segment)[offset], 1);
+    }
+
+    size_t c = atomic_load(&arr->committed);
+    while (slot_ready(arr, c)) {
+        size_t end = c + 1;
+        while (slot_ready(arr, end)) {
+            end++;
+        }
+        if (atomic_compare_exchange_weak(&arr->committed, &c, end)) {
+            c = end;
+        } // On failure 'c' was reloaded, just check from that slot
+    }
+}
+
+int concurrent_array_init(ConcurrentArray *arr) {
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL concurrent array pointer.\n");
+        return 0;
+    }
+    for (size_t s = 0; s < CONCURRENT_ARRAY_MAX_SEGMENTS; s++) {
+        atomic_init(&arr->segments[s], NULL);
+    }
+    atomic_init(&arr->reserved, 0);
+    atomic_init(&arr->committed, 0);
+    return 1;
+}
+
+size_t concurrent_array_append(ConcurrentArray *arr, int data) {
+    size_t index = atomic_fetch_add_explicit(&arr->reserved, 1, memory_order_relaxed);
+    size_t offset;
+    size_t segment = locate(index, &offset);
+    ensure_segment(arr, segment)[offset] = data;
+    publish(arr, index, 1);
+    return index + 1; // Return 1-based index
+}
+
+size_t concurrent_array_append_n(ConcurrentArray *arr, const int *values, size_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    size_t first = atomic_fetch_add_explicit(&arr->reserved, n, memory_order_relaxed);
+
+    // The run may straddle segments: copy it one segment-sized piece at a time
+    size_t done = 0;
+    while (done < n) {
+        size_t offset;
+        size_t segment = locate(first + done, &offset);
+        size_t room = segment_size(segment) - offset;
+        size_t take = (n - done < room) ? n - done : room;
+        int *seg = ensure_segment(arr, segment);
+        for (size_t i = 0; i < take; i++) {
+            seg[offset + i] = values[done + i];
+        }
+        done += take;
+    }
+    publish(arr, first, n);
+    return first + 1; // Return 1-based index
+}
+
+size_t concurrent_array_size(ConcurrentArray *arr) {
+    return atomic_load_explicit(&arr->committed, memory_order_acquire);
+}
+
+// Helper: reads a 0-based index that is known to be published
+static int read_published(const ConcurrentArray *arr, size_t index) {
+    size_t offset;
+    size_t segment = locate(index, &offset);
+    int *seg = atomic_load_explicit((_Atomic(int *) *)&arr->segments[segment], memory_order_acquire);
+    return seg[offset];
+}
+
+int concurrent_array_get(ConcurrentArray *arr, size_t index) {
+    ConcurrentArraySnapshot snap = concurrent_array_snapshot(arr);
+    return concurrent_array_snapshot_get(&snap, index);
+}
+
+long long concurrent_array_find(ConcurrentArray *arr, int data) {
+    ConcurrentArraySnapshot snap = concurrent_array_snapshot(arr);
+    return concurrent_array_snapshot_find(&snap, data);
+}
+
+ConcurrentArraySnapshot concurrent_array_snapshot(ConcurrentArray *arr) {
+    ConcurrentArraySnapshot snap;
+    snap.arr = arr;
+    snap.count = atomic_load_explicit(&arr->committed, memory_order_acquire);
+    return snap;
+}
+
+int concurrent_array_snapshot_get(const ConcurrentArraySnapshot *snap, size_t index) {
+    if (index < 1 || index > snap->count) {
+        printf("Index out of bounds\n");
+        return INT_MIN; // Same error value as array_get
+    }
+    return read_published(snap->arr, index - 1);
+}
+
+long long concurrent_array_snapshot_find(const ConcurrentArraySnapshot *snap, int data) {
+    size_t base = 0;
+    size_t length;
+    const int *run;
+    for (size_t s = 0; (run = concurrent_array_snapshot_segment(snap, s, &length)) != NULL; s++) {
+        size_t i = array_simd_find(run, length, data); // Each segment is contiguous
+        if (i < length) {
+            return (long long)(base + i + 1); // Return 1-based index
+        }
+        base += length;
+    }
+    return -1; // Element not found
+}
+
+const int *concurrent_array_snapshot_segment(const ConcurrentArraySnapshot *snap, size_t segment,
+                                             size_t *length) {
+    if (segment >= CONCURRENT_ARRAY_MAX_SEGMENTS) {
+        return NULL;
+    }
+    size_t start = FIRST_SEGMENT_SIZE * (((size_t)1 << segment) - 1);
+    if (start >= snap->count) {
+        return NULL;
+    }
+    size_t size = segment_size(segment);
+    *length = (snap->count - start < size) ? snap->count - start : size;
+    return atomic_load_explicit((_Atomic(int *) *)&snap->arr->segments[segment], memory_order_acquire);
+}
+
+void concurrent_array_destroy(ConcurrentArray *arr) {
+    if (arr == NULL) {
+        return;
+    }
+    for (size_t s = 0; s < CONCURRENT_ARRAY_MAX_SEGMENTS; s++) {
+        free(atomic_load(&arr->segments[s]));
+    }
+    concurrent_array_init(arr);
+}
@@ -0,0 +1,77 @@
+#ifndef CONCURRENT_ARRAY_H // Start of include guard
+#define CONCURRENT_ARRAY_H
+
+#include <limits.h>    // For INT_MIN returned by concurrent_array_get
+#include <stdatomic.h> // For _Atomic
+#include <stddef.h>    // For size_t
+
+
+// Append-only array that many threads can append to and read from at the same time.
+//
+// Storage is a list of segments whose sizes double (1024, 2048, 4096, ... elements), so
+// growing never moves existing elements and pointers/readers stay valid. An append
+// reserves its slot with an atomic fetch-add, writes it, and flags it as written; the
+// visible count then advances over every leading written slot, so the first 'count'
+// elements a reader sees are always fully written. Neither appenders nor readers take a
+// lock or wait for each other.
+// Indices are 1-based like Array.
+
+#define CONCURRENT_ARRAY_FIRST_SEGMENT_BITS 10 // First segment holds 1 << 10 elements
+#define CONCURRENT_ARRAY_MAX_SEGMENTS 48       // Enough for any addressable size
+
+typedef struct ConcurrentArray {
+    _Atomic(int *) segments[CONCURRENT_ARRAY_MAX_SEGMENTS]; // Elements, then one ready flag per slot
+    _Alignas(64) atomic_size_t reserved;  // Slots handed out to appenders
+    _Alignas(64) atomic_size_t committed; // Slots [0, committed) are written and visible
+} ConcurrentArray;
+
+// Consistent read-only view of the first 'count' elements at the time it was taken.
+// Costs O(1) and copies nothing: appended elements never move or change.
+typedef struct ConcurrentArraySnapshot {
+    const ConcurrentArray *arr;
+    size_t count;
+} ConcurrentArraySnapshot;
+
+
+// ----- Function Prototypes -----
+
+// Initializes an empty array. Not thread-safe: call before sharing it.
+// Returns 1 on success, 0 on failure.
+int concurrent_array_init(ConcurrentArray *arr);
+
+// Appends 'data' from any thread. Returns its 1-based index.
+// Exits the program if a segment cannot be allocated, like array_append.
+size_t concurrent_array_append(ConcurrentArray *arr, int data);
+
+// Appends 'n' values as one contiguous run: one fetch-add reserves it, each slot gets its
+// ready flag, and 'committed' then usually advances over the whole run with one CAS.
+// Returns the 1-based index of values[0], or 0 if n is 0.
+size_t concurrent_array_append_n(ConcurrentArray *arr, const int *values, size_t n);
+
+// Number of elements visible to readers right now.
+size_t concurrent_array_size(ConcurrentArray *arr);
+
+// Gets the element at a 1-based index. Returns INT_MIN if it is not visible yet.
+int concurrent_array_get(ConcurrentArray *arr, size_t index);
+
+// Finds the 1-based index of the first visible occurrence of 'data', -1 if not found.
+long long concurrent_array_find(ConcurrentArray *arr, int data);
+
+// Takes a snapshot of everything visible right now.
+ConcurrentArraySnapshot concurrent_array_snapshot(ConcurrentArray *arr);
+
+// Reads a snapshot: 1-based get (INT_MIN past the end) and find (-1 if absent).
+int concurrent_array_snapshot_get(const ConcurrentArraySnapshot *snap, size_t index);
+long long concurrent_array_snapshot_find(const ConcurrentArraySnapshot *snap, int data);
+
+// Direct access to the snapshot's storage: returns segment 'segment' (0-based) as a
+// contiguous run and stores its length in '*length', or NULL past the last segment.
+// Walking segments 0, 1, 2, ... visits all 'count' elements in order.
+const int *concurrent_array_snapshot_segment(const ConcurrentArraySnapshot *snap, size_t segment,
+                                             size_t *length);
+
+// Frees all segments. Not thread-safe: every other thread must be done.
+// Does NOT free the ConcurrentArray struct itself.
+void concurrent_array_destroy(ConcurrentArray *arr);
+
+#endif // CONCURRENT_ARRAY_H // End of include guard
@@ -0,0 +1,247 @@
+#include "deque.h"  // Include the header file
+#include <stdio.h>  // For fprintf, printf
+#include <stdlib.h> // For malloc, realloc, free
+#include <string.h> // For memcpy
+
+// Helper: slot of the element 'offset' places behind the front
+static size_t deque_slot(const Deque *dq, size_t offset) {
+    return (dq->head + offset) & (dq->capacity - 1);
+}
+
+// Helper: smallest power of two >= 'n' (n must not exceed DEQUE_MAX_CAPACITY)
+static size_t round_up_pow2(size_t n) {
+    size_t capacity = 1;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// Initializes the deque with a power-of-two buffer
+int deque_init(Deque *dq, size_t initial_capacity) {
+    if (dq == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL deque pointer.\n");
+        return 0;
+    }
+    dq->data = NULL;
+    dq->capacity = 0;
+    dq->head = 0;
+    dq->count = 0;
+    if (initial_capacity == 0) {
+        initial_capacity = DEQUE_DEFAULT_CAPACITY;
+    }
+    if (initial_capacity > DEQUE_MAX_CAPACITY) {
+        fprintf(stderr, "Error: Requested deque capacity is too large.\n");
+        return 0;
+    }
+    size_t capacity = round_up_pow2(initial_capacity);
+    dq->data = malloc(capacity * sizeof(int));
+    if (dq->data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in deque_init.\n");
+        return 0;
+    }
+    dq->capacity = capacity;
+    return 1;
+}
+
+// Helper: grows the buffer (doubling) to hold at least 'min_capacity' elements.
+// realloc keeps slots [0, old capacity) in place, so only the wrapped-around part
+// (the elements stored before 'head') has to move: it goes right after the old end,
+// which makes the elements contiguous again without touching 'head'.
+static int deque_grow(Deque *dq, size_t min_capacity) {
+    if (min_capacity <= dq->capacity) {
+        return 1;
+    }
+    if (min_capacity > DEQUE_MAX_CAPACITY) {
+        fprintf(stderr, "Error: Requested deque capacity is too large.\n");
+        return 0;
+    }
+    size_t old_capacity = dq->capacity;
+    size_t new_capacity = round_up_pow2(min_capacity);
+    if (new_capacity < 2 * old_capacity) {
+        new_capacity = 2 * old_capacity; // Keep growth geometric
+    }
+    if (new_capacity < DEQUE_DEFAULT_CAPACITY) {
+        new_capacity = DEQUE_DEFAULT_CAPACITY; // Reused after deque_destroy
+    }
+    int *new_data = realloc(dq->data, new_capacity * sizeof(int));
+    if (new_data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed while growing deque.\n");
+        return 0; // Old buffer is still valid
+    }
+    dq->data = new_data;
+    dq->capacity = new_capacity;
+
+    if (old_capacity > 0 && dq->head + dq->count > old_capacity) {
+        size_t wrapped = dq->head + dq->count - old_capacity;
+        memcpy(dq->data + old_capacity, dq->data, wrapped * sizeof(int));
+    }
+    if (old_capacity == 0) {
+        dq->head = 0;
+    }
+    return 1;
+}
+
+// Pushes at the back: the slot just past the last element
+int deque_push_back(Deque *dq, int value) {
+    if (dq == NULL) return 0; // Safety check
+    if (dq->count == dq->capacity && !deque_grow(dq, dq->count + 1)) {
+        return 0;
+    }
+    dq->data[deque_slot(dq, dq->count)] = value;
+    dq->count++;
+    return 1;
+}
+
+// Pushes at the front: the slot just before the current front
+int deque_push_front(Deque *dq, int value) {
+    if (dq == NULL) return 0; // Safety check
+    if (dq->count == dq->capacity && !deque_grow(dq, dq->count + 1)) {
+        return 0;
+    }
+    dq->head = (dq->head - 1) & (dq->capacity - 1);
+    dq->data[dq->head] = value;
+    dq->count++;
+    return 1;
+}
+
+// Pops the front element
+int deque_pop_front(Deque *dq) {
+    if (dq == NULL || dq->count == 0) {
+        fprintf(stderr, "Error: Deque underflow on pop.\n");
+        return INT_MIN;
+    }
+    int value = dq->data[dq->head];
+    dq->head = deque_slot(dq, 1);
+    dq->count--;
+    return value;
+}
+
+// Pops the back element
+int deque_pop_back(Deque *dq) {
+    if (dq == NULL || dq->count == 0) {
+        fprintf(stderr, "Error: Deque underflow on pop.\n");
+        return INT_MIN;
+    }
+    dq->count--;
+    return dq->data[deque_slot(dq, dq->count)];
+}
+
+int deque_peek_front(Deque *dq) {
+    if (dq == NULL || dq->count == 0) {
+        return INT_MIN;
+    }
+    return dq->data[dq->head];
+}
+
+int deque_peek_back(Deque *dq) {
+    if (dq == NULL || dq->count == 0) {
+        return INT_MIN;
+    }
+    return dq->data[deque_slot(dq, dq->count - 1)];
+}
+
+// Reads the element at a 1-based position from the front
+int deque_get(Deque *dq, size_t index) {
+    if (dq == NULL || index < 1 || index > dq->count) {
+        printf("Index out of bounds\n");
+        return INT_MIN;
+    }
+    return dq->data[deque_slot(dq, index - 1)];
+}
+
+size_t deque_size(Deque *dq) {
+    return (dq == NULL) ? 0 : dq->count;
+}
+
+int deque_is_empty(Deque *dq) {
+    return dq == NULL || dq->count == 0;
+}
+
+// Pre-grows the buffer
+int deque_reserve(Deque *dq, size_t min_capacity) {
+    if (dq == NULL) {
+        fprintf(stderr, "Error: Cannot reserve on NULL deque pointer.\n");
+        return 0;
+    }
+    return deque_grow(dq, min_capacity);
+}
+
+// Bulk enqueue: the free slots after the back form at most two runs
+int deque_push_back_n(Deque *dq, const int *values, size_t n) {
+    if (dq == NULL || (values == NULL && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for deque_push_back_n.\n");
+        return 0;
+    }
+    if (n == 0) {
+        return 1;
+    }
+    if (n > DEQUE_MAX_CAPACITY - dq->count || !deque_grow(dq, dq->count + n)) {
+        return 0;
+    }
+    size_t tail = deque_slot(dq, dq->count);
+    size_t first = dq->capacity - tail; // Slots before the buffer end
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dq->data + tail, values, first * sizeof(int));
+    memcpy(dq->data, values + first, (n - first) * sizeof(int));
+    dq->count += n;
+    return 1;
+}
+
+// Bulk dequeue: the elements at the front form at most two runs
+size_t deque_pop_front_n(Deque *dq, int *out, size_t n) {
+    if (dq == NULL || (out == NULL && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for deque_pop_front_n.\n");
+        return 0;
+    }
+    if (n > dq->count) {
+        n = dq->count;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    size_t first = dq->capacity - dq->head; // Elements before the buffer end
+    if (first > n) {
+        first = n;
+    }
+    memcpy(out, dq->data + dq->head, first * sizeof(int));
+    memcpy(out + first, dq->data, (n - first) * sizeof(int));
+    dq->head = deque_slot(dq, n);
+    dq->count -= n;
+    return n;
+}
+
+// Splits the occupied slots at the end of the buffer
+size_t deque_segments(Deque *dq, DequeSegment segments[2]) {
+    if (dq == NULL || dq->count == 0) {
+        return 0;
+    }
+    size_t first = dq->capacity - dq->head;
+    if (first >= dq->count) {
+        segments[0].data = dq->data + dq->head;
+        segments[0].count = dq->count;
+        return 1;
+    }
+    segments[0].data = dq->data + dq->head;
+    segments[0].count = first;
+    segments[1].data = dq->data;
+    segments[1].count = dq->count - first;
+    return 2;
+}
+
+void deque_clear(Deque *dq) {
+    if (dq == NULL) return; // Safety check
+    dq->head = 0;
+    dq->count = 0;
+}
+
+void deque_destroy(Deque *dq) {
+    if (dq == NULL) return; // Safety check
+    free(dq->data);
+    dq->data = NULL;
+    dq->capacity = 0;
+    dq->head = 0;
+    dq->count = 0;
+}
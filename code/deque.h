@@ -0,0 +1,92 @@
+#ifndef DEQUE_H // Start of include guard
+#define DEQUE_H
+
+#include <limits.h> // For INT_MIN returned by pops/peeks on an empty deque
+#include <stddef.h> // For size_t
+#include <stdint.h> // For SIZE_MAX
+
+// --- Ring-Buffer Deque ---
+// A double-ended queue in one contiguous, growable int buffer, like Array, but used as a
+// circle: the front may sit anywhere and the elements wrap around the end of the buffer.
+// Pushing or popping at either end is O(1) (amortized when the buffer has to grow), where
+// an Array used as a queue (array_append + array_delete_at(arr, 1)) shifts every element
+// on each dequeue.
+//
+// The capacity is always a power of two, so wrapping an index is a mask, not a division.
+// Growth doubles the buffer and unwraps the elements so they are contiguous again.
+// Indices are 1-based like array.h: deque_get(dq, 1) is the front.
+
+// Slots allocated by deque_init when it gets 0.
+#define DEQUE_DEFAULT_CAPACITY 16
+
+// Largest capacity: the biggest power of two whose byte size fits in a size_t.
+#define DEQUE_MAX_CAPACITY ((SIZE_MAX / sizeof(int) >> 1) + 1)
+
+typedef struct Deque {
+    int *data;       // Ring buffer of 'capacity' slots
+    size_t capacity; // Power of two (0 only after deque_destroy)
+    size_t head;     // Slot of the front element
+    size_t count;    // Number of elements
+} Deque;
+
+// One contiguous run of elements, front to back (see deque_segments).
+typedef struct DequeSegment {
+    int *data;
+    size_t count;
+} DequeSegment;
+
+
+// --- Function Prototypes ---
+
+// Initializes an empty deque with room for at least 'initial_capacity' elements
+// (rounded up to a power of two; 0 means DEQUE_DEFAULT_CAPACITY).
+// Returns 1 on success, 0 on failure.
+int deque_init(Deque *dq, size_t initial_capacity);
+
+// Adds an element at the back / front. Returns 1 on success, 0 on failure.
+int deque_push_back(Deque *dq, int value);
+int deque_push_front(Deque *dq, int value);
+
+// Removes and returns the front / back element.
+// Returns INT_MIN (and prints an error) if the deque is empty.
+int deque_pop_front(Deque *dq);
+int deque_pop_back(Deque *dq);
+
+// Returns the front / back element without removing it. INT_MIN if empty.
+int deque_peek_front(Deque *dq);
+int deque_peek_back(Deque *dq);
+
+// Returns the element at 1-based 'index' counted from the front.
+// Prints "Index out of bounds" and returns INT_MIN if the index is invalid.
+int deque_get(Deque *dq, size_t index);
+
+// Number of elements / whether there are none.
+size_t deque_size(Deque *dq);
+int deque_is_empty(Deque *dq);
+
+// Makes room for at least 'min_capacity' elements. Returns 1 on success, 0 on failure.
+int deque_reserve(Deque *dq, size_t min_capacity);
+
+// Enqueues values[0..n) at the back in order, growing at most once and copying in at most
+// two memcpy calls. All or nothing: returns 1 on success, 0 on failure.
+int deque_push_back_n(Deque *dq, const int *values, size_t n);
+
+// Dequeues up to 'n' elements from the front into 'out' (out[0] was the front), copying
+// in at most two memcpy calls. Returns how many were dequeued.
+size_t deque_pop_front_n(Deque *dq, int *out, size_t n);
+
+// Describes the elements as at most two contiguous runs, front to back, so they can be
+// processed with plain loops or SIMD kernels: segments[0] starts at the front, and
+// segments[1] (the wrapped part) is only used when the elements cross the end of the buffer.
+// Returns the number of segments filled (0 for an empty deque). The pointers are valid
+// until the next push, pop or reserve.
+size_t deque_segments(Deque *dq, DequeSegment segments[2]);
+
+// Removes every element; keeps the buffer.
+void deque_clear(Deque *dq);
+
+// Frees the buffer and leaves the deque empty. Does NOT free the Deque struct itself.
+void deque_destroy(Deque *dq);
+
+
+#endif // DEQUE_H // End of include guard
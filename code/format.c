@@ -0,0 +1,187 @@
+#include "format.h" // Include the header file
+#include <stdio.h>  // For fwrite
+#include <string.h> // For memcpy, strlen
+#include <stdint.h> // For uint32_t
+
+// "00" "01" ... "99": two digits per table lookup halves the divisions
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+void format_options_default(struct FormatOptions *options) {
+    options->prefix = NULL;
+    options->separator = ", ";
+    options->trailing_separator = 0;
+    options->truncated = "...";
+    options->suffix = NULL;
+    options->start = 0;
+    options->limit = 0;
+}
+
+// Helper: number of decimal digits in 'value' (1 for 0)
+static size_t count_digits(uint32_t value) {
+    size_t digits = 1;
+    while (value >= 10000) {
+        value /= 10000;
+        digits += 4;
+    }
+    return digits + (value >= 10) + (value >= 100) + (value >= 1000);
+}
+
+// Sizes the text first, then fills the digits in right to left, two at a time
+size_t format_int(char *out, int value) {
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value; // INT_MIN safe
+    size_t length = count_digits(magnitude) + (value < 0);
+    char *p = out + length;
+
+    while (magnitude >= 100) {
+        uint32_t pair = (magnitude % 100) * 2;
+        magnitude /= 100;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+    }
+    if (magnitude >= 10) {
+        *--p = digit_pairs[magnitude * 2 + 1];
+        *--p = digit_pairs[magnitude * 2];
+    } else {
+        *--p = (char)('0' + magnitude);
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+    return length;
+}
+
+void format_sink_buffer(struct FormatSink *sink, char *buffer, size_t size) {
+    sink->buffer = buffer;
+    sink->size = (buffer != NULL) ? size : 0;
+    sink->pos = 0;
+    sink->total = 0;
+    sink->out = NULL;
+    sink->error = 0;
+    sink->separator_length = 0;
+}
+
+void format_sink_file(struct FormatSink *sink, FILE *out, char *scratch, size_t size) {
+    sink->buffer = scratch;
+    sink->size = size;
+    sink->pos = 0;
+    sink->total = 0;
+    sink->out = out;
+    sink->error = 0;
+    sink->separator_length = 0;
+}
+
+// Helper: hands the collected text of a FILE* sink to fwrite and empties the buffer.
+static void format_flush(struct FormatSink *sink) {
+    if (sink->pos > 0 && !sink->error && fwrite(sink->buffer, 1, sink->pos, sink->out) != sink->pos) {
+        sink->error = 1;
+    }
+    sink->pos = 0;
+}
+
+// Helper: appends 'n' bytes. Buffer sinks keep one byte free for the terminator.
+static void format_put_bytes(struct FormatSink *sink, const char *bytes, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    sink->total += n;
+    if (sink->out == NULL) {
+        size_t room = (sink->size > 0) ? sink->size - 1 - sink->pos : 0;
+        size_t take = n < room ? n : room;
+        if (take > 0) { // A measuring call may pass a NULL buffer of size 0
+            memcpy(sink->buffer + sink->pos, bytes, take);
+            sink->pos += take;
+        }
+        return;
+    }
+    while (n > 0) {
+        if (sink->pos == sink->size) {
+            format_flush(sink);
+        }
+        size_t room = sink->size - sink->pos;
+        size_t take = n < room ? n : room;
+        memcpy(sink->buffer + sink->pos, bytes, take);
+        sink->pos += take;
+        bytes += take;
+        n -= take;
+    }
+}
+
+void format_put_str(struct FormatSink *sink, const char *text) {
+    if (text != NULL) {
+        format_put_bytes(sink, text, strlen(text));
+    }
+}
+
+void format_put_int(struct FormatSink *sink, int value) {
+    // Common case: enough room left to render straight into the sink's buffer
+    size_t room = sink->size - sink->pos - (sink->out == NULL); // Buffer sinks keep the terminator
+    if (sink->size > 0 && room >= FORMAT_INT_MAX_CHARS) {
+        size_t length = format_int(sink->buffer + sink->pos, value);
+        sink->pos += length;
+        sink->total += length;
+        return;
+    }
+    char text[FORMAT_INT_MAX_CHARS];
+    format_put_bytes(sink, text, format_int(text, value));
+}
+
+size_t format_finish(struct FormatSink *sink) {
+    if (sink->out != NULL) {
+        format_flush(sink);
+        return !sink->error;
+    }
+    if (sink->size > 0) {
+        sink->buffer[sink->pos] = '\0';
+    }
+    return sink->total;
+}
+
+void format_begin(struct FormatSink *sink, const struct FormatOptions *options) {
+    sink->separator_length = (options->separator != NULL) ? strlen(options->separator) : 0;
+    format_put_str(sink, options->prefix);
+}
+
+void format_element(struct FormatSink *sink, const struct FormatOptions *options, int value, size_t shown) {
+    size_t separator_length = (shown > 0) ? sink->separator_length : 0;
+
+    // Common case: separator and number both fit, so write them in place
+    size_t room = sink->size - sink->pos - (sink->out == NULL); // Buffer sinks keep the terminator
+    if (sink->size > 0 && room >= separator_length + FORMAT_INT_MAX_CHARS) {
+        char *p = sink->buffer + sink->pos;
+        if (separator_length > 0) {
+            memcpy(p, options->separator, separator_length);
+        }
+        size_t length = separator_length + format_int(p + separator_length, value);
+        sink->pos += length;
+        sink->total += length;
+        return;
+    }
+    if (sink->out == NULL && room == 0) {
+        // Buffer already full: only the length still matters
+        uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+        sink->total += separator_length + count_digits(magnitude) + (value < 0);
+        return;
+    }
+    format_put_bytes(sink, options->separator, separator_length);
+    format_put_int(sink, value);
+}
+
+void format_end(struct FormatSink *sink, const struct FormatOptions *options, size_t shown, int cut_off) {
+    if (options->trailing_separator && shown > 0) {
+        format_put_str(sink, options->separator);
+    }
+    if (cut_off) {
+        format_put_str(sink, options->truncated);
+    }
+    format_put_str(sink, options->suffix);
+}
@@ -0,0 +1,77 @@
+#ifndef FORMAT_H // Include guard start
+#define FORMAT_H
+
+#include <stdio.h>  // For FILE
+#include <stddef.h> // For size_t
+
+// --- Buffered Text Formatting ---
+// Shared by array_format/array_fprint and list_format/list_fprint. Elements are
+// rendered with a table-driven integer-to-text routine into a buffer, never through
+// printf, and a FILE* only sees one fwrite per FORMAT_CHUNK_SIZE bytes of output.
+
+// Bytes rendered on the stack between writes when printing to a FILE*
+#define FORMAT_CHUNK_SIZE 32768
+
+// Longest text for one int: "-2147483648"
+#define FORMAT_INT_MAX_CHARS 11
+
+// Layout of the output: prefix, elements joined by the separator, an optional trailing
+// separator, the truncation marker (only when 'limit' cut elements off), then the suffix.
+// NULL strings are written as nothing.
+struct FormatOptions {
+    const char *prefix;     // Written before everything else
+    const char *separator;  // Written between elements
+    int trailing_separator; // 1 to also write the separator after the last element shown
+    const char *truncated;  // Written when elements after the shown range were left out
+    const char *suffix;     // Written last
+    size_t start;           // 0-based index of the first element shown
+    size_t limit;           // Show at most this many elements, 0 for no limit
+};
+
+// Output target: a caller-supplied buffer (snprintf-style) or a FILE* behind a scratch buffer
+struct FormatSink {
+    char *buffer;  // Where text goes
+    size_t size;   // Bytes available in 'buffer'
+    size_t pos;    // Bytes currently held in 'buffer'
+    size_t total;  // Bytes produced so far (including any that did not fit)
+    FILE *out;     // NULL for buffer output; otherwise 'buffer' is flushed here when full
+    int error;     // 1 once a write to 'out' failed
+    size_t separator_length; // Cached by format_begin
+};
+
+
+// --- Function Prototypes ---
+
+// Fills 'options' with a plain layout: ", " between elements, "..." when truncated,
+// everything shown, nothing else.
+void format_options_default(struct FormatOptions *options);
+
+// Writes the decimal text of 'value' to 'out' (no terminator, at most
+// FORMAT_INT_MAX_CHARS bytes). Returns the number of characters.
+size_t format_int(char *out, int value);
+
+// Sets up a sink over a caller buffer; text that does not fit is counted but dropped.
+void format_sink_buffer(struct FormatSink *sink, char *buffer, size_t size);
+
+// Sets up a sink that collects text in 'scratch' (size > 0) and fwrites it to 'out' when full.
+void format_sink_file(struct FormatSink *sink, FILE *out, char *scratch, size_t size);
+
+// Appends a string / the text of an int to the sink.
+void format_put_str(struct FormatSink *sink, const char *text);
+void format_put_int(struct FormatSink *sink, int value);
+
+// Finishes the output: NUL-terminates a buffer sink (truncating if needed), or writes
+// what is left to the FILE*. Returns the total length for buffer sinks, or 1/0 for
+// FILE* sinks (0 if any write failed).
+size_t format_finish(struct FormatSink *sink);
+
+// Layout steps for a container's print loop: format_begin writes the prefix,
+// format_element writes one value ('shown' = elements already written, so the separator
+// goes before all but the first), format_end writes the trailing separator, the
+// truncation marker if 'cut_off' is non-zero, and the suffix.
+void format_begin(struct FormatSink *sink, const struct FormatOptions *options);
+void format_element(struct FormatSink *sink, const struct FormatOptions *options, int value, size_t shown);
+void format_end(struct FormatSink *sink, const struct FormatOptions *options, size_t shown, int cut_off);
+
+
+#endif // FORMAT_H // Include guard end
@@ -1,265 +1,1091 @@
-#include "linked_list.h" // Include the header file
-#include <stdio.h>       // For printf (used in list_print and potentially errors)
-#include <stdlib.h>      // For malloc, free
-#include <stdbool.h>     // For bool return type
-
-// Initializes the list by setting the head pointer to NULL.
-void list_init(struct Node **head_ptr) {
-    if (head_ptr != NULL) {
-        *head_ptr = NULL;
-    }
-}
-
-// Adds a new node with 'data' to the beginning of the list.
-void list_prepend(struct Node **head_ptr, int data) {
-    if (head_ptr == NULL) return; // Safety check
-
-    struct Node* new_node = (struct Node*)malloc(sizeof(struct Node));
-    if (new_node == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed in list_prepend.\n");
-        return; // Consider other error handling?
-    }
-    new_node->data = data;
-    new_node->next = *head_ptr;
-    *head_ptr = new_node;
-}
-
-// Adds a new node with 'data' to the end of the list.
-void list_append(struct Node **head_ptr, int data) {
-     if (head_ptr == NULL) return; // Safety check
-
-    struct Node* new_node = (struct Node*)malloc(sizeof(struct Node));
-     if (new_node == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed in list_append.\n");
-        return;
-    }
-    new_node->data = data;
-    new_node->next = NULL; // New last node points to NULL
-
-    // If the list is empty, the new node becomes the head
-    if (*head_ptr == NULL) {
-        *head_ptr = new_node;
-        return;
-    }
-
-    // Otherwise, traverse to the current last node
-    struct Node* last = *head_ptr;
-    while (last->next != NULL) {
-        last = last->next;
-    }
-    // Link the new node after the current last node
-    last->next = new_node;
-}
-
-// Inserts a new node with 'data' at the specified 0-based position.
-// Returns true on success, false on failure.
-bool list_insert_at(struct Node **head_ptr, int data, int position) {
-    if (head_ptr == NULL || position < 0) {
-        fprintf(stderr, "Error: Invalid arguments for list_insert_at.\n");
-        return false; // Invalid position or NULL head pointer address
-    }
-
-    // Handle insertion at the beginning (position 0)
-    if (position == 0) {
-        struct Node* new_node = (struct Node*)malloc(sizeof(struct Node));
-        if (new_node == NULL) {
-             fprintf(stderr, "Error: Memory allocation failed in list_insert_at.\n");
-             return false;
-        }
-        new_node->data = data;
-        new_node->next = *head_ptr;
-        *head_ptr = new_node;
-        return true;
-    }
-
-    // Traverse to the node *before* the desired insertion point
-    struct Node* current = *head_ptr;
-    for (int i = 0; i < position - 1 && current != NULL; i++) {
-        current = current->next;
-    }
-
-    // Check if position is out of bounds (current is NULL or current->next is needed for exact pos)
-    // If current is NULL, position was > list length
-    if (current == NULL) {
-        fprintf(stderr, "Error: Position %d out of bounds for list_insert_at.\n", position);
-        return false;
-    }
-
-    // Now insert after 'current'
-    struct Node* new_node = (struct Node*)malloc(sizeof(struct Node));
-     if (new_node == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed in list_insert_at.\n");
-        return false;
-    }
-    new_node->data = data;
-    new_node->next = current->next;
-    current->next = new_node;
-    return true;
-}
-
-// Deletes the first node from the list. Returns true if successful, false otherwise.
-bool list_delete_first(struct Node **head_ptr) {
-    if (head_ptr == NULL || *head_ptr == NULL) {
-        // List is empty or invalid arguments
-        return false;
-    }
-
-    struct Node* temp = *head_ptr; // Node to be deleted
-    *head_ptr = (*head_ptr)->next; // Update head
-    free(temp);                   // Free the old head
-    return true;
-}
-
-// Deletes the last node from the list. Returns true if successful, false otherwise.
-bool list_delete_last(struct Node **head_ptr) {
-    if (head_ptr == NULL || *head_ptr == NULL) {
-        // List is empty or invalid arguments
-        return false;
-    }
-
-    // Handle list with only one node
-    if ((*head_ptr)->next == NULL) {
-        free(*head_ptr);
-        *head_ptr = NULL;
-        return true;
-    }
-
-    // Traverse to the second-to-last node
-    struct Node* second_last = *head_ptr;
-    while (second_last->next->next != NULL) {
-        second_last = second_last->next;
-    }
-
-    // Free the last node and update the second-to-last node's next pointer
-    free(second_last->next);
-    second_last->next = NULL;
-    return true;
-}
-
-// Deletes the node at the specified 0-based position.
-// Returns true on success, false on failure.
-bool list_delete_at(struct Node **head_ptr, int position) {
-     if (head_ptr == NULL || *head_ptr == NULL || position < 0) {
-        // List empty, invalid args, or negative position
-        return false;
-    }
-
-    // Handle deletion of the first node (position 0)
-    if (position == 0) {
-        struct Node* temp = *head_ptr;
-        *head_ptr = (*head_ptr)->next;
-        free(temp);
-        return true;
-    }
-
-    // Traverse to the node *before* the one to be deleted
-    struct Node* prev = *head_ptr;
-    for (int i = 0; i < position - 1 && prev->next != NULL; i++) {
-        prev = prev->next;
-    }
-
-    // Check if position is out of bounds (prev->next is the node to delete)
-    if (prev->next == NULL) {
-         fprintf(stderr, "Error: Position %d out of bounds for list_delete_at.\n", position);
-        return false;
-    }
-
-    // Delete the node after 'prev'
-    struct Node* node_to_delete = prev->next;
-    prev->next = node_to_delete->next; // Bypass the node
-    free(node_to_delete);             // Free the node
-    return true;
-}
-
-// Prints the elements of the list. (Takes Node*, not Node**)
-void list_print(struct Node *head) {
-    struct Node* current = head;
-    printf("List: ");
-    while (current != NULL) {
-        printf("%d -> ", current->data);
-        current = current->next;
-    }
-    printf("NULL\n");
-}
-
-// Finds the first node containing 'value'. (Takes Node*)
-// Returns a pointer to the node if found, NULL otherwise.
-struct Node* list_find(struct Node *head, int value) {
-    struct Node* current = head;
-    while (current != NULL) {
-        if (current->data == value) {
-            return current; // Return pointer to the found node
-        }
-        current = current->next;
-    }
-    return NULL; // Value not found
-}
-
-// Updates the data of the node at the specified 0-based position. (Takes Node*)
-// Returns true on success, false on failure.
-bool list_set_at(struct Node *head, int position, int new_value) {
-    if (position < 0) {
-        fprintf(stderr, "Error: Position cannot be negative for list_set_at.\n");
-        return false;
-    }
-
-    struct Node* current = head;
-    for (int i = 0; i < position && current != NULL; i++) {
-        current = current->next;
-    }
-
-    // Check if position is out of bounds
-    if (current == NULL) {
-        fprintf(stderr, "Error: Position %d out of bounds for list_set_at.\n", position);
-        return false;
-    }
-
-    // Update the data
-    current->data = new_value;
-    return true;
-}
-
-// Calculates and returns the number of nodes in the list. (Takes Node*)
-int list_length(struct Node *head) {
-    struct Node* current = head;
-    int length = 0;
-    while (current != NULL) {
-        length++;
-        current = current->next;
-    }
-    return length; // Return the calculated length
-}
-
-// Reverses the order of nodes in the list in-place.
-void list_reverse(struct Node **head_ptr) {
-    if (head_ptr == NULL || *head_ptr == NULL || (*head_ptr)->next == NULL) {
-        return; // Nothing to reverse (empty or single node list)
-    }
-
-    struct Node* prev = NULL;
-    struct Node* current = *head_ptr;
-    struct Node* next_node = NULL; // Renamed from 'next' to avoid confusion
-
-    while (current != NULL) {
-        next_node = current->next; // Store the next node
-        current->next = prev;     // Reverse the current node's pointer
-        prev = current;           // Move prev one step forward
-        current = next_node;      // Move current one step forward
-    }
-    *head_ptr = prev; // New head is the previous tail
-}
-
-// Frees all nodes in the list and sets the head pointer (via address) to NULL.
-void list_destroy(struct Node **head_ptr) {
-     if (head_ptr == NULL) return; // Safety check
-
-    struct Node* current = *head_ptr;
-    struct Node* next_node;
-
-    while (current != NULL) {
-        next_node = current->next;
-        free(current);
-        current = next_node;
-    }
-    *head_ptr = NULL; // Set the caller's head pointer to NULL
-}
\ No newline at end of file
+#include "linked_list.h" // Include the header file
+#include <stdio.h>       // For printf (used in list_print and potentially errors)
+#include <stdlib.h>      // For malloc, free
+#include <stdbool.h>     // For bool return type
+#include "stats.h"       // Counters and histograms (compiled in with -DDS_STATS)
+
+// Helper: allocates a node from 'pool', or with malloc when 'pool' is NULL.
+static struct Node* node_alloc(struct NodePool *pool) {
+    struct Node* node = (pool != NULL) ? (struct Node*)node_pool_alloc(pool)
+                                       : (struct Node*)malloc(sizeof(struct Node));
+    STATS_ADD(STATS_LIST_NODES_ALLOCATED, node != NULL);
+    return node;
+}
+
+// Helper: releases a node to 'pool', or with free when 'pool' is NULL.
+static void node_release(struct NodePool *pool, struct Node *node) {
+    STATS_ADD(STATS_LIST_NODES_FREED, 1);
+    if (pool != NULL) {
+        node_pool_free(pool, node);
+    } else {
+        free(node);
+    }
+}
+
+// Initializes a pool whose nodes fit struct Node.
+int list_pool_init(struct NodePool *pool, size_t nodes_per_chunk) {
+    return node_pool_init(pool, sizeof(struct Node), nodes_per_chunk);
+}
+
+// Initializes the list by setting the head pointer to NULL.
+void list_init(struct Node **head_ptr) {
+    if (head_ptr != NULL) {
+        *head_ptr = NULL;
+    }
+}
+
+// Adds a new node with 'data' to the beginning of the list.
+void list_pool_prepend(struct NodePool *pool, struct Node **head_ptr, int data) {
+    if (head_ptr == NULL) return; // Safety check
+
+    struct Node* new_node = node_alloc(pool);
+    if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in list_prepend.\n");
+        return; // Consider other error handling?
+    }
+    new_node->data = data;
+    new_node->next = *head_ptr;
+    *head_ptr = new_node;
+}
+
+// Same as list_pool_prepend, allocating with malloc/free.
+void list_prepend(struct Node **head_ptr, int data) {
+    list_pool_prepend(NULL, head_ptr, data);
+}
+
+// Adds a new node with 'data' to the end of the list.
+void list_pool_append(struct NodePool *pool, struct Node **head_ptr, int data) {
+     if (head_ptr == NULL) return; // Safety check
+
+    struct Node* new_node = node_alloc(pool);
+     if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in list_append.\n");
+        return;
+    }
+    new_node->data = data;
+    new_node->next = NULL; // New last node points to NULL
+
+    // If the list is empty, the new node becomes the head
+    if (*head_ptr == NULL) {
+        *head_ptr = new_node;
+        return;
+    }
+
+    // Otherwise, traverse to the current last node
+    struct Node* last = *head_ptr;
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    // Link the new node after the current last node
+    last->next = new_node;
+}
+
+// Same as list_pool_append, allocating with malloc/free.
+void list_append(struct Node **head_ptr, int data) {
+    list_pool_append(NULL, head_ptr, data);
+}
+
+// Inserts a new node with 'data' at the specified 0-based position.
+// Returns true on success, false on failure.
+bool list_pool_insert_at(struct NodePool *pool, struct Node **head_ptr, int data, int position) {
+    if (head_ptr == NULL || position < 0) {
+        fprintf(stderr, "Error: Invalid arguments for list_insert_at.\n");
+        return false; // Invalid position or NULL head pointer address
+    }
+
+    // Handle insertion at the beginning (position 0)
+    if (position == 0) {
+        struct Node* new_node = node_alloc(pool);
+        if (new_node == NULL) {
+             fprintf(stderr, "Error: Memory allocation failed in list_insert_at.\n");
+             return false;
+        }
+        new_node->data = data;
+        new_node->next = *head_ptr;
+        *head_ptr = new_node;
+        return true;
+    }
+
+    // Traverse to the node *before* the desired insertion point
+    struct Node* current = *head_ptr;
+    for (int i = 0; i < position - 1 && current != NULL; i++) {
+        current = current->next;
+    }
+
+    // Check if position is out of bounds (current is NULL or current->next is needed for exact pos)
+    // If current is NULL, position was > list length
+    if (current == NULL) {
+        fprintf(stderr, "Error: Position %d out of bounds for list_insert_at.\n", position);
+        return false;
+    }
+
+    // Now insert after 'current'
+    struct Node* new_node = node_alloc(pool);
+     if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in list_insert_at.\n");
+        return false;
+    }
+    new_node->data = data;
+    new_node->next = current->next;
+    current->next = new_node;
+    return true;
+}
+
+// Same as list_pool_insert_at, allocating with malloc/free.
+bool list_insert_at(struct Node **head_ptr, int data, int position) {
+    return list_pool_insert_at(NULL, head_ptr, data, position);
+}
+
+// Deletes the first node from the list. Returns true if successful, false otherwise.
+bool list_pool_delete_first(struct NodePool *pool, struct Node **head_ptr) {
+    if (head_ptr == NULL || *head_ptr == NULL) {
+        // List is empty or invalid arguments
+        return false;
+    }
+
+    struct Node* temp = *head_ptr; // Node to be deleted
+    *head_ptr = (*head_ptr)->next; // Update head
+    node_release(pool, temp);                   // Free the old head
+    return true;
+}
+
+// Same as list_pool_delete_first, allocating with malloc/free.
+bool list_delete_first(struct Node **head_ptr) {
+    return list_pool_delete_first(NULL, head_ptr);
+}
+
+// Deletes the last node from the list. Returns true if successful, false otherwise.
+bool list_pool_delete_last(struct NodePool *pool, struct Node **head_ptr) {
+    if (head_ptr == NULL || *head_ptr == NULL) {
+        // List is empty or invalid arguments
+        return false;
+    }
+
+    // Handle list with only one node
+    if ((*head_ptr)->next == NULL) {
+        node_release(pool, *head_ptr);
+        *head_ptr = NULL;
+        return true;
+    }
+
+    // Traverse to the second-to-last node
+    struct Node* second_last = *head_ptr;
+    while (second_last->next->next != NULL) {
+        second_last = second_last->next;
+    }
+
+    // Free the last node and update the second-to-last node's next pointer
+    node_release(pool, second_last->next);
+    second_last->next = NULL;
+    return true;
+}
+
+// Same as list_pool_delete_last, allocating with malloc/free.
+bool list_delete_last(struct Node **head_ptr) {
+    return list_pool_delete_last(NULL, head_ptr);
+}
+
+// Deletes the node at the specified 0-based position.
+// Returns true on success, false on failure.
+bool list_pool_delete_at(struct NodePool *pool, struct Node **head_ptr, int position) {
+     if (head_ptr == NULL || *head_ptr == NULL || position < 0) {
+        // List empty, invalid args, or negative position
+        return false;
+    }
+
+    // Handle deletion of the first node (position 0)
+    if (position == 0) {
+        struct Node* temp = *head_ptr;
+        *head_ptr = (*head_ptr)->next;
+        node_release(pool, temp);
+        return true;
+    }
+
+    // Traverse to the node *before* the one to be deleted
+    struct Node* prev = *head_ptr;
+    for (int i = 0; i < position - 1 && prev->next != NULL; i++) {
+        prev = prev->next;
+    }
+
+    // Check if position is out of bounds (prev->next is the node to delete)
+    if (prev->next == NULL) {
+         fprintf(stderr, "Error: Position %d out of bounds for list_delete_at.\n", position);
+        return false;
+    }
+
+    // Delete the node after 'prev'
+    struct Node* node_to_delete = prev->next;
+    prev->next = node_to_delete->next; // Bypass the node
+    node_release(pool, node_to_delete);             // Free the node
+    return true;
+}
+
+// Same as list_pool_delete_at, allocating with malloc/free.
+bool list_delete_at(struct Node **head_ptr, int position) {
+    return list_pool_delete_at(NULL, head_ptr, position);
+}
+
+// Prints the elements of the list. (Takes Node*, not Node**)
+void list_print(struct Node *head) {
+    list_fprint(head, stdout, NULL);
+}
+
+// Layout used by list_print: "List: 1 -> 2 -> 3 -> NULL"
+static const struct FormatOptions list_print_layout = {
+    "List: ", " -> ", 1, "... -> ", "NULL\n", 0, 0
+};
+
+// Helper: renders the selected range of the list into 'sink' in one walk
+static void list_render(struct Node *head, struct FormatSink *sink, const struct FormatOptions *options) {
+    if (options == NULL) {
+        options = &list_print_layout;
+    }
+    struct Node* current = head;
+    for (size_t i = 0; i < options->start && current != NULL; i++) {
+        current = current->next;
+    }
+
+    format_begin(sink, options);
+    size_t shown = 0;
+    while (current != NULL && (options->limit == 0 || shown < options->limit)) {
+        format_element(sink, options, current->data, shown);
+        shown++;
+        current = current->next;
+    }
+    format_end(sink, options, shown, current != NULL);
+}
+
+// Formats the list into a caller buffer.
+size_t list_format(struct Node *head, char *buffer, size_t size, const struct FormatOptions *options) {
+    struct FormatSink sink;
+    format_sink_buffer(&sink, buffer, size);
+    list_render(head, &sink, options);
+    return format_finish(&sink);
+}
+
+// Prints the list to a stream in large writes.
+bool list_fprint(struct Node *head, FILE *out, const struct FormatOptions *options) {
+    if (out == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for list_fprint.\n");
+        return false;
+    }
+    char chunk[FORMAT_CHUNK_SIZE];
+    struct FormatSink sink;
+    format_sink_file(&sink, out, chunk, sizeof(chunk));
+    list_render(head, &sink, options);
+    return format_finish(&sink) == 1;
+}
+
+// Finds the first node containing 'value'. (Takes Node*)
+// Returns a pointer to the node if found, NULL otherwise.
+struct Node* list_find(struct Node *head, int value) {
+    STATS_TIMER_START(timer);
+    STATS_ONLY(size_t walked = 0;)
+    struct Node* current = head;
+    while (current != NULL && current->data != value) {
+        current = current->next;
+        STATS_ONLY(walked++;)
+    }
+    STATS_ADD(STATS_LIST_NODES_VISITED, walked + (current != NULL));
+    STATS_RECORD(STATS_HIST_LIST_FIND_LENGTH, walked + (current != NULL));
+    STATS_TIMER_STOP(timer, STATS_HIST_LIST_FIND_NS);
+    return current; // Pointer to the found node, NULL if not found
+}
+
+// Updates the data of the node at the specified 0-based position. (Takes Node*)
+// Returns true on success, false on failure.
+bool list_set_at(struct Node *head, int position, int new_value) {
+    if (position < 0) {
+        fprintf(stderr, "Error: Position cannot be negative for list_set_at.\n");
+        return false;
+    }
+
+    struct Node* current = head;
+    for (int i = 0; i < position && current != NULL; i++) {
+        current = current->next;
+    }
+
+    // Check if position is out of bounds
+    if (current == NULL) {
+        fprintf(stderr, "Error: Position %d out of bounds for list_set_at.\n", position);
+        return false;
+    }
+
+    // Update the data
+    current->data = new_value;
+    return true;
+}
+
+// Calculates and returns the number of nodes in the list. (Takes Node*)
+int list_length(struct Node *head) {
+    struct Node* current = head;
+    int length = 0;
+    while (current != NULL) {
+        length++;
+        current = current->next;
+    }
+    return length; // Return the calculated length
+}
+
+// Reverses the order of nodes in the list in-place.
+void list_reverse(struct Node **head_ptr) {
+    if (head_ptr == NULL || *head_ptr == NULL || (*head_ptr)->next == NULL) {
+        return; // Nothing to reverse (empty or single node list)
+    }
+
+    struct Node* prev = NULL;
+    struct Node* current = *head_ptr;
+    struct Node* next_node = NULL; // Renamed from 'next' to avoid confusion
+
+    while (current != NULL) {
+        next_node = current->next; // Store the next node
+        current->next = prev;     // Reverse the current node's pointer
+        prev = current;           // Move prev one step forward
+        current = next_node;      // Move current one step forward
+    }
+    *head_ptr = prev; // New head is the previous tail
+}
+
+// Frees all nodes in the list and sets the head pointer (via address) to NULL.
+void list_pool_destroy(struct NodePool *pool, struct Node **head_ptr) {
+     if (head_ptr == NULL) return; // Safety check
+
+    struct Node* current = *head_ptr;
+    struct Node* next_node;
+
+    while (current != NULL) {
+        next_node = current->next;
+        node_release(pool, current);
+        current = next_node;
+    }
+    *head_ptr = NULL; // Set the caller's head pointer to NULL
+}
+
+// Same as list_pool_destroy, allocating with malloc/free.
+void list_destroy(struct Node **head_ptr) {
+    list_pool_destroy(NULL, head_ptr);
+}
+
+
+// ----- LinkedList Handle API -----
+
+// Initializes an empty list that allocates with malloc/free.
+void linked_list_init(struct LinkedList *list) {
+    linked_list_init_pooled(list, NULL);
+}
+
+// Initializes an empty list backed by a node pool.
+void linked_list_init_pooled(struct LinkedList *list, struct NodePool *pool) {
+    if (list == NULL) return; // Safety check
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    list->pool = pool;
+}
+
+// Adds a node at the front in O(1).
+bool linked_list_prepend(struct LinkedList *list, int data) {
+    if (list == NULL) return false; // Safety check
+
+    struct Node* new_node = node_alloc(list->pool);
+    if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in linked_list_prepend.\n");
+        return false;
+    }
+    new_node->data = data;
+    new_node->next = list->head;
+    list->head = new_node;
+    if (list->tail == NULL) {
+        list->tail = new_node; // First node is also the last
+    }
+    list->length++;
+    return true;
+}
+
+// Adds a node at the back in O(1) using the cached tail.
+bool linked_list_append(struct LinkedList *list, int data) {
+    if (list == NULL) return false; // Safety check
+
+    struct Node* new_node = node_alloc(list->pool);
+    if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in linked_list_append.\n");
+        return false;
+    }
+    new_node->data = data;
+    new_node->next = NULL;
+    if (list->tail == NULL) {
+        list->head = new_node;
+    } else {
+        list->tail->next = new_node;
+    }
+    list->tail = new_node;
+    list->length++;
+    return true;
+}
+
+// Inserts at a 0-based position; the ends take the O(1) paths.
+bool linked_list_insert_at(struct LinkedList *list, int data, int position) {
+    if (list == NULL || position < 0 || position > list->length) {
+        fprintf(stderr, "Error: Position %d out of bounds for linked_list_insert_at.\n", position);
+        return false;
+    }
+    if (position == 0) {
+        return linked_list_prepend(list, data);
+    }
+    if (position == list->length) {
+        return linked_list_append(list, data);
+    }
+    if (!list_pool_insert_at(list->pool, &list->head, data, position)) {
+        return false; // Interior insert: the tail does not change
+    }
+    list->length++;
+    return true;
+}
+
+// Deletes the first node in O(1).
+bool linked_list_delete_first(struct LinkedList *list) {
+    if (list == NULL || !list_pool_delete_first(list->pool, &list->head)) {
+        return false;
+    }
+    list->length--;
+    if (list->head == NULL) {
+        list->tail = NULL;
+    }
+    return true;
+}
+
+// Deletes the last node (O(n) to find the new tail).
+bool linked_list_delete_last(struct LinkedList *list) {
+    if (list == NULL || list->length == 0) {
+        return false;
+    }
+    return linked_list_delete_at(list, list->length - 1);
+}
+
+// Deletes the node at a 0-based position.
+bool linked_list_delete_at(struct LinkedList *list, int position) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        return false; // Empty list, invalid args, or out of bounds
+    }
+    if (position == 0) {
+        return linked_list_delete_first(list);
+    }
+
+    // Walk to the node before the one being removed; it is the new tail if the last goes
+    struct Node* prev = list->head;
+    for (int i = 0; i < position - 1; i++) {
+        prev = prev->next;
+    }
+    struct Node* node_to_delete = prev->next;
+    prev->next = node_to_delete->next;
+    if (node_to_delete == list->tail) {
+        list->tail = prev;
+    }
+    node_release(list->pool, node_to_delete);
+    list->length--;
+    return true;
+}
+
+// Finds the first node containing 'value'.
+struct Node* linked_list_find(struct LinkedList *list, int value) {
+    if (list == NULL) return NULL; // Safety check
+    return list_find(list->head, value);
+}
+
+// Updates the node at a 0-based position; the last node is reached in O(1).
+bool linked_list_set_at(struct LinkedList *list, int position, int new_value) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        fprintf(stderr, "Error: Position %d out of bounds for linked_list_set_at.\n", position);
+        return false;
+    }
+    if (position == list->length - 1) {
+        list->tail->data = new_value;
+        return true;
+    }
+    return list_set_at(list->head, position, new_value);
+}
+
+// Returns the cached length.
+int linked_list_length(struct LinkedList *list) {
+    return (list == NULL) ? 0 : list->length;
+}
+
+// Checks the cached length.
+bool linked_list_is_empty(struct LinkedList *list) {
+    return list == NULL || list->length == 0;
+}
+
+// Reverses the chain; the old head becomes the tail.
+void linked_list_reverse(struct LinkedList *list) {
+    if (list == NULL) return; // Safety check
+    list->tail = list->head;
+    list_reverse(&list->head);
+}
+
+// Prints the elements of the list.
+void linked_list_print(struct LinkedList *list) {
+    list_print(list == NULL ? NULL : list->head);
+}
+
+// Frees all nodes and resets the handle to empty.
+void linked_list_destroy(struct LinkedList *list) {
+    if (list == NULL) return; // Safety check
+    list_pool_destroy(list->pool, &list->head);
+    list->tail = NULL;
+    list->length = 0;
+}
+
+
+// ----- Sorting and Relinking -----
+
+// Enough merge-sort bins for any list that fits in memory: bin k holds 2^k nodes.
+#define LIST_SORT_BINS 64
+
+// Helper: merges two sorted, NULL-terminated chains; 'a' wins ties, which keeps the sort
+// stable when 'a' holds the earlier nodes. Returns the head and stores the last node.
+static struct Node* merge_chains(struct Node *a, struct Node *a_tail, struct Node *b, struct Node *b_tail,
+                                 struct Node **tail_out) {
+    struct Node dummy; // Stand-in head, so the loop needs no "first node" branch
+    struct Node *tail = &dummy;
+    while (a != NULL && b != NULL) {
+        if (b->data < a->data) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    // One side is used up; the rest of the other is already in place
+    if (a != NULL) {
+        tail->next = a;
+        tail = a_tail;
+    } else if (b != NULL) {
+        tail->next = b;
+        tail = b_tail;
+    }
+    *tail_out = tail;
+    return dummy.next;
+}
+
+// Helper: bottom-up merge sort. Each node enters as a one-node run and is carried up
+// through the bins like a binary counter, so runs are merged in pairs of equal size
+// without recursion or walking to the middle of the list. Returns the head, stores the tail.
+static struct Node* sort_chain(struct Node *head, struct Node **tail_out) {
+    struct Node *bins[LIST_SORT_BINS] = { NULL };
+    struct Node *bin_tails[LIST_SORT_BINS] = { NULL };
+    int used = 0; // Bins above this are empty
+
+    while (head != NULL) {
+        struct Node *run = head;
+        struct Node *run_tail = head;
+        head = head->next;
+        run->next = NULL;
+        int k = 0;
+        while (k < LIST_SORT_BINS - 1 && bins[k] != NULL) {
+            run = merge_chains(bins[k], bin_tails[k], run, run_tail, &run_tail); // bins[k] is older
+            bins[k] = NULL;
+            k++;
+        }
+        if (bins[k] != NULL) {
+            run = merge_chains(bins[k], bin_tails[k], run, run_tail, &run_tail); // Top bin only grows
+        }
+        bins[k] = run;
+        bin_tails[k] = run_tail;
+        if (k >= used) {
+            used = k + 1;
+        }
+    }
+
+    // Combine the leftovers; higher bins hold earlier nodes
+    struct Node *result = NULL;
+    struct Node *result_tail = NULL;
+    for (int k = 0; k < used; k++) {
+        if (bins[k] != NULL) {
+            result = merge_chains(bins[k], bin_tails[k], result, result_tail, &result_tail);
+        }
+    }
+    *tail_out = result_tail;
+    return result;
+}
+
+// Helper: last node of a chain (NULL for an empty chain)
+static struct Node* chain_tail(struct Node *head) {
+    if (head == NULL) {
+        return NULL;
+    }
+    while (head->next != NULL) {
+        head = head->next;
+    }
+    return head;
+}
+
+// Sorts the list in place
+void list_sort(struct Node **head_ptr) {
+    if (head_ptr == NULL) return; // Safety check
+    struct Node *tail;
+    *head_ptr = sort_chain(*head_ptr, &tail);
+}
+
+// Merges *src_ptr into *dest_ptr
+void list_merge(struct Node **dest_ptr, struct Node **src_ptr) {
+    if (dest_ptr == NULL || src_ptr == NULL || *src_ptr == NULL) {
+        return; // Nothing to merge
+    }
+    struct Node *tail;
+    *dest_ptr = merge_chains(*dest_ptr, chain_tail(*dest_ptr), *src_ptr, chain_tail(*src_ptr), &tail);
+    *src_ptr = NULL;
+}
+
+// Helper: the link that points at 0-based 'position' (&head for 0); NULL if the list
+// is shorter than 'position'
+static struct Node** link_at(struct Node **head_ptr, int position) {
+    struct Node **link = head_ptr;
+    for (int i = 0; i < position; i++) {
+        if (*link == NULL) {
+            return NULL;
+        }
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+// Cuts the list in two at a 0-based position
+bool list_split_at(struct Node **head_ptr, int position, struct Node **rest_ptr) {
+    if (head_ptr == NULL || rest_ptr == NULL || position < 0) {
+        return false;
+    }
+    struct Node **link = link_at(head_ptr, position);
+    if (link == NULL) {
+        return false; // Out of bounds
+    }
+    *rest_ptr = *link;
+    *link = NULL;
+    return true;
+}
+
+// Appends *other_ptr (one walk to find the end of *head_ptr)
+void list_concat(struct Node **head_ptr, struct Node **other_ptr) {
+    list_splice_at(head_ptr, list_length(head_ptr == NULL ? NULL : *head_ptr), other_ptr);
+}
+
+// Links *other_ptr in at a 0-based position
+bool list_splice_at(struct Node **head_ptr, int position, struct Node **other_ptr) {
+    if (head_ptr == NULL || other_ptr == NULL || position < 0) {
+        return false;
+    }
+    struct Node **link = link_at(head_ptr, position);
+    if (link == NULL) {
+        return false; // Out of bounds
+    }
+    if (*other_ptr == NULL) {
+        return true; // Nothing to insert
+    }
+    struct Node *other_tail = chain_tail(*other_ptr);
+    other_tail->next = *link;
+    *link = *other_ptr;
+    *other_ptr = NULL;
+    return true;
+}
+
+// Helper: two handles may only exchange nodes when they share an allocator
+static bool same_allocator(struct LinkedList *a, struct LinkedList *b, const char *caller) {
+    if (a->pool != b->pool) {
+        fprintf(stderr, "Error: %s needs both lists to use the same node allocator.\n", caller);
+        return false;
+    }
+    return true;
+}
+
+// Helper: empties a handle whose nodes were moved elsewhere
+static void linked_list_clear(struct LinkedList *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+// Sorts the list in place; the sort reports the new tail
+void linked_list_sort(struct LinkedList *list) {
+    if (list == NULL) return; // Safety check
+    list->head = sort_chain(list->head, &list->tail);
+}
+
+// Merges 'src' into 'dest'; both tails are known, so there is no walk
+bool linked_list_merge(struct LinkedList *dest, struct LinkedList *src) {
+    if (dest == NULL || src == NULL || dest == src || !same_allocator(dest, src, "linked_list_merge")) {
+        return false;
+    }
+    if (src->head == NULL) {
+        return true;
+    }
+    dest->head = merge_chains(dest->head, dest->tail, src->head, src->tail, &dest->tail);
+    dest->length += src->length;
+    linked_list_clear(src);
+    return true;
+}
+
+// Moves the nodes from 'position' onward into the empty 'rest'
+bool linked_list_split_at(struct LinkedList *list, int position, struct LinkedList *rest) {
+    if (list == NULL || rest == NULL || list == rest || position < 0 || position > list->length) {
+        return false;
+    }
+    if (rest->head != NULL) {
+        fprintf(stderr, "Error: linked_list_split_at needs an empty list for the second half.\n");
+        return false;
+    }
+    rest->pool = list->pool;
+    if (position == list->length) {
+        return true; // Nothing moves
+    }
+    rest->tail = list->tail;
+    rest->length = list->length - position;
+    if (position == 0) {
+        rest->head = list->head;
+        linked_list_clear(list);
+        return true;
+    }
+    // Walk to the node before the cut; it becomes the new tail
+    struct Node *prev = list->head;
+    for (int i = 0; i < position - 1; i++) {
+        prev = prev->next;
+    }
+    rest->head = prev->next;
+    prev->next = NULL;
+    list->tail = prev;
+    list->length = position;
+    return true;
+}
+
+// Appends 'other' in O(1) through the cached tail
+bool linked_list_concat(struct LinkedList *list, struct LinkedList *other) {
+    if (list == NULL) {
+        return false;
+    }
+    return linked_list_splice_at(list, list->length, other);
+}
+
+// Links 'other' in at a 0-based position; the ends are O(1)
+bool linked_list_splice_at(struct LinkedList *list, int position, struct LinkedList *other) {
+    if (list == NULL || other == NULL || list == other || position < 0 || position > list->length) {
+        return false;
+    }
+    if (!same_allocator(list, other, "linked_list_splice_at")) {
+        return false;
+    }
+    if (other->head == NULL) {
+        return true;
+    }
+    if (position == list->length) {
+        if (list->tail == NULL) {
+            list->head = other->head;
+        } else {
+            list->tail->next = other->head;
+        }
+        list->tail = other->tail;
+    } else {
+        struct Node **link = link_at(&list->head, position);
+        other->tail->next = *link;
+        *link = other->head;
+    }
+    list->length += other->length;
+    linked_list_clear(other);
+    return true;
+}
+
+
+// ----- Cursors -----
+
+// Helper: puts a cursor on the first node of the chain
+static void cursor_start(struct ListCursor *cursor, struct Node **head_ptr, struct NodePool *pool,
+                         struct LinkedList *list) {
+    cursor->head_ptr = head_ptr;
+    cursor->prev = NULL;
+    cursor->current = (head_ptr == NULL) ? NULL : *head_ptr;
+    cursor->position = 0;
+    cursor->pool = pool;
+    cursor->list = list;
+}
+
+void list_cursor_init(struct ListCursor *cursor, struct Node **head_ptr) {
+    if (cursor == NULL) return; // Safety check
+    cursor_start(cursor, head_ptr, NULL, NULL);
+}
+
+void list_pool_cursor_init(struct ListCursor *cursor, struct NodePool *pool, struct Node **head_ptr) {
+    if (cursor == NULL) return; // Safety check
+    cursor_start(cursor, head_ptr, pool, NULL);
+}
+
+void linked_list_cursor_init(struct ListCursor *cursor, struct LinkedList *list) {
+    if (cursor == NULL) return; // Safety check
+    cursor_start(cursor, list == NULL ? NULL : &list->head, list == NULL ? NULL : list->pool, list);
+}
+
+bool list_cursor_valid(struct ListCursor *cursor) {
+    return cursor != NULL && cursor->current != NULL;
+}
+
+// Steps forward, remembering the node left behind for erase and past-the-end inserts
+bool list_cursor_next(struct ListCursor *cursor) {
+    if (!list_cursor_valid(cursor)) {
+        return false;
+    }
+    cursor->prev = cursor->current;
+    cursor->current = cursor->current->next;
+    cursor->position++;
+    return cursor->current != NULL;
+}
+
+int list_cursor_get(struct ListCursor *cursor) {
+    return list_cursor_valid(cursor) ? cursor->current->data : INT_MIN;
+}
+
+bool list_cursor_set(struct ListCursor *cursor, int value) {
+    if (!list_cursor_valid(cursor)) {
+        return false;
+    }
+    cursor->current->data = value;
+    return true;
+}
+
+// Links a new node in after the cursor (or at the end when past it)
+bool list_cursor_insert_after(struct ListCursor *cursor, int value) {
+    if (cursor == NULL || cursor->head_ptr == NULL) return false; // Safety check
+
+    struct Node* new_node = node_alloc(cursor->pool);
+    if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in list_cursor_insert_after.\n");
+        return false;
+    }
+    new_node->data = value;
+    struct Node* before = cursor->current;
+    if (before != NULL) {
+        new_node->next = before->next;
+        before->next = new_node;
+    } else {
+        // Past the end: append right where the cursor stands and stay past the end
+        new_node->next = NULL;
+        before = cursor->prev;
+        if (before == NULL) {
+            *cursor->head_ptr = new_node;
+        } else {
+            before->next = new_node;
+        }
+        cursor->prev = new_node;
+        cursor->position++;
+    }
+    if (cursor->list != NULL) {
+        if (cursor->list->tail == before) {
+            cursor->list->tail = new_node; // Inserted after the last node (or into an empty list)
+        }
+        cursor->list->length++;
+    }
+    return true;
+}
+
+// Unlinks the node under the cursor through the remembered previous node
+bool list_cursor_erase(struct ListCursor *cursor) {
+    if (!list_cursor_valid(cursor)) {
+        return false;
+    }
+    struct Node* node_to_delete = cursor->current;
+    if (cursor->prev == NULL) {
+        *cursor->head_ptr = node_to_delete->next;
+    } else {
+        cursor->prev->next = node_to_delete->next;
+    }
+    cursor->current = node_to_delete->next;
+    if (cursor->list != NULL) {
+        if (cursor->list->tail == node_to_delete) {
+            cursor->list->tail = cursor->prev;
+        }
+        cursor->list->length--;
+    }
+    node_release(cursor->pool, node_to_delete);
+    return true;
+}
+
+
+// ----- One-Pass Helpers -----
+
+void list_map(struct Node *head, ListMapFn fn, void *ctx) {
+    if (fn == NULL) return; // Safety check
+    for (struct Node* current = head; current != NULL; current = current->next) {
+        current->data = fn(current->data, ctx);
+    }
+}
+
+// Helper: unlinks rejected nodes in one walk over the links; reports the last kept node
+static int filter_chain(struct NodePool *pool, struct Node **head_ptr, ListPredicate keep, void *ctx,
+                        struct Node **last_kept) {
+    struct Node **link = head_ptr;
+    struct Node* last = NULL;
+    int removed = 0;
+    while (*link != NULL) {
+        struct Node* current = *link;
+        if (keep(current->data, ctx)) {
+            last = current;
+            link = &current->next;
+        } else {
+            *link = current->next;
+            node_release(pool, current);
+            removed++;
+        }
+    }
+    *last_kept = last;
+    return removed;
+}
+
+int list_pool_filter(struct NodePool *pool, struct Node **head_ptr, ListPredicate keep, void *ctx) {
+    if (head_ptr == NULL || keep == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for list_filter.\n");
+        return 0;
+    }
+    struct Node* last;
+    return filter_chain(pool, head_ptr, keep, ctx, &last);
+}
+
+int list_filter(struct Node **head_ptr, ListPredicate keep, void *ctx) {
+    return list_pool_filter(NULL, head_ptr, keep, ctx);
+}
+
+// The walk ends on the new tail, so the handle stays in sync for free
+int linked_list_filter(struct LinkedList *list, ListPredicate keep, void *ctx) {
+    if (list == NULL || keep == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for linked_list_filter.\n");
+        return 0;
+    }
+    int removed = filter_chain(list->pool, &list->head, keep, ctx, &list->tail);
+    list->length -= removed;
+    return removed;
+}
+
+long long list_fold(struct Node *head, long long init, ListFoldFn fn, void *ctx) {
+    if (fn == NULL) return init; // Safety check
+    long long acc = init;
+    for (struct Node* current = head; current != NULL; current = current->next) {
+        acc = fn(acc, current->data, ctx);
+    }
+    return acc;
+}
+
+
+// ----- Serialization -----
+
+// Writes the list in blocks of SERIAL_BLOCK_VALUES, gathered straight from the nodes.
+bool list_serialize(struct Node *head, struct SerialStream *stream, enum SerialEncoding encoding) {
+    if (stream == NULL || !serial_write_header(stream, SERIAL_KIND_LIST, encoding)) {
+        return false;
+    }
+    int block[SERIAL_BLOCK_VALUES];
+    size_t n = 0;
+    for (struct Node* current = head; current != NULL; current = current->next) {
+        block[n++] = current->data;
+        if (n == SERIAL_BLOCK_VALUES) {
+            if (!serial_write_block(stream, encoding, block, n)) {
+                return false;
+            }
+            n = 0;
+        }
+    }
+    if (n > 0 && !serial_write_block(stream, encoding, block, n)) {
+        return false;
+    }
+    return serial_write_block(stream, encoding, NULL, 0) == 1; // End block
+}
+
+// Helper: reads one serialized list into a detached chain (first..last, 'count' nodes).
+// On failure every node read so far is released and false is returned.
+static bool list_read_chain(struct NodePool *pool, struct SerialStream *stream,
+                            struct Node **first, struct Node **last, int *count) {
+    *first = NULL;
+    *last = NULL;
+    *count = 0;
+    enum SerialEncoding encoding;
+    if (stream == NULL || !serial_read_header(stream, SERIAL_KIND_LIST, &encoding)) {
+        return false;
+    }
+
+    int block[SERIAL_BLOCK_VALUES];
+    size_t n;
+    while ((n = serial_read_block(stream, encoding, block)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            struct Node* new_node = node_alloc(pool);
+            if (new_node == NULL) {
+                fprintf(stderr, "Error: Memory allocation failed in list_deserialize.\n");
+                list_pool_destroy(pool, first);
+                return false;
+            }
+            new_node->data = block[i];
+            new_node->next = NULL;
+            if (*last == NULL) {
+                *first = new_node;
+            } else {
+                (*last)->next = new_node;
+            }
+            *last = new_node;
+            (*count)++;
+        }
+    }
+    if (stream->error) {
+        list_pool_destroy(pool, first);
+        *last = NULL;
+        return false;
+    }
+    return true;
+}
+
+// Appends one serialized list to the list at *head_ptr.
+bool list_pool_deserialize(struct NodePool *pool, struct Node **head_ptr, struct SerialStream *stream) {
+    if (head_ptr == NULL) return false; // Safety check
+
+    struct Node *first, *last;
+    int count;
+    if (!list_read_chain(pool, stream, &first, &last, &count)) {
+        return false;
+    }
+    if (*head_ptr == NULL) {
+        *head_ptr = first;
+        return true;
+    }
+    struct Node* tail = *head_ptr;
+    while (tail->next != NULL) {
+        tail = tail->next;
+    }
+    tail->next = first;
+    return true;
+}
+
+// Same as list_pool_deserialize, allocating with malloc/free.
+bool list_deserialize(struct Node **head_ptr, struct SerialStream *stream) {
+    return list_pool_deserialize(NULL, head_ptr, stream);
+}
+
+// Writes the list behind the handle.
+bool linked_list_serialize(struct LinkedList *list, struct SerialStream *stream, enum SerialEncoding encoding) {
+    if (list == NULL) return false; // Safety check
+    return list_serialize(list->head, stream, encoding);
+}
+
+// Appends one serialized list after the cached tail.
+bool linked_list_deserialize(struct LinkedList *list, struct SerialStream *stream) {
+    if (list == NULL) return false; // Safety check
+
+    struct Node *first, *last;
+    int count;
+    if (!list_read_chain(list->pool, stream, &first, &last, &count)) {
+        return false;
+    }
+    if (first == NULL) {
+        return true; // Empty list was stored
+    }
+    if (list->tail == NULL) {
+        list->head = first;
+    } else {
+        list->tail->next = first;
+    }
+    list->tail = last;
+    list->length += count;
+    return true;
+}
@@ -1,65 +1,263 @@
-#ifndef LINKED_LIST_H // Include guard start
-#define LINKED_LIST_H
-
-#include <stdio.h>  // For standard types/prototypes if needed
-#include <stdlib.h> // For standard types/prototypes if needed
-#include <stdbool.h> // For bool return types (optional, can use int 0/1)
-
-// --- Structure Definitions ---
-
-// Node structure for the singly linked list
-struct Node {
-    int data;
-    struct Node *next;
-};
-
-// NOTE: Your current implementation manages the list directly via Node** head.
-// No separate LinkedList management struct is used, which is fine for this style.
-
-// --- Function Prototypes ---
-
-// Initializes the list by setting the head pointer (passed by address) to NULL.
-void list_init(struct Node **head_ptr);
-
-// Adds a new node with 'data' to the beginning of the list.
-void list_prepend(struct Node **head_ptr, int data);
-
-// Adds a new node with 'data' to the end of the list.
-void list_append(struct Node **head_ptr, int data);
-
-// Inserts a new node with 'data' at the specified 0-based position.
-// Returns true on success, false on failure (e.g., out of bounds, alloc fail).
-bool list_insert_at(struct Node **head_ptr, int data, int position); // Changed return
-
-// Deletes the first node from the list. Returns true if successful, false otherwise.
-bool list_delete_first(struct Node **head_ptr); // Changed return
-
-// Deletes the last node from the list. Returns true if successful, false otherwise.
-bool list_delete_last(struct Node **head_ptr); // Changed return
-
-// Deletes the node at the specified 0-based position.
-// Returns true on success, false on failure (e.g., out of bounds).
-bool list_delete_at(struct Node **head_ptr, int position); // Added this prototype, changed return
-
-// Prints the elements of the list.
-void list_print(struct Node *head); // Takes Node*, not Node**
-
-// Finds the first node containing 'value'.
-// Returns a pointer to the node if found, NULL otherwise.
-struct Node* list_find(struct Node *head, int value); // Changed signature and return
-
-// Updates the data of the node at the specified 0-based position.
-// Returns true on success, false on failure (e.g., out of bounds).
-bool list_set_at(struct Node *head, int position, int new_value); // Changed return
-
-// Calculates and returns the number of nodes in the list.
-int list_length(struct Node *head); // Changed return
-
-// Reverses the order of nodes in the list in-place.
-void list_reverse(struct Node **head_ptr);
-
-// Frees all nodes in the list and sets the head pointer (via address) to NULL.
-void list_destroy(struct Node **head_ptr);
-
-
+#ifndef LINKED_LIST_H // Include guard start
+#define LINKED_LIST_H
+
+#include <stdio.h>  // For standard types/prototypes if needed
+#include <stdlib.h> // For standard types/prototypes if needed
+#include <stdbool.h> // For bool return types (optional, can use int 0/1)
+#include <limits.h> // For INT_MIN returned by list_cursor_get
+#include "node_pool.h" // For pooled node allocation
+#include "serialize.h" // For the binary checkpoint format
+#include "format.h"    // For struct FormatOptions used by list_format/list_fprint
+
+// --- Structure Definitions ---
+
+// Node structure for the singly linked list
+struct Node {
+    int data;
+    struct Node *next;
+};
+
+// NOTE: The list_* functions manage the list directly via Node** head.
+// struct LinkedList (below) is an optional handle that also tracks the tail and length.
+
+// Handle for the linked_list_* API: append, length and emptiness checks are O(1).
+// 'head' is an ordinary chain, so the read-only list_* functions accept list.head too;
+// do not modify the chain with list_* functions or the cached tail/length go stale.
+struct LinkedList {
+    struct Node *head;
+    struct Node *tail;     // Last node, NULL when empty
+    int length;            // Number of nodes
+    struct NodePool *pool; // Node allocator, NULL means malloc/free
+};
+
+// --- Function Prototypes ---
+
+// Initializes the list by setting the head pointer (passed by address) to NULL.
+void list_init(struct Node **head_ptr);
+
+// Adds a new node with 'data' to the beginning of the list.
+void list_prepend(struct Node **head_ptr, int data);
+
+// Adds a new node with 'data' to the end of the list.
+void list_append(struct Node **head_ptr, int data);
+
+// Inserts a new node with 'data' at the specified 0-based position.
+// Returns true on success, false on failure (e.g., out of bounds, alloc fail).
+bool list_insert_at(struct Node **head_ptr, int data, int position); // Changed return
+
+// Deletes the first node from the list. Returns true if successful, false otherwise.
+bool list_delete_first(struct Node **head_ptr); // Changed return
+
+// Deletes the last node from the list. Returns true if successful, false otherwise.
+bool list_delete_last(struct Node **head_ptr); // Changed return
+
+// Deletes the node at the specified 0-based position.
+// Returns true on success, false on failure (e.g., out of bounds).
+bool list_delete_at(struct Node **head_ptr, int position); // Added this prototype, changed return
+
+// Prints the elements of the list.
+void list_print(struct Node *head); // Takes Node*, not Node**
+
+// Renders the elements into 'buffer' without printf or allocation, snprintf-style: at most
+// size - 1 characters plus a terminator, returning the length the full text needs.
+// NULL options gives the list_print layout; see format.h for ranges and separators.
+size_t list_format(struct Node *head, char *buffer, size_t size, const struct FormatOptions *options);
+
+// Same text as list_format, written to 'out' in FORMAT_CHUNK_SIZE pieces.
+// Returns true on success, false if a write failed.
+bool list_fprint(struct Node *head, FILE *out, const struct FormatOptions *options);
+
+// Finds the first node containing 'value'.
+// Returns a pointer to the node if found, NULL otherwise.
+struct Node* list_find(struct Node *head, int value); // Changed signature and return
+
+// Updates the data of the node at the specified 0-based position.
+// Returns true on success, false on failure (e.g., out of bounds).
+bool list_set_at(struct Node *head, int position, int new_value); // Changed return
+
+// Calculates and returns the number of nodes in the list.
+int list_length(struct Node *head); // Changed return
+
+// Reverses the order of nodes in the list in-place.
+void list_reverse(struct Node **head_ptr);
+
+// Frees all nodes in the list and sets the head pointer (via address) to NULL.
+void list_destroy(struct Node **head_ptr);
+
+
+// --- Pooled Variants ---
+// Same behavior as the functions above, but nodes come from (and go back to) 'pool'
+// instead of malloc/free, so allocation is a free-list pop or pointer bump.
+// Passing NULL for 'pool' falls back to malloc/free. Every node of a list must use the
+// same allocator. With a pool dedicated to one list, the whole list can be dropped in
+// O(chunks) with node_pool_destroy (or node_pool_reset) followed by list_init.
+
+// Initializes 'pool' for struct Node allocations (0 for nodes_per_chunk means default).
+int list_pool_init(struct NodePool *pool, size_t nodes_per_chunk);
+
+void list_pool_prepend(struct NodePool *pool, struct Node **head_ptr, int data);
+void list_pool_append(struct NodePool *pool, struct Node **head_ptr, int data);
+bool list_pool_insert_at(struct NodePool *pool, struct Node **head_ptr, int data, int position);
+bool list_pool_delete_first(struct NodePool *pool, struct Node **head_ptr);
+bool list_pool_delete_last(struct NodePool *pool, struct Node **head_ptr);
+bool list_pool_delete_at(struct NodePool *pool, struct Node **head_ptr, int position);
+
+// Returns every node to the pool (no free calls) and sets the head pointer to NULL.
+void list_pool_destroy(struct NodePool *pool, struct Node **head_ptr);
+
+
+// --- LinkedList Handle API ---
+// Parallel to the list_* functions, with the same 0-based positions and return values.
+
+// Initializes an empty list that allocates with malloc/free.
+void linked_list_init(struct LinkedList *list);
+
+// Initializes an empty list whose nodes come from 'pool' (see list_pool_init).
+void linked_list_init_pooled(struct LinkedList *list, struct NodePool *pool);
+
+// Adds a node at the front / back. Both are O(1). Return true on success.
+bool linked_list_prepend(struct LinkedList *list, int data);
+bool linked_list_append(struct LinkedList *list, int data);
+
+// Inserts at a 0-based position (position == length appends in O(1)).
+bool linked_list_insert_at(struct LinkedList *list, int data, int position);
+
+// Deletes the first node (O(1)) / last node (O(n): a singly linked list has to find
+// the new tail) / node at a 0-based position.
+bool linked_list_delete_first(struct LinkedList *list);
+bool linked_list_delete_last(struct LinkedList *list);
+bool linked_list_delete_at(struct LinkedList *list, int position);
+
+// Finds the first node containing 'value', NULL if absent.
+struct Node* linked_list_find(struct LinkedList *list, int value);
+
+// Updates the node at a 0-based position. Returns true on success.
+bool linked_list_set_at(struct LinkedList *list, int position, int new_value);
+
+// O(1) size queries.
+int linked_list_length(struct LinkedList *list);
+bool linked_list_is_empty(struct LinkedList *list);
+
+// Reverses the list in-place (the head becomes the tail).
+void linked_list_reverse(struct LinkedList *list);
+
+// Prints the elements of the list.
+void linked_list_print(struct LinkedList *list);
+
+// Frees all nodes and leaves the list empty (and still usable). Does NOT free the struct.
+void linked_list_destroy(struct LinkedList *list);
+
+
+// --- Sorting and Relinking ---
+// These only rewire 'next' pointers: no node is allocated, freed or copied, so they cost
+// the same whether nodes come from malloc or a pool. Nodes that move between lists must
+// keep being released through the same allocator, so both lists have to use the same one
+// (the handle versions check this and return false otherwise).
+
+// Sorts ascending with a bottom-up merge sort: O(n log n) comparisons, O(1) extra space,
+// stable (equal values keep their order).
+void list_sort(struct Node **head_ptr);
+
+// Merges the sorted list *src_ptr into the sorted list *dest_ptr in O(n + m), leaving
+// *src_ptr empty. Stable: on ties the nodes of *dest_ptr come first.
+void list_merge(struct Node **dest_ptr, struct Node **src_ptr);
+
+// Moves the nodes from 0-based 'position' onward into *rest_ptr (which is overwritten, so
+// pass an empty list); the first 'position' nodes stay. position == length leaves *rest_ptr
+// empty. Returns false if 'position' is out of bounds.
+bool list_split_at(struct Node **head_ptr, int position, struct Node **rest_ptr);
+
+// Appends all of *other_ptr to the end of *head_ptr and leaves *other_ptr empty.
+void list_concat(struct Node **head_ptr, struct Node **other_ptr);
+
+// Inserts all of *other_ptr so its first node lands at 0-based 'position' (0 to length)
+// and leaves *other_ptr empty. Returns false if 'position' is out of bounds.
+bool list_splice_at(struct Node **head_ptr, int position, struct Node **other_ptr);
+
+// Handle versions. They keep tail and length right, so concat and merge-at-the-end need
+// no walk; 'rest' for linked_list_split_at must be empty and takes over list's allocator.
+void linked_list_sort(struct LinkedList *list);
+bool linked_list_merge(struct LinkedList *dest, struct LinkedList *src);
+bool linked_list_split_at(struct LinkedList *list, int position, struct LinkedList *rest);
+bool linked_list_concat(struct LinkedList *list, struct LinkedList *other);
+bool linked_list_splice_at(struct LinkedList *list, int position, struct LinkedList *other);
+
+
+// --- Cursors ---
+// A cursor remembers where it is in the chain (and the node before it), so stepping,
+// reading, writing, inserting after and erasing at the cursor are all O(1). A loop like
+// "for i in 0..n: list_set_at(head, i, ...)" walks the list n times; with a cursor it
+// walks it once. Changing the list other than through the cursor invalidates it.
+
+struct ListCursor {
+    struct Node **head_ptr;   // Chain being walked
+    struct Node *prev;        // Node before 'current', NULL at the front
+    struct Node *current;     // Node under the cursor, NULL once past the end
+    int position;             // 0-based position of 'current'
+    struct NodePool *pool;    // Allocator for inserted/erased nodes, NULL means malloc/free
+    struct LinkedList *list;  // Handle kept in sync (tail, length), NULL for bare chains
+};
+
+// Places the cursor on the first node of a bare chain / pooled chain / handle.
+void list_cursor_init(struct ListCursor *cursor, struct Node **head_ptr);
+void list_pool_cursor_init(struct ListCursor *cursor, struct NodePool *pool, struct Node **head_ptr);
+void linked_list_cursor_init(struct ListCursor *cursor, struct LinkedList *list);
+
+// True while the cursor is on a node (false once it has moved past the last one).
+bool list_cursor_valid(struct ListCursor *cursor);
+
+// Moves to the next node. Returns true if the cursor is still on a node.
+bool list_cursor_next(struct ListCursor *cursor);
+
+// Reads / updates the node under the cursor. list_cursor_get returns INT_MIN past the end.
+int list_cursor_get(struct ListCursor *cursor);
+bool list_cursor_set(struct ListCursor *cursor, int value);
+
+// Inserts a node after the one under the cursor; the cursor does not move. Past the end
+// (including on an empty list) the node is appended and the cursor stays past the end,
+// so repeated calls append in order. Returns true on success.
+bool list_cursor_insert_after(struct ListCursor *cursor, int value);
+
+// Deletes the node under the cursor and moves the cursor onto the node that followed it
+// (same position). Returns false past the end.
+bool list_cursor_erase(struct ListCursor *cursor);
+
+
+// --- One-Pass Helpers ---
+// Each visits every node exactly once, in list order, passing 'ctx' through.
+
+typedef int (*ListMapFn)(int value, void *ctx);                    // Returns the new value
+typedef bool (*ListPredicate)(int value, void *ctx);               // Returns true to keep
+typedef long long (*ListFoldFn)(long long acc, int value, void *ctx); // Returns the new total
+
+// Replaces every value with fn(value, ctx).
+void list_map(struct Node *head, ListMapFn fn, void *ctx);
+
+// Deletes the nodes for which keep(value, ctx) is false, keeping the order of the rest.
+// Returns the number of nodes deleted.
+int list_filter(struct Node **head_ptr, ListPredicate keep, void *ctx);
+int list_pool_filter(struct NodePool *pool, struct Node **head_ptr, ListPredicate keep, void *ctx);
+int linked_list_filter(struct LinkedList *list, ListPredicate keep, void *ctx);
+
+// Returns fn(...fn(fn(init, v0, ctx), v1, ctx)..., vn-1, ctx).
+long long list_fold(struct Node *head, long long init, ListFoldFn fn, void *ctx);
+
+
+// --- Serialization ---
+// Binary checkpoints in the block format of serialize.h, to a file descriptor or a memory
+// buffer. Values are written and read one block at a time, never as a second full copy.
+
+// Writes the values in list order. Returns true on success.
+bool list_serialize(struct Node *head, struct SerialStream *stream, enum SerialEncoding encoding);
+
+// Reads one serialized list and appends its values to the list. All or nothing: on a
+// malformed or truncated stream the list is left unchanged and false is returned.
+bool list_pool_deserialize(struct NodePool *pool, struct Node **head_ptr, struct SerialStream *stream);
+bool list_deserialize(struct Node **head_ptr, struct SerialStream *stream);
+
+// Handle versions; deserializing appends in O(1) after the cached tail.
+bool linked_list_serialize(struct LinkedList *list, struct SerialStream *stream, enum SerialEncoding encoding);
+bool linked_list_deserialize(struct LinkedList *list, struct SerialStream *stream);
+
+
 #endif // LINKED_LIST_H // Include guard end
\ No newline at end of file
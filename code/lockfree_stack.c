@@ -0,0 +1,100 @@
+#include "lockfree_stack.h" // Include the header file
+#include <stdio.h>          // For fprintf, stderr
+#include <stdlib.h>         // For malloc, free
+
+// 'next' of a published node can be read by one thread while another thread that
+// recycled the node writes it, so every access goes through relaxed atomic builtins.
+#define LOAD_NEXT(node) __atomic_load_n(&(node)->next, __ATOMIC_RELAXED)
+#define STORE_NEXT(node, value) __atomic_store_n(&(node)->next, (value), __ATOMIC_RELAXED)
+
+// Helper: pushes 'node' onto a tagged list
+static void tagged_push(_Atomic struct TaggedNode *list, struct StackNode *node) {
+    struct TaggedNode old = atomic_load_explicit(list, memory_order_relaxed);
+    struct TaggedNode desired;
+    do {
+        STORE_NEXT(node, old.node);
+        desired.node = node;
+        desired.tag = old.tag + 1;
+    } while (!atomic_compare_exchange_weak_explicit(list, &old, desired,
+                                                    memory_order_release, memory_order_relaxed));
+}
+
+// Helper: pops a node from a tagged list, NULL if it is empty
+static struct StackNode *tagged_pop(_Atomic struct TaggedNode *list) {
+    struct TaggedNode old = atomic_load_explicit(list, memory_order_acquire);
+    struct TaggedNode desired;
+    do {
+        if (old.node == NULL) {
+            return NULL;
+        }
+        // May read a node another thread just took; the tag makes our CAS fail in that case
+        desired.node = LOAD_NEXT(old.node);
+        desired.tag = old.tag + 1;
+    } while (!atomic_compare_exchange_weak_explicit(list, &old, desired,
+                                                    memory_order_acquire, memory_order_acquire));
+    return old.node;
+}
+
+// Initializes an empty stack
+void lockfree_stack_init(struct LockFreeStack *s) {
+    if (s == NULL) return; // Robustness check
+    struct TaggedNode empty = { NULL, 0 };
+    atomic_init(&s->top, empty);
+    atomic_init(&s->free_list, empty);
+    atomic_init(&s->allocated, 0);
+}
+
+// Pushes data, reusing a recycled node when one is available
+bool lockfree_stack_push(struct LockFreeStack *s, int data) {
+    if (s == NULL) return false; // Robustness check
+
+    struct StackNode *newNode = tagged_pop(&s->free_list);
+    if (newNode == NULL) {
+        newNode = (struct StackNode *)malloc(sizeof(struct StackNode));
+        if (newNode == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed in lockfree_stack_push.\n");
+            return false;
+        }
+        atomic_fetch_add_explicit(&s->allocated, 1, memory_order_relaxed);
+    }
+    newNode->data = data; // Node is private to this thread until the CAS publishes it
+    tagged_push(&s->top, newNode);
+    return true;
+}
+
+// Pops the top element
+bool lockfree_stack_pop(struct LockFreeStack *s, int *out) {
+    if (s == NULL || out == NULL) return false; // Robustness check
+
+    struct StackNode *node_to_remove = tagged_pop(&s->top);
+    if (node_to_remove == NULL) {
+        return false; // Stack was empty
+    }
+    *out = node_to_remove->data; // Safe: the winning CAS made the node ours
+    tagged_push(&s->free_list, node_to_remove);
+    return true;
+}
+
+// Checks if the stack is empty right now
+int lockfree_stack_is_empty(struct LockFreeStack *s) {
+    if (s == NULL) return 1; // Treat NULL as empty, like stack_is_empty
+    struct TaggedNode top = atomic_load_explicit(&s->top, memory_order_acquire);
+    return top.node == NULL;
+}
+
+// Helper: frees a whole chain (single-threaded)
+static void free_chain(struct StackNode *current) {
+    while (current != NULL) {
+        struct StackNode *next_node = current->next;
+        free(current);
+        current = next_node;
+    }
+}
+
+// Frees live and recycled nodes
+void lockfree_stack_destroy(struct LockFreeStack *s) {
+    if (s == NULL) return; // Robustness check
+    free_chain(atomic_load(&s->top).node);
+    free_chain(atomic_load(&s->free_list).node);
+    lockfree_stack_init(s);
+}
@@ -0,0 +1,57 @@
+#ifndef LOCKFREE_STACK_H // Include guard start
+#define LOCKFREE_STACK_H
+
+#include <stdatomic.h> // For _Atomic
+#include <stdbool.h>   // For bool return types
+#include <stddef.h>    // For size_t
+#include <stdint.h>    // For uintptr_t
+
+#include "stack.h"     // Reuses struct StackNode for the nodes
+
+// --- Structure Definitions ---
+
+// Multi-producer/multi-consumer lock-free stack (Treiber stack) built on C11 atomics.
+// Any number of threads may push and pop concurrently without a mutex.
+//
+// ABA protection: 'top' is a pointer plus a version tag swapped together by one
+// double-width compare-and-swap, so a node that was popped and pushed back between a
+// thread's read and its CAS changes the tag and the stale CAS fails.
+// Safe reclamation: popped nodes are not freed but go onto a (also tagged) free list and
+// are reused by later pushes. A slow thread may still read 'next' of a node that was
+// popped meanwhile; that memory stays valid until lockfree_stack_destroy.
+// Link with -latomic for the 16-byte atomics.
+
+// Pointer and version counter updated as one unit
+struct TaggedNode {
+    struct StackNode *node;
+    uintptr_t tag;
+};
+
+struct LockFreeStack {
+    _Alignas(64) _Atomic struct TaggedNode top;       // Own cache line: the hot spot
+    _Alignas(64) _Atomic struct TaggedNode free_list; // Recycled nodes
+    _Alignas(64) atomic_size_t allocated;             // Nodes obtained from malloc so far
+};
+
+
+// --- Function Prototypes ---
+
+// Initializes an empty stack. Not thread-safe: call before sharing the stack.
+void lockfree_stack_init(struct LockFreeStack *s);
+
+// Pushes 'data'. Safe to call from any thread. Returns false if a node could not be allocated.
+bool lockfree_stack_push(struct LockFreeStack *s, int data);
+
+// Pops the top element into '*out'. Safe to call from any thread.
+// Returns false (leaving '*out' untouched) if the stack was empty.
+bool lockfree_stack_pop(struct LockFreeStack *s, int *out);
+
+// Returns 1 if the stack was empty at the moment of the check, 0 otherwise.
+int lockfree_stack_is_empty(struct LockFreeStack *s);
+
+// Frees every node, including recycled ones. Not thread-safe: all other threads must
+// be done with the stack. Does NOT free the LockFreeStack struct itself.
+void lockfree_stack_destroy(struct LockFreeStack *s);
+
+
+#endif // LOCKFREE_STACK_H // Include guard end
@@ -0,0 +1,110 @@
+#include "node_pool.h" // Include the header file
+#include <stdio.h>     // For fprintf
+#include <stdlib.h>    // For malloc, free
+#include <stddef.h>    // For max_align_t
+#include "stats.h"     // Counters (compiled in with -DDS_STATS)
+
+// Node slots start this far into a chunk, so every node is suitably aligned
+#define CHUNK_HEADER_SIZE \
+    ((sizeof(struct PoolChunk) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+// Initializes the pool (no memory is allocated yet)
+int node_pool_init(struct NodePool *pool, size_t node_size, size_t nodes_per_chunk) {
+    if (pool == NULL || node_size == 0) {
+        fprintf(stderr, "Error: Invalid arguments for node_pool_init.\n");
+        return 0;
+    }
+
+    // Every node must be able to hold the free-list link and stay aligned
+    if (node_size < sizeof(void *)) {
+        node_size = sizeof(void *);
+    }
+    size_t align = _Alignof(max_align_t);
+    pool->node_size = (node_size + align - 1) / align * align;
+    pool->nodes_per_chunk = nodes_per_chunk > 0 ? nodes_per_chunk : NODE_POOL_DEFAULT_CHUNK;
+    pool->chunks = NULL;
+    pool->spare = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->free_list = NULL;
+    pool->live = 0;
+    return 1;
+}
+
+// Helper: makes a fresh chunk the bump region, reusing a spare one if available
+static int add_chunk(struct NodePool *pool) {
+    struct PoolChunk *chunk = pool->spare;
+    if (chunk != NULL) {
+        pool->spare = chunk->next;
+    } else {
+        chunk = malloc(CHUNK_HEADER_SIZE + pool->node_size * pool->nodes_per_chunk);
+        if (chunk == NULL) {
+            return 0;
+        }
+        STATS_ADD(STATS_POOL_CHUNKS_ALLOCATED, 1);
+    }
+    chunk->next = pool->chunks;
+    pool->chunks = chunk;
+    pool->bump = (char *)chunk + CHUNK_HEADER_SIZE;
+    pool->bump_end = pool->bump + pool->node_size * pool->nodes_per_chunk;
+    return 1;
+}
+
+// Hands out a node: recycled ones first, then the next slot of the current chunk
+void *node_pool_alloc(struct NodePool *pool) {
+    void *node = pool->free_list;
+    if (node != NULL) {
+        pool->free_list = *(void **)node; // Pop from the free list
+    } else {
+        if (pool->bump == pool->bump_end && !add_chunk(pool)) {
+            fprintf(stderr, "Error: Memory allocation failed in node_pool_alloc.\n");
+            return NULL;
+        }
+        node = pool->bump;
+        pool->bump += pool->node_size;
+    }
+    pool->live++;
+    return node;
+}
+
+// Pushes a node onto the free list
+void node_pool_free(struct NodePool *pool, void *node) {
+    if (node == NULL) {
+        return;
+    }
+    *(void **)node = pool->free_list;
+    pool->free_list = node;
+    pool->live--;
+}
+
+// Drops all nodes but keeps the chunks for the next allocations
+void node_pool_reset(struct NodePool *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    while (pool->chunks != NULL) {
+        struct PoolChunk *chunk = pool->chunks;
+        pool->chunks = chunk->next;
+        chunk->next = pool->spare;
+        pool->spare = chunk;
+    }
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->free_list = NULL;
+    pool->live = 0;
+}
+
+// Frees every chunk
+void node_pool_destroy(struct NodePool *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    node_pool_reset(pool); // Moves everything onto the spare list
+    struct PoolChunk *chunk = pool->spare;
+    while (chunk != NULL) {
+        struct PoolChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    pool->spare = NULL;
+}
@@ -0,0 +1,53 @@
+#ifndef NODE_POOL_H // Include guard start
+#define NODE_POOL_H
+
+#include <stddef.h> // For size_t
+
+// --- Structure Definitions ---
+
+// Fixed-size node allocator. Nodes are carved out of large chunks by bumping a pointer,
+// freed nodes go on a free list and are handed out again first, and the chunks are only
+// returned to the system when the pool is destroyed. One pool can back one list (nodes
+// then sit next to each other in memory) or be shared by several lists.
+
+// Number of nodes per chunk when node_pool_init gets 0.
+#define NODE_POOL_DEFAULT_CHUNK 1024
+
+// Header placed in front of every chunk
+struct PoolChunk {
+    struct PoolChunk *next;
+};
+
+struct NodePool {
+    size_t node_size;         // Bytes per node (rounded up for alignment)
+    size_t nodes_per_chunk;   // Nodes carved from each chunk
+    struct PoolChunk *chunks; // Chunks in use, newest first
+    struct PoolChunk *spare;  // Chunks kept by node_pool_reset, reused before malloc
+    char *bump;               // Next never-used node in the newest chunk
+    char *bump_end;           // End of the newest chunk
+    void *free_list;          // Recycled nodes, linked through their first bytes
+    size_t live;              // Nodes currently handed out
+};
+
+
+// --- Function Prototypes ---
+
+// Initializes a pool for nodes of 'node_size' bytes (0 for nodes_per_chunk means default).
+// No memory is allocated until the first node_pool_alloc. Returns 1 on success, 0 on failure.
+int node_pool_init(struct NodePool *pool, size_t node_size, size_t nodes_per_chunk);
+
+// Returns an uninitialized node, or NULL if a new chunk could not be allocated.
+void *node_pool_alloc(struct NodePool *pool);
+
+// Gives a node back to the pool for reuse. The node must come from this pool.
+void node_pool_free(struct NodePool *pool, void *node);
+
+// Forgets every node at once (O(chunks)); chunks are kept for reuse.
+// Any pointer previously handed out becomes invalid.
+void node_pool_reset(struct NodePool *pool);
+
+// Frees all chunks (O(chunks), no per-node work). Does NOT free the NodePool struct itself.
+void node_pool_destroy(struct NodePool *pool);
+
+
+#endif // NODE_POOL_H // Include guard end
@@ -0,0 +1,252 @@
+#define _POSIX_C_SOURCE 200112L // For read, write
+#include "serialize.h" // Include the header file
+#include <stdio.h>     // For fprintf
+#include <string.h>    // For memcpy, memcmp
+#include <stdint.h>    // For uint32_t, SIZE_MAX
+#include <errno.h>     // For EINTR
+#include <unistd.h>    // For read, write
+
+#define SERIAL_MAGIC "DSSR"
+
+// Largest encoded block: header plus every value at its worst-case varint length
+#define SERIAL_MAX_PAYLOAD (SERIAL_BLOCK_VALUES * SERIAL_MAX_VARINT)
+
+// Helper: marks the stream as failed and reports why. Always returns 0.
+static int serial_fail(struct SerialStream *stream, const char *reason) {
+    if (!stream->error) {
+        fprintf(stderr, "Error: %s\n", reason);
+    }
+    stream->error = 1;
+    return 0;
+}
+
+// Helper: stores / loads a 32-bit value in little-endian order.
+static void put_u32(unsigned char *out, uint32_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+static uint32_t get_u32(const unsigned char *in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+// Helper: zigzag maps small negative and positive numbers to small unsigned ones
+// (0, -1, 1, -2 ... -> 0, 1, 2, 3 ...) so they varint-encode in few bytes.
+static uint32_t zigzag_encode(uint32_t value) {
+    return (value << 1) ^ (uint32_t)-(int32_t)(value >> 31);
+}
+
+static uint32_t zigzag_decode(uint32_t value) {
+    return (value >> 1) ^ (uint32_t)-(int32_t)(value & 1);
+}
+
+// Helper: writes all 'n' bytes to the stream's target. Returns 1 on success.
+static int serial_write_bytes(struct SerialStream *stream, const unsigned char *bytes, size_t n) {
+    if (stream->error) {
+        return 0;
+    }
+    if (stream->fd < 0) {
+        if (n > stream->size - stream->pos) {
+            return serial_fail(stream, "Serialization buffer is too small.");
+        }
+        memcpy(stream->buffer + stream->pos, bytes, n);
+        stream->pos += n;
+        return 1;
+    }
+    size_t done = 0;
+    while (done < n) {
+        ssize_t written = write(stream->fd, bytes + done, n - done);
+        if (written < 0 && errno == EINTR) {
+            continue; // Interrupted before anything was written, try again
+        }
+        if (written <= 0) {
+            return serial_fail(stream, "Write failed while serializing.");
+        }
+        done += (size_t)written;
+    }
+    stream->pos += n;
+    return 1;
+}
+
+// Helper: reads exactly 'n' bytes from the stream's source. Returns 1 on success.
+static int serial_read_bytes(struct SerialStream *stream, unsigned char *bytes, size_t n) {
+    if (stream->error) {
+        return 0;
+    }
+    if (stream->fd < 0) {
+        if (n > stream->size - stream->pos) {
+            return serial_fail(stream, "Serialized data is truncated.");
+        }
+        memcpy(bytes, stream->buffer + stream->pos, n);
+        stream->pos += n;
+        return 1;
+    }
+    size_t done = 0;
+    while (done < n) {
+        ssize_t got = read(stream->fd, bytes + done, n - done);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got < 0) {
+            return serial_fail(stream, "Read failed while deserializing.");
+        }
+        if (got == 0) {
+            return serial_fail(stream, "Serialized data is truncated.");
+        }
+        done += (size_t)got;
+    }
+    stream->pos += n;
+    return 1;
+}
+
+// Sets the stream up for a file descriptor
+void serial_stream_fd(struct SerialStream *stream, int fd) {
+    stream->fd = fd;
+    stream->buffer = NULL;
+    stream->size = 0;
+    stream->pos = 0;
+    stream->error = 0;
+}
+
+// Sets the stream up for a memory buffer
+void serial_stream_buffer(struct SerialStream *stream, void *buffer, size_t size) {
+    stream->fd = -1;
+    stream->buffer = buffer;
+    stream->size = (buffer != NULL) ? size : 0;
+    stream->pos = 0;
+    stream->error = 0;
+}
+
+// Header, full blocks, one partial block and the end block, all at worst case
+size_t serial_max_size(size_t count) {
+    size_t blocks = count / SERIAL_BLOCK_VALUES + 1;
+    if (count > (SIZE_MAX - SERIAL_HEADER_SIZE) / (SERIAL_MAX_VARINT + SERIAL_BLOCK_HEADER_SIZE) - 1) {
+        return SIZE_MAX; // Cannot be represented; no buffer will be large enough anyway
+    }
+    return SERIAL_HEADER_SIZE + (blocks + 1) * SERIAL_BLOCK_HEADER_SIZE + count * SERIAL_MAX_VARINT;
+}
+
+int serial_write_header(struct SerialStream *stream, enum SerialKind kind, enum SerialEncoding encoding) {
+    unsigned char header[SERIAL_HEADER_SIZE];
+    memcpy(header, SERIAL_MAGIC, 4);
+    header[4] = SERIAL_FORMAT_VERSION;
+    header[5] = (unsigned char)kind;
+    header[6] = (unsigned char)encoding;
+    header[7] = 0;
+    return serial_write_bytes(stream, header, sizeof(header));
+}
+
+int serial_read_header(struct SerialStream *stream, enum SerialKind kind, enum SerialEncoding *encoding) {
+    unsigned char header[SERIAL_HEADER_SIZE];
+    if (!serial_read_bytes(stream, header, sizeof(header))) {
+        return 0;
+    }
+    if (memcmp(header, SERIAL_MAGIC, 4) != 0) {
+        return serial_fail(stream, "Stream does not hold serialized data.");
+    }
+    if (header[4] != SERIAL_FORMAT_VERSION) {
+        return serial_fail(stream, "Serialized data has an unsupported format version.");
+    }
+    if (header[5] != (unsigned char)kind) {
+        return serial_fail(stream, "Serialized data holds a different kind of container.");
+    }
+    if (header[6] > SERIAL_DELTA_VARINT) {
+        return serial_fail(stream, "Serialized data uses an unknown encoding.");
+    }
+    *encoding = (enum SerialEncoding)header[6];
+    return 1;
+}
+
+// Encodes one block into a scratch buffer and writes it with a single call
+int serial_write_block(struct SerialStream *stream, enum SerialEncoding encoding, const int *values, size_t n) {
+    if (n > SERIAL_BLOCK_VALUES) {
+        return serial_fail(stream, "Too many values for one serialization block.");
+    }
+    unsigned char block[SERIAL_BLOCK_HEADER_SIZE + SERIAL_MAX_PAYLOAD];
+    unsigned char *out = block + SERIAL_BLOCK_HEADER_SIZE;
+    uint32_t previous = 0; // Delta coding starts from 0 in every block
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t value = (uint32_t)values[i];
+        if (encoding == SERIAL_RAW) {
+            put_u32(out, value);
+            out += 4;
+            continue;
+        }
+        uint32_t code = zigzag_encode(encoding == SERIAL_DELTA_VARINT ? value - previous : value);
+        previous = value;
+        while (code >= 0x80) {
+            *out++ = (unsigned char)(code | 0x80); // Low 7 bits, more bytes follow
+            code >>= 7;
+        }
+        *out++ = (unsigned char)code;
+    }
+
+    size_t payload = (size_t)(out - block) - SERIAL_BLOCK_HEADER_SIZE;
+    put_u32(block, (uint32_t)n);
+    put_u32(block + 4, (uint32_t)payload);
+    return serial_write_bytes(stream, block, SERIAL_BLOCK_HEADER_SIZE + payload);
+}
+
+// Reads and decodes one block, checking every length against the format's limits
+size_t serial_read_block(struct SerialStream *stream, enum SerialEncoding encoding, int *values) {
+    unsigned char head[SERIAL_BLOCK_HEADER_SIZE];
+    if (!serial_read_bytes(stream, head, sizeof(head))) {
+        return 0;
+    }
+    uint32_t count = get_u32(head);
+    uint32_t payload = get_u32(head + 4);
+    if (count == 0) {
+        if (payload != 0) {
+            serial_fail(stream, "Serialized end block is corrupt.");
+        }
+        return 0;
+    }
+    size_t min_payload = (encoding == SERIAL_RAW) ? (size_t)count * 4 : count;
+    size_t max_payload = (encoding == SERIAL_RAW) ? (size_t)count * 4 : (size_t)count * SERIAL_MAX_VARINT;
+    if (count > SERIAL_BLOCK_VALUES || payload < min_payload || payload > max_payload) {
+        serial_fail(stream, "Serialized block has an invalid size.");
+        return 0;
+    }
+
+    unsigned char bytes[SERIAL_MAX_PAYLOAD];
+    if (!serial_read_bytes(stream, bytes, payload)) {
+        return 0;
+    }
+
+    const unsigned char *in = bytes;
+    const unsigned char *end = bytes + payload;
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (encoding == SERIAL_RAW) {
+            values[i] = (int)get_u32(in);
+            in += 4;
+            continue;
+        }
+        uint32_t code = 0;
+        for (int shift = 0;; shift += 7) {
+            if (in == end || shift > 28) {
+                serial_fail(stream, "Serialized block holds a malformed varint.");
+                return 0;
+            }
+            unsigned char byte = *in++;
+            code |= (uint32_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        uint32_t value = zigzag_decode(code);
+        if (encoding == SERIAL_DELTA_VARINT) {
+            value += previous;
+        }
+        previous = value;
+        values[i] = (int)value;
+    }
+    if (in != end) {
+        serial_fail(stream, "Serialized block has trailing bytes.");
+        return 0;
+    }
+    return count;
+}
@@ -0,0 +1,78 @@
+#ifndef SERIALIZE_H // Include guard start
+#define SERIALIZE_H
+
+#include <stddef.h> // For size_t
+
+// --- Binary Stream Format ---
+// Lists and stacks are checkpointed as a short header followed by blocks of at most
+// SERIAL_BLOCK_VALUES values, closed by an empty block:
+//
+//   header: "DSSR" | version (1 byte) | kind (1 byte) | encoding (1 byte) | 0 (1 byte)
+//   block:  value count (u32, little-endian) | payload bytes (u32, little-endian) | payload
+//   end:    a block with count 0 and no payload
+//
+// Writers encode one block at a time into a fixed scratch buffer and readers decode one
+// block at a time, so neither side ever holds a second copy of the whole structure.
+// A reader stops right after the end block, so several structures can share a stream.
+// Delta coding restarts in every block, so each block decodes on its own.
+
+#define SERIAL_FORMAT_VERSION 1
+#define SERIAL_HEADER_SIZE 8
+#define SERIAL_BLOCK_HEADER_SIZE 8
+#define SERIAL_BLOCK_VALUES 1024 // Values per block (the last block may hold fewer)
+#define SERIAL_MAX_VARINT 5      // Worst-case bytes for one varint-coded int
+
+// How the values inside a block are stored
+enum SerialEncoding {
+    SERIAL_RAW,         // 4 bytes per value, little-endian
+    SERIAL_VARINT,      // Zigzag LEB128: values near zero take 1-2 bytes
+    SERIAL_DELTA_VARINT // Zigzag LEB128 of the difference to the previous value; best for
+                        // sorted or clustered data
+};
+
+// What the stream holds; a reader refuses a stream of the wrong kind
+enum SerialKind {
+    SERIAL_KIND_LIST = 1, // Values in list order
+    SERIAL_KIND_STACK = 2 // Values from top to bottom
+};
+
+// Byte source/sink: a file descriptor, or a caller-owned memory buffer when fd is -1.
+// Errors are sticky: after the first failure every later call fails without doing I/O.
+struct SerialStream {
+    int fd;                // Descriptor to write to / read from, or -1
+    unsigned char *buffer; // Memory target when fd == -1
+    size_t size;           // Buffer capacity (writing) or bytes available (reading)
+    size_t pos;            // Bytes written or consumed so far (also counted for fds)
+    int error;             // 1 once something failed
+};
+
+
+// --- Function Prototypes ---
+
+// Sets 'stream' up to write to or read from 'fd'. The descriptor is not closed.
+void serial_stream_fd(struct SerialStream *stream, int fd);
+
+// Sets 'stream' up to write into 'buffer' (at most 'size' bytes) or to read 'size' bytes
+// from it. After writing, stream->pos is the number of bytes produced.
+void serial_stream_buffer(struct SerialStream *stream, void *buffer, size_t size);
+
+// Upper bound on the bytes needed to serialize 'count' values with any encoding,
+// for sizing a memory buffer.
+size_t serial_max_size(size_t count);
+
+// Writes / checks the stream header. serial_read_header fails unless the stream holds
+// 'kind', and reports the encoding it was written with. Return 1 on success, 0 on failure.
+int serial_write_header(struct SerialStream *stream, enum SerialKind kind, enum SerialEncoding encoding);
+int serial_read_header(struct SerialStream *stream, enum SerialKind kind, enum SerialEncoding *encoding);
+
+// Encodes values[0..n) as one block (n <= SERIAL_BLOCK_VALUES). n == 0 writes the end block.
+// Returns 1 on success, 0 on failure.
+int serial_write_block(struct SerialStream *stream, enum SerialEncoding encoding, const int *values, size_t n);
+
+// Decodes the next block into values[], which must hold SERIAL_BLOCK_VALUES ints.
+// Returns the number of values; 0 means the end block was read, or an error occurred
+// (stream->error tells them apart).
+size_t serial_read_block(struct SerialStream *stream, enum SerialEncoding encoding, int *values);
+
+
+#endif // SERIALIZE_H // Include guard end
@@ -0,0 +1,266 @@
+#include "skip_list.h" // Include the header file
+#include <stdio.h>     // For fprintf
+#include <stdlib.h>    // For NULL
+#include "format.h"    // For the buffered skip_list_print
+
+// Nodes per pool chunk for height-1 nodes; taller nodes are rarer, so their pools use
+// proportionally smaller chunks (never fewer than SKIP_POOL_MIN_CHUNK nodes).
+#define SKIP_POOL_CHUNK 1024
+#define SKIP_POOL_MIN_CHUNK 16
+
+// Helper: next pseudo-random number (xorshift64*)
+static unsigned long long skip_random(struct SkipList *list) {
+    unsigned long long x = list->rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    list->rng = x;
+    return x * 0x2545F4914F6CDD1Dull;
+}
+
+// Helper: height of a new node. Each extra level has probability 1/4, which keeps the
+// expected links per node at 4/3 while searches still take O(log n) steps.
+static int random_height(struct SkipList *list) {
+    unsigned long long bits = skip_random(list);
+    int height = 1;
+    while ((bits & 3) == 0 && height < SKIP_LIST_MAX_LEVEL) {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+// Initializes an empty list and one pool per node height
+void skip_list_init(struct SkipList *list) {
+    if (list == NULL) return; // Safety check
+    for (int lvl = 0; lvl < SKIP_LIST_MAX_LEVEL; lvl++) {
+        list->head[lvl].next = NULL;
+        list->head[lvl].width = 1;
+        size_t chunk = (size_t)SKIP_POOL_CHUNK >> (2 * lvl);
+        node_pool_init(&list->pools[lvl], sizeof(struct SkipNode) + (size_t)(lvl + 1) * sizeof(struct SkipLink),
+                       chunk > SKIP_POOL_MIN_CHUNK ? chunk : SKIP_POOL_MIN_CHUNK);
+    }
+    list->level = 1;
+    list->length = 0;
+    list->rng = 0x9E3779B97F4A7C15ull;
+}
+
+// Helper: walks down from the top level, stopping on each level at the last node whose
+// value is below 'value' (or not above it, with 'inclusive'). preds[lvl] gets that node's
+// links (the head's for "none") and ranks[lvl] its 1-based position (0 for the head).
+static void find_predecessors(struct SkipList *list, int value, bool inclusive,
+                              struct SkipLink **preds, int *ranks) {
+    struct SkipLink *links = list->head;
+    int rank = 0;
+    for (int lvl = list->level - 1; lvl >= 0; lvl--) {
+        struct SkipNode *next;
+        while ((next = links[lvl].next) != NULL && (next->data < value || (inclusive && next->data == value))) {
+            rank += links[lvl].width;
+            links = next->links;
+        }
+        preds[lvl] = links;
+        ranks[lvl] = rank;
+    }
+}
+
+// Helper: same walk, but by position: stops before the node at 0-based 'position'
+static void find_position_predecessors(struct SkipList *list, int position, struct SkipLink **preds) {
+    struct SkipLink *links = list->head;
+    int rank = 0;
+    for (int lvl = list->level - 1; lvl >= 0; lvl--) {
+        while (links[lvl].next != NULL && rank + links[lvl].width <= position) {
+            rank += links[lvl].width;
+            links = links[lvl].next->links;
+        }
+        preds[lvl] = links;
+    }
+}
+
+// Helper: removes 'node' (the successor of preds[0]) and returns it to its pool
+static void unlink_node(struct SkipList *list, struct SkipLink **preds, struct SkipNode *node) {
+    for (int lvl = 0; lvl < list->level; lvl++) {
+        struct SkipLink *link = &preds[lvl][lvl];
+        if (link->next == node) {
+            link->width += node->links[lvl].width - 1; // Now spans both links, minus the node
+            link->next = node->links[lvl].next;
+        } else {
+            link->width--; // Passes over the gap
+        }
+    }
+    while (list->level > 1 && list->head[list->level - 1].next == NULL) {
+        list->level--;
+    }
+    node_pool_free(&list->pools[node->level - 1], node);
+    list->length--;
+}
+
+// Inserts in sorted order; each link the new node cuts in two splits its width
+bool skip_list_insert(struct SkipList *list, int data) {
+    if (list == NULL) return false; // Safety check
+
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    int ranks[SKIP_LIST_MAX_LEVEL];
+    find_predecessors(list, data, true, preds, ranks);
+
+    int height = random_height(list);
+    struct SkipNode *node = node_pool_alloc(&list->pools[height - 1]);
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in skip_list_insert.\n");
+        return false;
+    }
+    node->data = data;
+    node->level = height;
+
+    // New levels start as one head link spanning the whole list
+    for (int lvl = list->level; lvl < height; lvl++) {
+        list->head[lvl].next = NULL;
+        list->head[lvl].width = list->length + 1;
+        preds[lvl] = list->head;
+        ranks[lvl] = 0;
+    }
+    if (height > list->level) {
+        list->level = height;
+    }
+
+    int lvl = 0;
+    for (; lvl < height; lvl++) {
+        struct SkipLink *link = &preds[lvl][lvl];
+        int before = ranks[0] - ranks[lvl]; // Steps from this predecessor to the level-0 one
+        node->links[lvl].next = link->next;
+        node->links[lvl].width = link->width - before;
+        link->next = node;
+        link->width = before + 1;
+    }
+    for (; lvl < list->level; lvl++) {
+        preds[lvl][lvl].width++; // Links passing over the new node get one step longer
+    }
+    list->length++;
+    return true;
+}
+
+// Deletes the first node equal to 'value'
+bool skip_list_delete(struct SkipList *list, int value) {
+    if (list == NULL) return false; // Safety check
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    int ranks[SKIP_LIST_MAX_LEVEL];
+    find_predecessors(list, value, false, preds, ranks);
+    struct SkipNode *node = preds[0][0].next;
+    if (node == NULL || node->data != value) {
+        return false;
+    }
+    unlink_node(list, preds, node);
+    return true;
+}
+
+// Deletes the node at a 0-based position
+bool skip_list_delete_at(struct SkipList *list, int position) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        return false; // Invalid args or out of bounds
+    }
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    find_position_predecessors(list, position, preds);
+    unlink_node(list, preds, preds[0][0].next);
+    return true;
+}
+
+struct SkipNode* skip_list_lower_bound(struct SkipList *list, int value) {
+    if (list == NULL) return NULL; // Safety check
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    int ranks[SKIP_LIST_MAX_LEVEL];
+    find_predecessors(list, value, false, preds, ranks);
+    return preds[0][0].next;
+}
+
+struct SkipNode* skip_list_next(struct SkipNode *node) {
+    return node == NULL ? NULL : node->links[0].next;
+}
+
+struct SkipNode* skip_list_find(struct SkipList *list, int value) {
+    struct SkipNode *node = skip_list_lower_bound(list, value);
+    return (node != NULL && node->data == value) ? node : NULL;
+}
+
+// Reads by position, skipping ahead by link widths
+int skip_list_get_at(struct SkipList *list, int position) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        return INT_MIN; // Invalid args or out of bounds
+    }
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    find_position_predecessors(list, position, preds);
+    return preds[0][0].next->data;
+}
+
+// Elements below 'value' = rank of the last one of them
+int skip_list_rank(struct SkipList *list, int value) {
+    if (list == NULL) return 0; // Safety check
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    int ranks[SKIP_LIST_MAX_LEVEL];
+    find_predecessors(list, value, false, preds, ranks);
+    return ranks[0];
+}
+
+// Copies [low, high] by walking level 0 from the lower bound
+int skip_list_range(struct SkipList *list, int low, int high, int *out, int max_count) {
+    if (out == NULL && max_count > 0) {
+        fprintf(stderr, "Error: Invalid arguments for skip_list_range.\n");
+        return 0;
+    }
+    int copied = 0;
+    struct SkipNode *node = skip_list_lower_bound(list, low);
+    while (node != NULL && node->data <= high && copied < max_count) {
+        out[copied++] = node->data;
+        node = node->links[0].next;
+    }
+    return copied;
+}
+
+// Two rank queries: elements <= high minus elements < low
+int skip_list_count_range(struct SkipList *list, int low, int high) {
+    if (list == NULL || low > high) {
+        return 0;
+    }
+    struct SkipLink *preds[SKIP_LIST_MAX_LEVEL];
+    int ranks[SKIP_LIST_MAX_LEVEL];
+    find_predecessors(list, high, true, preds, ranks);
+    return ranks[0] - skip_list_rank(list, low);
+}
+
+int skip_list_length(struct SkipList *list) {
+    return (list == NULL) ? 0 : list->length;
+}
+
+bool skip_list_is_empty(struct SkipList *list) {
+    return list == NULL || list->length == 0;
+}
+
+// Layout used by skip_list_print: "SkipList: 1 -> 2 -> 3 -> NULL"
+static const struct FormatOptions skip_list_print_layout = {
+    "SkipList: ", " -> ", 1, "... -> ", "NULL\n", 0, 0
+};
+
+// Prints the elements in large writes (level 0 is an ordinary sorted chain)
+void skip_list_print(struct SkipList *list) {
+    char chunk[FORMAT_CHUNK_SIZE];
+    struct FormatSink sink;
+    format_sink_file(&sink, stdout, chunk, sizeof(chunk));
+    format_begin(&sink, &skip_list_print_layout);
+    size_t shown = 0;
+    for (struct SkipNode *node = (list == NULL) ? NULL : list->head[0].next; node != NULL;
+         node = node->links[0].next) {
+        format_element(&sink, &skip_list_print_layout, node->data, shown++);
+    }
+    format_end(&sink, &skip_list_print_layout, shown, 0);
+    format_finish(&sink);
+}
+
+// Frees every pool chunk at once; the pools stay initialized for reuse
+void skip_list_destroy(struct SkipList *list) {
+    if (list == NULL) return; // Safety check
+    for (int lvl = 0; lvl < SKIP_LIST_MAX_LEVEL; lvl++) {
+        node_pool_destroy(&list->pools[lvl]);
+        list->head[lvl].next = NULL;
+        list->head[lvl].width = 1;
+    }
+    list->level = 1;
+    list->length = 0;
+}
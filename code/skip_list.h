@@ -0,0 +1,99 @@
+#ifndef SKIP_LIST_H // Include guard start
+#define SKIP_LIST_H
+
+#include <stdio.h>     // For standard types/prototypes if needed
+#include <stdbool.h>   // For bool return types
+#include <limits.h>    // For INT_MIN returned by skip_list_get_at
+#include "node_pool.h" // Nodes of each height come from their own pool
+
+// --- Structure Definitions ---
+
+// Skip list: a sorted linked list with extra "express" links. Every node is on level 0;
+// about a quarter of them are also on level 1, a sixteenth on level 2, and so on, so a
+// search drops down from the sparse top levels and touches O(log n) nodes instead of n.
+// Each link also records its width (how many level-0 steps it skips), which makes access
+// by 0-based position and rank queries O(log n) as well.
+//
+// Elements are kept in ascending order; equal values keep their insertion order.
+// Positions are 0-based like linked_list.h. A node's links live in the node itself
+// (flexible array member), and nodes of each height come from a NodePool owned by the
+// list, so an insert is one pool allocation and destroying the list frees whole chunks.
+
+// Most levels a node can have. With a 1/4 promotion rate this covers ~4^16 elements.
+#define SKIP_LIST_MAX_LEVEL 16
+
+struct SkipNode;
+
+// One forward link: the next node on this level and the level-0 steps it spans
+// (to the end of the list when 'next' is NULL).
+struct SkipLink {
+    struct SkipNode *next;
+    int width;
+};
+
+struct SkipNode {
+    int data;
+    int level;              // Number of links
+    struct SkipLink links[]; // links[0] is the ordinary next pointer
+};
+
+struct SkipList {
+    struct SkipLink head[SKIP_LIST_MAX_LEVEL];     // Links out of the list head
+    int level;                                     // Levels in use (at least 1)
+    int length;                                    // Number of elements
+    unsigned long long rng;                        // State for picking node heights
+    struct NodePool pools[SKIP_LIST_MAX_LEVEL];    // pools[h - 1] holds nodes of height h
+};
+
+
+// --- Function Prototypes ---
+
+// Initializes an empty list. No memory is allocated until the first insert.
+void skip_list_init(struct SkipList *list);
+
+// Inserts 'data' in sorted position (after any equal values). O(log n) expected.
+// Returns true on success, false on allocation failure.
+bool skip_list_insert(struct SkipList *list, int data);
+
+// Deletes the first node equal to 'value'. Returns true if one was found.
+bool skip_list_delete(struct SkipList *list, int value);
+
+// Deletes the node at a 0-based position. Returns true on success, false if out of bounds.
+bool skip_list_delete_at(struct SkipList *list, int position);
+
+// Finds the first node containing 'value', NULL if absent.
+struct SkipNode* skip_list_find(struct SkipList *list, int value);
+
+// Reads the element at a 0-based position. Returns INT_MIN if out of bounds.
+int skip_list_get_at(struct SkipList *list, int position);
+
+// Number of elements smaller than 'value', i.e. the 0-based position 'value' has or
+// would be inserted at.
+int skip_list_rank(struct SkipList *list, int value);
+
+// First node >= 'value', NULL if there is none. Walk on with skip_list_next.
+struct SkipNode* skip_list_lower_bound(struct SkipList *list, int value);
+
+// Node after 'node' in sorted order, NULL at the end.
+struct SkipNode* skip_list_next(struct SkipNode *node);
+
+// Copies the elements in [low, high], ascending, into out[] (at most 'max_count' of them).
+// Returns how many were copied. O(log n + copied).
+int skip_list_range(struct SkipList *list, int low, int high, int *out, int max_count);
+
+// Number of elements in [low, high], in O(log n) without visiting them.
+int skip_list_count_range(struct SkipList *list, int low, int high);
+
+// O(1) size queries.
+int skip_list_length(struct SkipList *list);
+bool skip_list_is_empty(struct SkipList *list);
+
+// Prints the elements: "SkipList: 1 -> 2 -> 3 -> NULL".
+void skip_list_print(struct SkipList *list);
+
+// Frees all nodes (chunk by chunk, no per-node work) and leaves the list empty and usable.
+// Does NOT free the SkipList struct itself.
+void skip_list_destroy(struct SkipList *list);
+
+
+#endif // SKIP_LIST_H // Include guard end
@@ -1,83 +1,433 @@
-#include "stack.h"   // 1. Include the header file
-#include <stdio.h>   // 3. Include for fprintf, stderr, printf
-#include <stdlib.h>  // 3. Include for malloc, free
-#include <limits.h>  // 3. Include for INT_MIN
-
-// Initializes the stack
-void stack_init(struct Stack *s) { // 4. Consistent use of 'struct'
-    if (s == NULL) return; // Optional: Robustness check
-    s->top = NULL;
-}
-
-// Pushes data onto the stack
-void stack_push(struct Stack *s, int data) { // 4. Consistent use of 'struct'
-    if (s == NULL) return; // Optional: Robustness check
-
-    // Use 'struct StackNode' consistently
-    struct StackNode *newNode = (struct StackNode *)malloc(sizeof(struct StackNode));
-    if (newNode == NULL) {
-        // It's often better to print errors to stderr
-        fprintf(stderr, "Error: Memory allocation failed in stack_push.\n");
-        return; // Or potentially exit(1) depending on requirements
-    }
-    newNode->data = data;
-    newNode->next = s->top;
-    s->top = newNode;
-}
-
-// Pops data from the stack
-int stack_pop(struct Stack *s) { // 4. Consistent use of 'struct'
-    // Check for NULL stack pointer AND empty stack
-    if (s == NULL || s->top == NULL) {
-        fprintf(stderr, "Error: Stack underflow on pop.\n");
-        return INT_MIN; // Return error indicator
-    }
-
-    // Use 'struct StackNode' consistently
-    struct StackNode *node_to_remove = s->top; // Temporary pointer
-    int popped_data = node_to_remove->data;    // Get data before freeing
-
-    s->top = node_to_remove->next; // Update top pointer
-
-    free(node_to_remove); // Free the removed node
-
-    return popped_data;
-}
-
-// Peeks at the top data element
-int stack_peek(struct Stack *s) { // 4. Consistent use of 'struct'
-    // Check for NULL stack pointer AND empty stack
-    if (s == NULL || s->top == NULL) {
-        fprintf(stderr, "Error: Stack underflow on peek.\n");
-        return INT_MIN; // Return error indicator
-    }
-    return s->top->data;
-}
-
-// Checks if the stack is empty
-int stack_is_empty(struct Stack *s) { // 4. Consistent use of 'struct'
-    if (s == NULL) {
-        // Depending on requirements, NULL could be treated as empty or an error
-        fprintf(stderr, "Warning: stack_is_empty called with NULL stack pointer.\n");
-        return 1; // Treat NULL as empty for this example
-    }
-    // Original logic: return 1 if empty (top is NULL), 0 otherwise
-    // Simplified return statement
-    return (s->top == NULL);
-}
-
-// Destroys the stack (frees all nodes)
-void stack_destroy(struct Stack *s) { // 4. Consistent use of 'struct'
-    if (s == NULL) return; // Optional: Robustness check
-
-    // Use 'struct StackNode' consistently
-    struct StackNode *current = s->top;
-    struct StackNode *next_node;
-
-    while (current != NULL) {
-        next_node = current->next; // Store next pointer
-        free(current);             // Free current node
-        current = next_node;       // Move to next
-    }
-    s->top = NULL; // Reset top pointer
-}
\ No newline at end of file
+#include "stack.h"   // 1. Include the header file
+#include <stdio.h>   // 3. Include for fprintf, stderr, printf
+#include <stdlib.h>  // 3. Include for malloc, free
+#include <limits.h>  // 3. Include for INT_MIN
+#include <string.h>  // For memcpy in the bulk operations
+#include <stdint.h>  // For SIZE_MAX
+#include <stddef.h>  // For ptrdiff_t
+#include "stats.h"   // Counters and histograms (compiled in with -DDS_STATS)
+
+// Initializes the stack
+void stack_init(struct Stack *s) { // 4. Consistent use of 'struct'
+    if (s == NULL) return; // Optional: Robustness check
+    s->top = NULL;
+    s->items = NULL;
+    s->capacity = 0;
+    s->count = 0;
+    s->kind = STACK_LINKED;
+}
+
+// Initializes an array-backed stack
+int stack_init_array(struct Stack *s, size_t initial_capacity) {
+    if (s == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL stack pointer.\n");
+        return 0;
+    }
+    stack_init(s);
+    s->kind = STACK_ARRAY;
+    if (initial_capacity == 0) {
+        initial_capacity = STACK_DEFAULT_CAPACITY;
+    }
+    s->items = malloc(initial_capacity * sizeof(int));
+    if (s->items == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in stack_init_array.\n");
+        return 0;
+    }
+    s->capacity = initial_capacity;
+    return 1;
+}
+
+// Helper: grows an array stack's buffer to hold at least 'min_capacity' elements,
+// doubling so a run of pushes costs amortized O(1). Returns 1 on success, 0 on failure.
+static int stack_grow(struct Stack *s, size_t min_capacity) {
+    if (min_capacity <= s->capacity) {
+        return 1;
+    }
+    size_t new_capacity = s->capacity > 0 ? s->capacity : STACK_DEFAULT_CAPACITY;
+    while (new_capacity < min_capacity) {
+        if (new_capacity > (SIZE_MAX / sizeof(int)) / 2) {
+            new_capacity = min_capacity; // Doubling would overflow, take exactly what is needed
+            break;
+        }
+        new_capacity *= 2;
+    }
+    if (new_capacity > SIZE_MAX / sizeof(int)) {
+        fprintf(stderr, "Error: Requested stack capacity is too large.\n");
+        return 0;
+    }
+    STATS_ONLY(uintptr_t old_items = (uintptr_t)s->items;)
+    int *new_items = realloc(s->items, new_capacity * sizeof(int));
+    if (new_items == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed while growing stack.\n");
+        return 0; // Old buffer is still valid
+    }
+    STATS_ADD(STATS_STACK_REALLOCS, 1);
+    STATS_ADD(STATS_STACK_BYTES_MOVED, (uintptr_t)new_items != old_items ? s->count * sizeof(int) : 0);
+    s->items = new_items;
+    s->capacity = new_capacity;
+    return 1;
+}
+
+// Pushes data onto the stack
+void stack_push(struct Stack *s, int data) { // 4. Consistent use of 'struct'
+    if (s == NULL) return; // Optional: Robustness check
+    STATS_TIMER_START(timer);
+
+    if (s->kind == STACK_ARRAY) {
+        if (s->count == s->capacity && !stack_grow(s, s->count + 1)) {
+            return;
+        }
+        s->items[s->count++] = data;
+        STATS_TIMER_STOP(timer, STATS_HIST_STACK_PUSH_NS);
+        return;
+    }
+
+    // Use 'struct StackNode' consistently
+    struct StackNode *newNode = (struct StackNode *)malloc(sizeof(struct StackNode));
+    if (newNode == NULL) {
+        // It's often better to print errors to stderr
+        fprintf(stderr, "Error: Memory allocation failed in stack_push.\n");
+        return; // Or potentially exit(1) depending on requirements
+    }
+    newNode->data = data;
+    newNode->next = s->top;
+    s->top = newNode;
+    s->count++;
+    STATS_ADD(STATS_STACK_NODES_ALLOCATED, 1);
+    STATS_TIMER_STOP(timer, STATS_HIST_STACK_PUSH_NS);
+}
+
+// Pops data from the stack
+int stack_pop(struct Stack *s) { // 4. Consistent use of 'struct'
+    // Check for NULL stack pointer AND empty stack
+    if (s == NULL || s->count == 0) {
+        fprintf(stderr, "Error: Stack underflow on pop.\n");
+        return INT_MIN; // Return error indicator
+    }
+    STATS_TIMER_START(timer);
+
+    if (s->kind == STACK_ARRAY) {
+        int top = s->items[--s->count];
+        STATS_TIMER_STOP(timer, STATS_HIST_STACK_POP_NS);
+        return top;
+    }
+
+    // Use 'struct StackNode' consistently
+    struct StackNode *node_to_remove = s->top; // Temporary pointer
+    int popped_data = node_to_remove->data;    // Get data before freeing
+
+    s->top = node_to_remove->next; // Update top pointer
+
+    free(node_to_remove); // Free the removed node
+    s->count--;
+    STATS_ADD(STATS_STACK_NODES_FREED, 1);
+    STATS_TIMER_STOP(timer, STATS_HIST_STACK_POP_NS);
+
+    return popped_data;
+}
+
+// Peeks at the top data element
+int stack_peek(struct Stack *s) { // 4. Consistent use of 'struct'
+    // Check for NULL stack pointer AND empty stack
+    if (s == NULL || s->count == 0) {
+        fprintf(stderr, "Error: Stack underflow on peek.\n");
+        return INT_MIN; // Return error indicator
+    }
+    if (s->kind == STACK_ARRAY) {
+        return s->items[s->count - 1];
+    }
+    return s->top->data;
+}
+
+// Checks if the stack is empty
+int stack_is_empty(struct Stack *s) { // 4. Consistent use of 'struct'
+    if (s == NULL) {
+        // Depending on requirements, NULL could be treated as empty or an error
+        fprintf(stderr, "Warning: stack_is_empty called with NULL stack pointer.\n");
+        return 1; // Treat NULL as empty for this example
+    }
+    // Original logic: return 1 if empty (no elements), 0 otherwise
+    // Simplified return statement
+    return (s->count == 0);
+}
+
+// Destroys the stack (frees all nodes)
+void stack_destroy(struct Stack *s) { // 4. Consistent use of 'struct'
+    if (s == NULL) return; // Optional: Robustness check
+
+    if (s->kind == STACK_ARRAY) {
+        free(s->items); // One buffer, no per-element work
+        s->items = NULL;
+        s->capacity = 0;
+        s->count = 0;
+        return;
+    }
+
+    // Use 'struct StackNode' consistently
+    struct StackNode *current = s->top;
+    struct StackNode *next_node;
+
+    while (current != NULL) {
+        next_node = current->next; // Store next pointer
+        free(current);             // Free current node
+        current = next_node;       // Move to next
+    }
+    STATS_ADD(STATS_STACK_NODES_FREED, s->count);
+    s->top = NULL; // Reset top pointer
+    s->count = 0;
+}
+
+// Returns the number of elements
+size_t stack_size(struct Stack *s) {
+    return (s == NULL) ? 0 : s->count;
+}
+
+// Pre-grows an array stack's buffer
+int stack_reserve(struct Stack *s, size_t min_capacity) {
+    if (s == NULL) {
+        fprintf(stderr, "Error: Cannot reserve on NULL stack pointer.\n");
+        return 0;
+    }
+    if (s->kind != STACK_ARRAY) {
+        return 1; // Linked stacks allocate per push, nothing to reserve
+    }
+    return stack_grow(s, min_capacity);
+}
+
+// Pushes a batch; values[n - 1] ends on top
+int stack_push_n(struct Stack *s, const int *values, size_t n) {
+    if (s == NULL || (values == NULL && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for stack_push_n.\n");
+        return 0;
+    }
+    if (n == 0) {
+        return 1;
+    }
+
+    if (s->kind == STACK_ARRAY) {
+        if (n > SIZE_MAX / sizeof(int) - s->count || !stack_grow(s, s->count + n)) {
+            return 0;
+        }
+        memcpy(s->items + s->count, values, n * sizeof(int));
+        s->count += n;
+        return 1;
+    }
+
+    // Linked: build the whole chain first so a failed allocation pushes nothing
+    struct StackNode *chain = NULL;   // Will become the new top
+    struct StackNode *bottom = NULL;  // Node for values[0]
+    for (size_t i = 0; i < n; i++) {
+        struct StackNode *newNode = (struct StackNode *)malloc(sizeof(struct StackNode));
+        if (newNode == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed in stack_push_n.\n");
+            while (chain != NULL) {
+                struct StackNode *next_node = chain->next;
+                free(chain);
+                chain = next_node;
+            }
+            return 0;
+        }
+        newNode->data = values[i];
+        newNode->next = chain;
+        chain = newNode;
+        if (bottom == NULL) {
+            bottom = newNode;
+        }
+    }
+    bottom->next = s->top;
+    s->top = chain;
+    s->count += n;
+    STATS_ADD(STATS_STACK_NODES_ALLOCATED, n);
+    return 1;
+}
+
+// Pops up to n elements in pop order
+size_t stack_pop_n(struct Stack *s, int *out, size_t n) {
+    if (s == NULL || (out == NULL && n > 0)) {
+        fprintf(stderr, "Error: Invalid arguments for stack_pop_n.\n");
+        return 0;
+    }
+    if (n > s->count) {
+        n = s->count;
+    }
+
+    if (s->kind == STACK_ARRAY) {
+        // Top of the stack is the end of the buffer, so copy it out reversed
+        int *top = s->items + s->count;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = top[-1 - (ptrdiff_t)i];
+        }
+        s->count -= n;
+        return n;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        struct StackNode *node_to_remove = s->top;
+        out[i] = node_to_remove->data;
+        s->top = node_to_remove->next;
+        free(node_to_remove);
+    }
+    s->count -= n;
+    STATS_ADD(STATS_STACK_NODES_FREED, n);
+    return n;
+}
+
+// Writes the stack top first, one block at a time, without popping anything
+int stack_serialize(struct Stack *s, struct SerialStream *stream, enum SerialEncoding encoding) {
+    if (s == NULL || stream == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for stack_serialize.\n");
+        return 0;
+    }
+    if (!serial_write_header(stream, SERIAL_KIND_STACK, encoding)) {
+        return 0;
+    }
+
+    int block[SERIAL_BLOCK_VALUES];
+    size_t n = 0;
+    struct StackNode *node = s->top;
+    for (size_t i = 0; i < s->count; i++) {
+        if (s->kind == STACK_ARRAY) {
+            block[n++] = s->items[s->count - 1 - i];
+        } else {
+            block[n++] = node->data;
+            node = node->next;
+        }
+        if (n == SERIAL_BLOCK_VALUES) {
+            if (!serial_write_block(stream, encoding, block, n)) {
+                return 0;
+            }
+            n = 0;
+        }
+    }
+    if (n > 0 && !serial_write_block(stream, encoding, block, n)) {
+        return 0;
+    }
+    return serial_write_block(stream, encoding, NULL, 0); // End block
+}
+
+// Helper: frees a detached chain of stack nodes.
+static void stack_free_chain(struct StackNode *chain) {
+    while (chain != NULL) {
+        struct StackNode *next_node = chain->next;
+        free(chain);
+        chain = next_node;
+    }
+}
+
+// Reads a stack written top first and pushes it so the order is restored
+int stack_deserialize(struct Stack *s, struct SerialStream *stream) {
+    if (s == NULL || stream == NULL) {
+        fprintf(stderr, "Error: Invalid arguments for stack_deserialize.\n");
+        return 0;
+    }
+    enum SerialEncoding encoding;
+    if (!serial_read_header(stream, SERIAL_KIND_STACK, &encoding)) {
+        return 0;
+    }
+
+    int block[SERIAL_BLOCK_VALUES];
+    size_t n;
+    size_t added = 0;
+
+    if (s->kind == STACK_ARRAY) {
+        // Values arrive top first: stage them above the current top, then flip that run
+        size_t base = s->count;
+        while ((n = serial_read_block(stream, encoding, block)) > 0) {
+            if (!stack_grow(s, base + added + n)) {
+                return 0; // s->count was never moved, so nothing was pushed
+            }
+            memcpy(s->items + base + added, block, n * sizeof(int));
+            added += n;
+        }
+        if (stream->error) {
+            return 0;
+        }
+        for (size_t lo = base, hi = base + added; lo + 1 < hi; lo++, hi--) {
+            int swap = s->items[lo];
+            s->items[lo] = s->items[hi - 1];
+            s->items[hi - 1] = swap;
+        }
+        s->count += added;
+        return 1;
+    }
+
+    // Linked: values arrive top first, which is chain order, so build it front to back
+    struct StackNode *chain = NULL;
+    struct StackNode *bottom = NULL;
+    while ((n = serial_read_block(stream, encoding, block)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            struct StackNode *newNode = (struct StackNode *)malloc(sizeof(struct StackNode));
+            if (newNode == NULL) {
+                fprintf(stderr, "Error: Memory allocation failed in stack_deserialize.\n");
+                stack_free_chain(chain);
+                return 0;
+            }
+            newNode->data = block[i];
+            newNode->next = NULL;
+            if (bottom == NULL) {
+                chain = newNode;
+            } else {
+                bottom->next = newNode;
+            }
+            bottom = newNode;
+            added++;
+        }
+    }
+    if (stream->error) {
+        stack_free_chain(chain);
+        return 0;
+    }
+    if (chain != NULL) {
+        bottom->next = s->top;
+        s->top = chain;
+        s->count += added;
+    }
+    STATS_ADD(STATS_STACK_NODES_ALLOCATED, added);
+    return 1;
+}
+
+
+// ----- Iteration -----
+
+void stack_iter_init(struct StackIterator *it, struct Stack *s) {
+    if (it == NULL) return; // Safety check
+    it->stack = s;
+    it->node = (s != NULL && s->kind == STACK_LINKED) ? s->top : NULL;
+    it->index = 0;
+}
+
+int stack_iter_valid(struct StackIterator *it) {
+    return it != NULL && it->stack != NULL && it->index < it->stack->count;
+}
+
+// Linked stacks follow the node chain, array stacks count down from items[count - 1]
+int stack_iter_next(struct StackIterator *it) {
+    if (!stack_iter_valid(it)) {
+        return 0;
+    }
+    if (it->node != NULL) {
+        it->node = it->node->next;
+    }
+    it->index++;
+    return stack_iter_valid(it);
+}
+
+// Helper: the slot holding the current element
+static int *stack_iter_slot(struct StackIterator *it) {
+    if (it->stack->kind == STACK_ARRAY) {
+        return &it->stack->items[it->stack->count - 1 - it->index];
+    }
+    return &it->node->data;
+}
+
+int stack_iter_get(struct StackIterator *it) {
+    return stack_iter_valid(it) ? *stack_iter_slot(it) : INT_MIN;
+}
+
+int stack_iter_set(struct StackIterator *it, int value) {
+    if (!stack_iter_valid(it)) {
+        return 0;
+    }
+    *stack_iter_slot(it) = value;
+    return 1;
+}
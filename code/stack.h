@@ -1,48 +1,117 @@
-#ifndef STACK_H // Include guard start
-#define STACK_H
-
-#include <stdio.h>  // For standard types if needed (like size_t, though not used here)
-#include <stdlib.h> // For standard types if needed
-#include <limits.h> // For INT_MIN used in pop/peek prototypes
-
-// --- Structure Definitions ---
-
-// Node structure for the linked list implementation of the stack
-// Note: Using 'struct StackNode' within the file is fine, but the typedef
-// can make it slightly cleaner if you prefer. Let's stick to struct tag for now.
-struct StackNode { // Renamed struct tag slightly (optional, Stack_node is also fine)
-    int data;
-    struct StackNode *next;
-};
-
-// Stack structure containing the top pointer
-struct Stack {
-    struct StackNode *top;
-};
-
-
-// --- Function Prototypes ---
-
-// Initializes an existing Stack struct. Call this before using the stack.
-void stack_init(struct Stack *s);
-
-// Pushes an element onto the top of the stack. Handles memory allocation.
-void stack_push(struct Stack *s, int data);
-
-// Pops (removes and returns) the element from the top of the stack.
-// Returns INT_MIN if the stack is empty (stack underflow).
-int stack_pop(struct Stack *s);
-
-// Peeks at (returns without removing) the element at the top of the stack.
-// Returns INT_MIN if the stack is empty.
-int stack_peek(struct Stack *s);
-
-// Checks if the stack is empty. Returns 1 if empty, 0 otherwise.
-int stack_is_empty(struct Stack *s);
-
-// Frees all nodes in the stack and resets the top pointer.
-// Does NOT free the Stack struct itself.
-void stack_destroy(struct Stack *s);
-
-
+#ifndef STACK_H // Include guard start
+#define STACK_H
+
+#include <stdio.h>  // For standard types if needed (like size_t, though not used here)
+#include <stdlib.h> // For standard types if needed
+#include <limits.h> // For INT_MIN used in pop/peek prototypes
+#include "serialize.h" // For the binary checkpoint format
+
+// --- Structure Definitions ---
+
+// Node structure for the linked list implementation of the stack
+// Note: Using 'struct StackNode' within the file is fine, but the typedef
+// can make it slightly cleaner if you prefer. Let's stick to struct tag for now.
+struct StackNode { // Renamed struct tag slightly (optional, Stack_node is also fine)
+    int data;
+    struct StackNode *next;
+};
+
+// Storage used by a stack, picked at init time
+enum StackKind {
+    STACK_LINKED, // One malloc'd StackNode per element (stack_init)
+    STACK_ARRAY   // One contiguous, geometrically growing buffer (stack_init_array)
+};
+
+// Initial buffer size for array stacks when stack_init_array gets 0.
+#define STACK_DEFAULT_CAPACITY 16
+
+// Stack structure containing the top pointer
+struct Stack {
+    struct StackNode *top; // Linked storage: top node (unused by array stacks)
+    int *items;            // Array storage: items[count - 1] is the top (unused by linked stacks)
+    size_t capacity;       // Array storage: slots allocated in 'items'
+    size_t count;          // Number of elements (tracked for both kinds)
+    enum StackKind kind;
+};
+
+
+// --- Function Prototypes ---
+
+// Initializes an existing Stack struct. Call this before using the stack.
+// The stack stores one node per element (STACK_LINKED).
+void stack_init(struct Stack *s);
+
+// Initializes a stack backed by a contiguous buffer (STACK_ARRAY): push and pop are an
+// index bump, growth doubles the buffer. 0 means STACK_DEFAULT_CAPACITY.
+// Returns 1 on success, 0 on failure.
+int stack_init_array(struct Stack *s, size_t initial_capacity);
+
+// Pushes an element onto the top of the stack. Handles memory allocation.
+void stack_push(struct Stack *s, int data);
+
+// Pops (removes and returns) the element from the top of the stack.
+// Returns INT_MIN if the stack is empty (stack underflow).
+int stack_pop(struct Stack *s);
+
+// Peeks at (returns without removing) the element at the top of the stack.
+// Returns INT_MIN if the stack is empty.
+int stack_peek(struct Stack *s);
+
+// Checks if the stack is empty. Returns 1 if empty, 0 otherwise.
+int stack_is_empty(struct Stack *s);
+
+// Returns the number of elements on the stack.
+size_t stack_size(struct Stack *s);
+
+// Makes room for at least 'min_capacity' elements (array stacks; a no-op for linked ones).
+// Returns 1 on success, 0 on failure.
+int stack_reserve(struct Stack *s, size_t min_capacity);
+
+// Pushes values[0], values[1], ... in order, so values[n - 1] ends up on top.
+// Array stacks grow at most once and copy the batch in one go.
+// Returns 1 on success, 0 on failure (nothing is pushed then).
+int stack_push_n(struct Stack *s, const int *values, size_t n);
+
+// Pops up to 'n' elements into 'out' in pop order (out[0] was the top).
+// Returns how many were popped (fewer than n if the stack runs empty).
+size_t stack_pop_n(struct Stack *s, int *out, size_t n);
+
+// Writes the stack from top to bottom in the block format of serialize.h.
+// The stack is not modified. Returns 1 on success, 0 on failure.
+int stack_serialize(struct Stack *s, struct SerialStream *stream, enum SerialEncoding encoding);
+
+// Reads one serialized stack and pushes it onto 's' (of either kind) so the saved top is
+// on top again, above any elements already there. All or nothing: on a malformed or
+// truncated stream the stack is left unchanged. Returns 1 on success, 0 on failure.
+int stack_deserialize(struct Stack *s, struct SerialStream *stream);
+
+// --- Iteration ---
+// Walks the stack from the top down without popping, for either kind: stepping, reading
+// and overwriting are O(1). Pushing or popping invalidates the iterator. There is no
+// insert or erase: a stack only changes at the top (use stack_push / stack_pop).
+struct StackIterator {
+    struct Stack *stack;
+    struct StackNode *node; // Linked storage: current node
+    size_t index;           // 0 for the top element; >= count means past the bottom
+};
+
+// Places the iterator on the top element.
+void stack_iter_init(struct StackIterator *it, struct Stack *s);
+
+// Returns 1 while the iterator is on an element, 0 once past the bottom.
+int stack_iter_valid(struct StackIterator *it);
+
+// Moves one element down. Returns 1 if the iterator is still on an element.
+int stack_iter_next(struct StackIterator *it);
+
+// Reads / overwrites the current element. stack_iter_get returns INT_MIN past the bottom;
+// stack_iter_set returns 1 on success, 0 past the bottom.
+int stack_iter_get(struct StackIterator *it);
+int stack_iter_set(struct StackIterator *it, int value);
+
+// Frees all nodes (or the buffer) in the stack and resets it to empty.
+// Does NOT free the Stack struct itself.
+void stack_destroy(struct Stack *s);
+
+
 #endif // STACK_H // Include guard end
\ No newline at end of file
@@ -0,0 +1,200 @@
+#define _POSIX_C_SOURCE 199309L // For clock_gettime
+#include "stats.h"  // Include the header file
+#include <stdio.h>  // For fprintf
+#include <time.h>   // For clock_gettime
+
+static uint64_t counters[STATS_COUNTER_COUNT];
+static StatsHistogramData histograms[STATS_HISTOGRAM_COUNT];
+
+static const char *counter_names[STATS_COUNTER_COUNT] = {
+    "array_reallocs",
+    "array_bytes_moved",
+    "list_nodes_allocated",
+    "list_nodes_freed",
+    "list_nodes_visited",
+    "pool_chunks_allocated",
+    "stack_nodes_allocated",
+    "stack_nodes_freed",
+    "stack_reallocs",
+    "stack_bytes_moved",
+};
+
+static const char *histogram_names[STATS_HISTOGRAM_COUNT] = {
+    "array_append_ns",
+    "array_find_ns",
+    "list_find_ns",
+    "list_find_length",
+    "stack_push_ns",
+    "stack_pop_ns",
+};
+
+int stats_enabled(void) {
+#ifdef DS_STATS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void stats_add(StatsCounter counter, uint64_t n) {
+    __atomic_fetch_add(&counters[counter], n, __ATOMIC_RELAXED);
+}
+
+// Helper: bucket index of a value (0 for 0, otherwise 1 + floor(log2(value)))
+static int bucket_of(uint64_t value) {
+    return value == 0 ? 0 : 64 - __builtin_clzll(value);
+}
+
+void stats_record(StatsHistogram hist, uint64_t value) {
+    StatsHistogramData *h = &histograms[hist];
+    __atomic_fetch_add(&h->buckets[bucket_of(value)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&h->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&h->sum, value, __ATOMIC_RELAXED);
+    uint64_t max = __atomic_load_n(&h->max, __ATOMIC_RELAXED);
+    while (value > max &&
+           !__atomic_compare_exchange_n(&h->max, &max, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        // 'max' was reloaded by the failed exchange, try again while we are still larger
+    }
+}
+
+uint64_t stats_counter(StatsCounter counter) {
+    return __atomic_load_n(&counters[counter], __ATOMIC_RELAXED);
+}
+
+void stats_histogram(StatsHistogram hist, StatsHistogramData *out) {
+    const StatsHistogramData *h = &histograms[hist];
+    for (int b = 0; b < STATS_BUCKETS; b++) {
+        out->buckets[b] = __atomic_load_n(&h->buckets[b], __ATOMIC_RELAXED);
+    }
+    out->count = __atomic_load_n(&h->count, __ATOMIC_RELAXED);
+    out->sum = __atomic_load_n(&h->sum, __ATOMIC_RELAXED);
+    out->max = __atomic_load_n(&h->max, __ATOMIC_RELAXED);
+}
+
+// Helper: largest value that falls in bucket b
+static uint64_t bucket_upper(int b) {
+    return b == 0 ? 0 : (b >= 64 ? UINT64_MAX : (1ull << b) - 1);
+}
+
+uint64_t stats_histogram_percentile(const StatsHistogramData *data, double percentile) {
+    if (data->count == 0) {
+        return 0;
+    }
+    // Rank of the wanted value (1-based, nearest-rank)
+    uint64_t rank = (uint64_t)(percentile / 100.0 * (double)data->count + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > data->count) rank = data->count;
+
+    uint64_t seen = 0;
+    for (int b = 0; b < STATS_BUCKETS; b++) {
+        seen += data->buckets[b];
+        if (seen >= rank) {
+            uint64_t upper = bucket_upper(b);
+            return upper < data->max ? upper : data->max; // No bucket bound is above the real max
+        }
+    }
+    return data->max;
+}
+
+const char *stats_counter_name(StatsCounter counter) {
+    return (counter >= 0 && counter < STATS_COUNTER_COUNT) ? counter_names[counter] : "unknown";
+}
+
+const char *stats_histogram_name(StatsHistogram hist) {
+    return (hist >= 0 && hist < STATS_HISTOGRAM_COUNT) ? histogram_names[hist] : "unknown";
+}
+
+void stats_reset(void) {
+    for (int c = 0; c < STATS_COUNTER_COUNT; c++) {
+        __atomic_store_n(&counters[c], 0, __ATOMIC_RELAXED);
+    }
+    for (int h = 0; h < STATS_HISTOGRAM_COUNT; h++) {
+        for (int b = 0; b < STATS_BUCKETS; b++) {
+            __atomic_store_n(&histograms[h].buckets[b], 0, __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(&histograms[h].count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&histograms[h].sum, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&histograms[h].max, 0, __ATOMIC_RELAXED);
+    }
+}
+
+// Helper: one histogram as a text block (only non-empty buckets)
+static void dump_histogram_text(FILE *out, const char *name, const StatsHistogramData *h) {
+    fprintf(out, "%s: count=%llu mean=%.1f p50=%llu p99=%llu max=%llu\n", name, (unsigned long long)h->count,
+            (double)h->sum / (double)h->count, (unsigned long long)stats_histogram_percentile(h, 50),
+            (unsigned long long)stats_histogram_percentile(h, 99), (unsigned long long)h->max);
+    for (int b = 0; b < STATS_BUCKETS; b++) {
+        if (h->buckets[b] > 0) {
+            fprintf(out, "  [%llu, %llu] %llu\n", (unsigned long long)(b == 0 ? 0 : 1ull << (b - 1)),
+                    (unsigned long long)bucket_upper(b), (unsigned long long)h->buckets[b]);
+        }
+    }
+}
+
+// Helper: one histogram as a JSON object; buckets are [lower_bound, count] pairs
+static void dump_histogram_json(FILE *out, const char *name, const StatsHistogramData *h) {
+    fprintf(out, "    \"%s\": {\"count\": %llu, \"sum\": %llu, \"max\": %llu, \"p50\": %llu, \"p99\": %llu, \"buckets\": [",
+            name, (unsigned long long)h->count, (unsigned long long)h->sum, (unsigned long long)h->max,
+            (unsigned long long)stats_histogram_percentile(h, 50),
+            (unsigned long long)stats_histogram_percentile(h, 99));
+    int first = 1;
+    for (int b = 0; b < STATS_BUCKETS; b++) {
+        if (h->buckets[b] > 0) {
+            fprintf(out, "%s[%llu, %llu]", first ? "" : ", ", (unsigned long long)(b == 0 ? 0 : 1ull << (b - 1)),
+                    (unsigned long long)h->buckets[b]);
+            first = 0;
+        }
+    }
+    fprintf(out, "]}");
+}
+
+void stats_dump(FILE *out, StatsFormat format) {
+    if (out == NULL) {
+        fprintf(stderr, "Error: NULL stream for stats_dump.\n");
+        return;
+    }
+
+    if (format == STATS_FORMAT_JSON) {
+        fprintf(out, "{\n  \"enabled\": %s,\n  \"counters\": {\n", stats_enabled() ? "true" : "false");
+        for (int c = 0; c < STATS_COUNTER_COUNT; c++) {
+            fprintf(out, "    \"%s\": %llu%s\n", counter_names[c], (unsigned long long)stats_counter(c),
+                    c + 1 < STATS_COUNTER_COUNT ? "," : "");
+        }
+        fprintf(out, "  },\n  \"histograms\": {\n");
+        int written = 0;
+        for (int h = 0; h < STATS_HISTOGRAM_COUNT; h++) {
+            StatsHistogramData data;
+            stats_histogram(h, &data);
+            if (data.count == 0) {
+                continue;
+            }
+            fprintf(out, "%s", written++ ? ",\n" : "");
+            dump_histogram_json(out, histogram_names[h], &data);
+        }
+        fprintf(out, "%s  }\n}\n", written ? "\n" : "");
+        return;
+    }
+
+    if (!stats_enabled()) {
+        fprintf(out, "Stats disabled (rebuild with -DDS_STATS)\n");
+        return;
+    }
+    fprintf(out, "Counters:\n");
+    for (int c = 0; c < STATS_COUNTER_COUNT; c++) {
+        fprintf(out, "  %-24s %llu\n", counter_names[c], (unsigned long long)stats_counter(c));
+    }
+    fprintf(out, "Histograms:\n");
+    for (int h = 0; h < STATS_HISTOGRAM_COUNT; h++) {
+        StatsHistogramData data;
+        stats_histogram(h, &data);
+        if (data.count > 0) {
+            dump_histogram_text(out, histogram_names[h], &data);
+        }
+    }
+}
+
+uint64_t stats_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,101 @@
+#ifndef STATS_H // Include guard start
+#define STATS_H
+
+#include <stdio.h>  // For FILE
+#include <stdint.h> // For uint64_t
+
+// --- Instrumentation ---
+// Operation counters and latency histograms for the containers. They are compiled in only
+// when DS_STATS is defined (e.g. gcc -DDS_STATS ...). Without it every STATS_* macro below
+// expands to nothing, so the container code pays nothing; the functions still exist and
+// report zeros, so callers of stats_dump do not need their own #ifdef.
+// Updates are relaxed atomic adds, so instrumented containers can be used from several threads.
+
+typedef enum StatsCounter {
+    STATS_ARRAY_REALLOCS,        // Buffer reallocations (heap realloc, move to/from a mapping, mremap)
+    STATS_ARRAY_BYTES_MOVED,     // Bytes copied by reallocations and by shifting elements
+    STATS_LIST_NODES_ALLOCATED,  // Nodes taken from malloc or a pool
+    STATS_LIST_NODES_FREED,      // Nodes given back
+    STATS_LIST_NODES_VISITED,    // Nodes walked by list_find / linked_list_find
+    STATS_POOL_CHUNKS_ALLOCATED, // New NodePool chunks (not counting reused spares)
+    STATS_STACK_NODES_ALLOCATED, // Linked stack nodes
+    STATS_STACK_NODES_FREED,
+    STATS_STACK_REALLOCS,        // Array stack buffer growths
+    STATS_STACK_BYTES_MOVED,     // Bytes copied when a growth had to move the buffer
+    STATS_COUNTER_COUNT
+} StatsCounter;
+
+typedef enum StatsHistogram {
+    STATS_HIST_ARRAY_APPEND_NS,  // array_append latency
+    STATS_HIST_ARRAY_FIND_NS,    // array_find latency
+    STATS_HIST_LIST_FIND_NS,     // list_find latency
+    STATS_HIST_LIST_FIND_LENGTH, // Nodes walked per list_find
+    STATS_HIST_STACK_PUSH_NS,    // stack_push latency
+    STATS_HIST_STACK_POP_NS,     // stack_pop latency
+    STATS_HISTOGRAM_COUNT
+} StatsHistogram;
+
+// Log2 buckets: bucket 0 holds 0, bucket b (b >= 1) holds values in [2^(b-1), 2^b).
+#define STATS_BUCKETS 65
+
+typedef struct StatsHistogramData {
+    uint64_t buckets[STATS_BUCKETS];
+    uint64_t count; // Values recorded
+    uint64_t sum;   // Sum of values (for the mean)
+    uint64_t max;   // Largest value
+} StatsHistogramData;
+
+typedef enum StatsFormat {
+    STATS_FORMAT_TEXT,
+    STATS_FORMAT_JSON
+} StatsFormat;
+
+
+// --- Hooks used inside the containers ---
+
+#ifdef DS_STATS
+#define STATS_ADD(counter, n) stats_add((counter), (uint64_t)(n))
+#define STATS_RECORD(hist, value) stats_record((hist), (uint64_t)(value))
+#define STATS_TIMER_START(name) uint64_t name = stats_now_ns()
+#define STATS_TIMER_STOP(name, hist) stats_record((hist), stats_now_ns() - (name))
+#define STATS_ONLY(code) code
+#else
+#define STATS_ADD(counter, n) ((void)0)
+#define STATS_RECORD(hist, value) ((void)0)
+#define STATS_TIMER_START(name) ((void)0)
+#define STATS_TIMER_STOP(name, hist) ((void)0)
+#define STATS_ONLY(code)
+#endif
+
+
+// --- Function Prototypes ---
+
+// Returns 1 if this build was compiled with DS_STATS, 0 otherwise.
+int stats_enabled(void);
+
+// Adds 'n' to a counter / records one value in a histogram.
+void stats_add(StatsCounter counter, uint64_t n);
+void stats_record(StatsHistogram hist, uint64_t value);
+
+// Reads a counter / copies a histogram.
+uint64_t stats_counter(StatsCounter counter);
+void stats_histogram(StatsHistogram hist, StatsHistogramData *out);
+
+// Approximate percentile (0-100) from the buckets: the upper bound of the bucket holding it.
+uint64_t stats_histogram_percentile(const StatsHistogramData *data, double percentile);
+
+// Names used by stats_dump, e.g. "array_reallocs".
+const char *stats_counter_name(StatsCounter counter);
+const char *stats_histogram_name(StatsHistogram hist);
+
+// Zeroes every counter and histogram.
+void stats_reset(void);
+
+// Writes all counters and the non-empty histograms as text or JSON.
+void stats_dump(FILE *out, StatsFormat format);
+
+// Monotonic clock in nanoseconds (used by STATS_TIMER_*).
+uint64_t stats_now_ns(void);
+
+
+#endif // STATS_H // Include guard end
@@ -0,0 +1,134 @@
+#include "steal_deque.h" // Include the header file
+#include <stdio.h>       // For fprintf
+#include <stdlib.h>      // For malloc, free
+
+// Helper: allocates a buffer of 'capacity' slots (a power of two)
+static struct StealBuffer *buffer_new(size_t capacity) {
+    struct StealBuffer *buf = malloc(sizeof(struct StealBuffer) + capacity * sizeof(_Atomic int));
+    if (buf == NULL) {
+        return NULL;
+    }
+    buf->mask = capacity - 1;
+    buf->retired = NULL;
+    return buf;
+}
+
+int steal_deque_init(struct StealDeque *q, size_t capacity) {
+    if (q == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL deque pointer.\n");
+        return 0;
+    }
+    if (capacity == 0) {
+        capacity = STEAL_DEQUE_DEFAULT_CAPACITY;
+    }
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    struct StealBuffer *buf = buffer_new(rounded);
+    if (buf == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in steal_deque_init.\n");
+        return 0;
+    }
+    atomic_init(&q->top, 0);
+    atomic_init(&q->bottom, 0);
+    atomic_init(&q->buffer, buf);
+    return 1;
+}
+
+// Helper: owner-side growth. Copies the live range [top, bottom) into a buffer twice the
+// size (same indices, new mask) and publishes it; the old one is kept for late thieves.
+static struct StealBuffer *grow(struct StealDeque *q, struct StealBuffer *old, long top, long bottom) {
+    struct StealBuffer *buf = buffer_new(2 * (old->mask + 1));
+    if (buf == NULL) {
+        return NULL;
+    }
+    for (long i = top; i < bottom; i++) {
+        int value = atomic_load_explicit(&old->slots[(size_t)i & old->mask], memory_order_relaxed);
+        atomic_store_explicit(&buf->slots[(size_t)i & buf->mask], value, memory_order_relaxed);
+    }
+    buf->retired = old;
+    atomic_store_explicit(&q->buffer, buf, memory_order_release);
+    return buf;
+}
+
+bool steal_deque_push(struct StealDeque *q, int data) {
+    long b = atomic_load_explicit(&q->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&q->top, memory_order_acquire);
+    struct StealBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_relaxed);
+    if ((size_t)(b - t) > buf->mask) {
+        buf = grow(q, buf, t, b);
+        if (buf == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed in steal_deque_push.\n");
+            return false;
+        }
+    }
+    atomic_store_explicit(&buf->slots[(size_t)b & buf->mask], data, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release); // The slot is visible before the new bottom
+    atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+    return true;
+}
+
+bool steal_deque_pop(struct StealDeque *q, int *out) {
+    // Claim the bottom slot first, then look at top: the full fence orders the two so a
+    // thief and the owner cannot both miss each other
+    long b = atomic_load_explicit(&q->bottom, memory_order_relaxed) - 1;
+    struct StealBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_relaxed);
+    atomic_store_explicit(&q->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = atomic_load_explicit(&q->top, memory_order_relaxed);
+
+    if (t > b) {
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed); // Was empty, undo
+        return false;
+    }
+    int value = atomic_load_explicit(&buf->slots[(size_t)b & buf->mask], memory_order_relaxed);
+    if (t == b) {
+        // Last element: thieves may be after it too, so take it the way they do
+        bool won = atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1, memory_order_seq_cst,
+                                                           memory_order_relaxed);
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed); // Empty either way
+        if (!won) {
+            return false;
+        }
+    }
+    *out = value;
+    return true;
+}
+
+bool steal_deque_steal(struct StealDeque *q, int *out) {
+    long t = atomic_load_explicit(&q->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&q->bottom, memory_order_acquire);
+    if (t >= b) {
+        return false; // Empty
+    }
+    struct StealBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_acquire);
+    int value = atomic_load_explicit(&buf->slots[(size_t)t & buf->mask], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed)) {
+        return false; // Lost the race to another thief or the owner
+    }
+    *out = value;
+    return true;
+}
+
+size_t steal_deque_size(struct StealDeque *q) {
+    if (q == NULL) return 0; // Safety check
+    long b = atomic_load_explicit(&q->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&q->top, memory_order_relaxed);
+    return (b > t) ? (size_t)(b - t) : 0;
+}
+
+void steal_deque_destroy(struct StealDeque *q) {
+    if (q == NULL) return; // Safety check
+    struct StealBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_relaxed);
+    while (buf != NULL) {
+        struct StealBuffer *older = buf->retired;
+        free(buf);
+        buf = older;
+    }
+    atomic_store_explicit(&q->buffer, NULL, memory_order_relaxed);
+    atomic_store_explicit(&q->top, 0, memory_order_relaxed);
+    atomic_store_explicit(&q->bottom, 0, memory_order_relaxed);
+}
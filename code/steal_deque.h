@@ -0,0 +1,70 @@
+#ifndef STEAL_DEQUE_H // Include guard start
+#define STEAL_DEQUE_H
+
+#include <stdatomic.h> // For _Atomic
+#include <stdbool.h>   // For bool return types
+#include <stddef.h>    // For size_t
+
+// --- Structure Definitions ---
+
+// Chase-Lev work-stealing deque of ints, for balancing tasks between worker threads.
+// Each worker owns one deque and uses it like its private task stack: it pushes and pops
+// at the bottom (LIFO, so it keeps working on the freshest, cache-warm tasks). Idle
+// workers steal from the top of someone else's deque (the oldest tasks, which in a
+// recursive workload are usually the biggest pieces of work).
+//
+// The owner's push and pop touch only 'bottom' and need no atomic read-modify-write;
+// only a pop of the very last element and a steal race for it with one compare-and-swap
+// on 'top'. Thieves never take a lock either.
+// The elements sit in a circular buffer that doubles when full. The owner alone grows
+// it; thieves may still be reading the old buffer, so retired buffers are kept on a list
+// and freed by steal_deque_destroy (together they are never bigger than the current one).
+// Memory orderings follow Le, Pop, Cohen and Zappa Nardelli, "Correct and Efficient
+// Work-Stealing for Weak Memory Models" (PPoPP 2013).
+
+// Capacity used when steal_deque_init gets 0.
+#define STEAL_DEQUE_DEFAULT_CAPACITY 256
+
+// Circular buffer; 'slots' is atomic because a thief may read a slot the owner is
+// about to reuse (the thief's CAS then fails and it throws the value away).
+struct StealBuffer {
+    size_t mask;                 // Capacity - 1 (capacity is a power of two)
+    struct StealBuffer *retired; // Buffer this one replaced, freed at destroy
+    _Atomic int slots[];
+};
+
+struct StealDeque {
+    _Alignas(64) atomic_long top;                  // Next element to steal (thieves advance it)
+    _Alignas(64) atomic_long bottom;               // Next free slot (owner only writes it)
+    _Alignas(64) _Atomic(struct StealBuffer *) buffer;
+};
+
+
+// --- Function Prototypes ---
+
+// Initializes an empty deque with room for 'capacity' elements before its first growth
+// (rounded up to a power of two; 0 means STEAL_DEQUE_DEFAULT_CAPACITY).
+// Not thread-safe: call before sharing. Returns 1 on success, 0 on failure.
+int steal_deque_init(struct StealDeque *q, size_t capacity);
+
+// Owner only: pushes 'data' at the bottom, growing the buffer if it is full.
+// Returns false if a bigger buffer could not be allocated.
+bool steal_deque_push(struct StealDeque *q, int data);
+
+// Owner only: pops the newest element into '*out'. Returns false if the deque was empty
+// (or a thief took the last element first).
+bool steal_deque_pop(struct StealDeque *q, int *out);
+
+// Any thread: steals the oldest element into '*out'. Returns false if the deque was
+// empty or another thread won the race for that element; try again or elsewhere.
+bool steal_deque_steal(struct StealDeque *q, int *out);
+
+// Number of elements at the moment of the check (a hint while other threads run).
+size_t steal_deque_size(struct StealDeque *q);
+
+// Frees the buffer and every retired one. Not thread-safe: all other threads must be
+// done with the deque. Does NOT free the StealDeque struct itself.
+void steal_deque_destroy(struct StealDeque *q);
+
+
+#endif // STEAL_DEQUE_H // Include guard end
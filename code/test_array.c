@@ -2,25 +2,633 @@
 #include <stdlib.h>
 #include <limits.h> // Needed if you check against INT_MIN
 #include <assert.h>
+#include <string.h> // For strcmp in the formatting tests
 
 #include "array.h" // Include the header for your dynamic array
+#include "array_simd.h" // To run the scan tests once per vector level
+#ifdef __linux__
+#include <sys/mman.h> // Sparse mapping for the INT_MAX position test
+#endif
 
 /*
 Structure definition is now in array.h:
 typedef struct Array {
     int *data;
-    int capacity;
-    int count;
+    size_t capacity;
+    size_t count;
+    ArrayGrowthPolicy growth;
+    ArrayStorage storage;
+    int sorted;
+    int inline_data[ARRAY_INLINE_CAPACITY];
 } Array;
 */
 
+// Growth callback used by the policy test: always adds exactly 3 slots.
+static size_t grow_by_three(size_t capacity, size_t min_capacity, void *ctx) {
+    (void)min_capacity;
+    int *calls = ctx;
+    (*calls)++;
+    return capacity + 3;
+}
+
+// Exercises each growth policy and growth past ARRAY_HUGE_THRESHOLD.
+static void test_growth_policies(void) {
+    printf("Testing growth policies...\n");
+    Array arr;
+
+    ArrayGrowthPolicy one_half = { ARRAY_GROWTH_ONE_HALF, 0, NULL, NULL };
+    assert(array_init_with_policy(&arr, &one_half) == 1);
+    for (int i = 0; i < 11; i++) {
+        array_append(&arr, i);
+    }
+    assert(arr.capacity == 16); // 10 + 10 / 2 + 1
+    assert(array_get(&arr, 11) == 10);
+    array_destroy(&arr);
+
+    ArrayGrowthPolicy chunk = { ARRAY_GROWTH_CHUNK, 100, NULL, NULL };
+    assert(array_init_with_policy(&arr, &chunk) == 1);
+    for (int i = 0; i < 111; i++) {
+        array_append(&arr, i);
+    }
+    assert(arr.capacity == 210); // 10 -> 110 -> 210
+    array_destroy(&arr);
+
+    int calls = 0;
+    ArrayGrowthPolicy callback = { ARRAY_GROWTH_CALLBACK, 0, grow_by_three, &calls };
+    assert(array_init_with_policy(&arr, &callback) == 1);
+    for (int i = 0; i < 16; i++) {
+        array_append(&arr, i);
+    }
+    assert(calls == 2);
+    assert(arr.capacity == 16); // 10 -> 13 -> 16
+    array_destroy(&arr);
+
+    ArrayGrowthPolicy missing_fn = { ARRAY_GROWTH_CALLBACK, 0, NULL, NULL };
+    assert(array_init_with_policy(&arr, &missing_fn) == 0);
+
+    // Grow well past ARRAY_HUGE_THRESHOLD (mapped storage on Linux) and back down
+    assert(array_init(&arr) == 1);
+    size_t big = 3 * ARRAY_HUGE_THRESHOLD / sizeof(int);
+    for (size_t i = 0; i < big; i++) {
+        array_append(&arr, (int)i);
+    }
+    assert(arr.count == big);
+    assert(array_get(&arr, 1) == 0);
+    assert(array_get(&arr, (int)big) == (int)big - 1);
+#ifdef __linux__
+    assert(arr.storage == ARRAY_STORAGE_MAPPED);
+#endif
+    assert(array_delete_range(&arr, 101, big - 100) == 1);
+    assert(array_shrink_to_fit(&arr) == 1);
+    assert(arr.capacity == 100);
+    assert(arr.storage == ARRAY_STORAGE_HEAP);
+    assert(array_get(&arr, 100) == 99);
+    array_destroy(&arr);
+
+    printf("Growth policy tests passed.\n");
+}
+
+// Checks find/count/min/max/sum/find_all against plain loops, for every vector level
+// and for sizes that leave every possible tail length after the vector loops.
+static void test_scan_kernels(void) {
+    printf("Testing array_find/count/min/max/sum/find_all...\n");
+    ArraySimdLevel levels[] = { ARRAY_SIMD_SCALAR, ARRAY_SIMD_SSE42, ARRAY_SIMD_AVX2 };
+    ArraySimdLevel original = array_simd_level();
+
+    for (int l = 0; l < 3; l++) {
+        ArraySimdLevel used = array_simd_set_level(levels[l]);
+        printf("  level %s\n", array_simd_level_name(used));
+
+        for (int n = 0; n <= 200; n++) {
+            Array arr;
+            assert(array_init(&arr) == 1);
+            for (int i = 0; i < n; i++) {
+                array_append(&arr, (i * 7919) % 13 - 6 + (i == n / 2 ? 1000000 : 0)); // Values -6..6 plus one spike
+            }
+
+            for (int value = -7; value <= 7; value++) {
+                int expected_pos = -1;
+                size_t expected_count = 0;
+                uint64_t bitmap[ARRAY_BITMAP_WORDS(200)];
+                for (int i = n - 1; i >= 0; i--) {
+                    if (arr.data[i] == value) {
+                        expected_pos = i + 1;
+                        expected_count++;
+                    }
+                }
+                assert(array_find(&arr, value) == expected_pos);
+                assert(array_count(&arr, value) == expected_count);
+                assert(array_find_all(&arr, value, bitmap) == expected_count);
+                for (int i = 0; i < n; i++) {
+                    int bit = (int)((bitmap[i / 64] >> (i % 64)) & 1);
+                    assert(bit == (arr.data[i] == value));
+                }
+            }
+
+            if (n > 0) {
+                int lo = arr.data[0], hi = arr.data[0];
+                long long total = 0;
+                for (int i = 0; i < n; i++) {
+                    lo = arr.data[i] < lo ? arr.data[i] : lo;
+                    hi = arr.data[i] > hi ? arr.data[i] : hi;
+                    total += arr.data[i];
+                }
+                assert(array_min(&arr) == lo);
+                assert(array_max(&arr) == hi);
+                assert(array_sum(&arr) == total);
+            } else {
+                assert(array_sum(&arr) == 0);
+                assert(array_min(&arr) == INT_MIN); // Empty array reports an error
+            }
+            array_destroy(&arr);
+        }
+
+        // The sum must not wrap at 32 bits
+        Array big;
+        assert(array_init(&big) == 1);
+        for (int i = 0; i < 100; i++) {
+            array_append(&big, INT_MAX);
+        }
+        assert(array_sum(&big) == 100LL * INT_MAX);
+        array_destroy(&big);
+    }
+
+    array_simd_set_level(original);
+    printf("Scan kernel tests passed.\n");
+}
+
+// Checks array_sort (both algorithms), sorted-mode bookkeeping and every search flavor
+static void test_sorted_mode(void) {
+    printf("Testing array_sort and sorted-mode searches...\n");
+    size_t sizes[] = { 0, 1, 2, 17, 100, 511, 512, 5000 }; // Both sides of the radix threshold
+    unsigned seed = 12345;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        Array arr;
+        assert(array_init(&arr) == 1);
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int value = (int)(seed >> 8) % 200 - 100; // Many duplicates, negatives included
+            if (i % 97 == 3) {
+                value = (i % 2) ? INT_MAX : INT_MIN; // Extremes exercise the sign flip
+            }
+            array_append(&arr, value);
+        }
+        long long sum_before = array_sum(&arr);
+
+        assert(array_sort(&arr) == 1);
+        assert(array_is_sorted(&arr) == 1);
+        assert((size_t)array_size(&arr) == n);
+        assert(array_sum(&arr) == sum_before);
+        for (size_t i = 1; i < n; i++) {
+            assert(arr.data[i - 1] <= arr.data[i]);
+        }
+
+        ArrayEytzinger ey;
+        assert(array_eytzinger_build(&ey, &arr) == 1);
+        int keys[260];
+        int positions[260];
+        for (int k = 0; k < 260; k++) {
+            keys[k] = k - 130;
+        }
+        assert(array_find_many(&arr, keys, 260, positions) == 1);
+
+        for (int k = 0; k < 260; k++) {
+            int value = keys[k];
+            size_t lower = 0, upper = 0;
+            while (lower < n && arr.data[lower] < value) lower++;
+            upper = lower;
+            while (upper < n && arr.data[upper] <= value) upper++;
+            int expected = (lower < n && arr.data[lower] == value) ? (int)lower + 1 : -1;
+
+            assert(array_lower_bound(&arr, value) == (int)lower + 1);
+            assert(array_upper_bound(&arr, value) == (int)upper + 1);
+            assert(array_find(&arr, value) == expected);
+            assert(positions[k] == expected);
+            assert(array_eytzinger_lower_bound(&ey, value) == (int)lower + 1);
+            assert(array_eytzinger_find(&ey, value) == expected);
+        }
+        array_eytzinger_destroy(&ey);
+        array_destroy(&arr);
+    }
+
+    // Sorted mode survives ordered appends and deletes, and is left on disorder
+    Array arr;
+    assert(array_init(&arr) == 1);
+    int values[] = { 5, 1, 3 };
+    assert(array_append_n(&arr, values, 3) == 1);
+    assert(array_is_sorted(&arr) == 0);
+    assert(array_lower_bound(&arr, 3) == -1); // Refuses unsorted data
+    assert(array_sort(&arr) == 1);            // 1 3 5
+    array_append(&arr, 5);                    // 1 3 5 5
+    assert(array_is_sorted(&arr) == 1);
+    int tail[] = { 6, 9 };
+    assert(array_append_n(&arr, tail, 2) == 1); // 1 3 5 5 6 9
+    assert(array_is_sorted(&arr) == 1);
+    assert(array_find(&arr, 5) == 3);          // First occurrence, like the linear scan
+    array_delete_at(&arr, 1);                  // 3 5 5 6 9
+    assert(array_is_sorted(&arr) == 1);
+    assert(array_find(&arr, 9) == 5);
+    array_append(&arr, 2);                     // 3 5 5 6 9 2
+    assert(array_is_sorted(&arr) == 0);
+    assert(array_find(&arr, 2) == 6);          // Linear scan again
+    array_destroy(&arr);
+
+    printf("Sorted mode tests passed.\n");
+}
+
+// Bulk operations whose source is the array itself, with and without a reallocation:
+// self-append, and self-insert for every gap position and source range of a small array.
+static void test_self_aliasing(void) {
+    printf("Testing bulk operations on the array's own elements...\n");
+    Array arr;
+    assert(array_init(&arr) == 1);
+    for (int i = 0; i < 5; i++) {
+        array_append(&arr, i);
+    }
+    assert(array_shrink_to_fit(&arr) == 1); // Full, so the append must reallocate
+    assert(array_append_n(&arr, arr.data, arr.count) == 1);
+    assert(arr.count == 10);
+    for (size_t i = 0; i < 10; i++) {
+        assert(arr.data[i] == (int)(i % 5));
+    }
+    array_destroy(&arr);
+
+    for (int spare = 0; spare <= 1; spare++) {
+        for (size_t index = 1; index <= 7; index++) {
+            for (size_t from = 0; from < 6; from++) {
+                for (size_t n = 1; from + n <= 6; n++) {
+                    int expected[12];
+                    int original[6] = { 10, 11, 12, 13, 14, 15 };
+                    memcpy(expected, original, (index - 1) * sizeof(int));
+                    memcpy(expected + index - 1, original + from, n * sizeof(int));
+                    memcpy(expected + index - 1 + n, original + index - 1, (7 - index) * sizeof(int));
+
+                    assert(array_init(&arr) == 1);
+                    assert(array_append_n(&arr, original, 6) == 1);
+                    assert(spare ? array_reserve(&arr, 64) == 1 : array_shrink_to_fit(&arr) == 1);
+                    assert(array_insert_range(&arr, index, arr.data + from, n) == 1);
+                    assert(arr.count == 6 + n);
+                    assert(memcmp(arr.data, expected, arr.count * sizeof(int)) == 0);
+                    array_destroy(&arr);
+                }
+            }
+        }
+    }
+    printf("Self-aliasing tests passed.\n");
+}
+
+// Searches return int positions; one past INT_MAX must come back as -1, not wrap.
+// Uses a sparse private mapping of zeros (only the pages the searches touch are
+// materialized) with a single 1 at the end, wrapped in a hand-built Array.
+static void test_int_max_positions(void) {
+#ifdef __linux__
+    if (sizeof(size_t) <= sizeof(int)) {
+        return; // Such an array cannot exist on this platform
+    }
+    printf("Testing search positions past INT_MAX...\n");
+    size_t n = (size_t)INT_MAX + 10;
+    int *data = mmap(NULL, n * sizeof(int), PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (data == MAP_FAILED) {
+        printf("Skipped: cannot reserve %zu bytes of address space.\n", n * sizeof(int));
+        return;
+    }
+    data[n - 1] = 1;
+    Array arr = { 0 };
+    arr.data = data;
+    arr.capacity = arr.count = n;
+    arr.storage = ARRAY_STORAGE_FILE_READONLY; // Not ours to free; nothing here mutates it
+    arr.sorted = 1;
+
+    assert(array_lower_bound(&arr, 0) == 1);
+    assert(array_lower_bound(&arr, 1) == -1);  // Position INT_MAX + 10
+    assert(array_upper_bound(&arr, 0) == -1);
+    assert(array_upper_bound(&arr, 1) == -1);  // count + 1
+    assert(array_find(&arr, 0) == 1);
+    assert(array_find(&arr, 1) == -1);
+    int keys[] = { 0, 1 };
+    int positions[2];
+    assert(array_find_many(&arr, keys, 2, positions) == 1);
+    assert(positions[0] == 1 && positions[1] == -1);
+    munmap(data, n * sizeof(int));
+    printf("INT_MAX position tests passed.\n");
+#endif
+}
+
+// Checks array_save / array_open_mmap in both modes and rejection of bad files
+static void test_persistence(void) {
+    printf("Testing array_save and array_open_mmap...\n");
+    const char *path = "/tmp/test_array_persist.bin";
+    const char *bad_path = "/tmp/test_array_persist_bad.bin";
+
+    Array arr;
+    assert(array_init(&arr) == 1);
+    for (int i = 0; i < 5000; i++) {
+        array_append(&arr, i * 3 - 100);
+    }
+    assert(array_sort(&arr) == 1); // Already ordered; turns sorted mode on
+    assert(array_save(&arr, path) == 1);
+
+    // Read-only: zero-copy view, searches work, mutators refuse
+    Array view;
+    assert(array_open_mmap(&view, path, ARRAY_MAP_READONLY) == 1);
+    assert(array_is_read_only(&view) == 1);
+    assert(array_is_read_only(&arr) == 0);
+    assert(view.count == arr.count);
+    assert(array_is_sorted(&view) == 1);
+    for (size_t i = 0; i < arr.count; i++) {
+        assert(view.data[i] == arr.data[i]);
+    }
+    assert(array_find(&view, 200) == 101);       // Binary search on the mapping
+    assert(array_get(&view, 5000) == 4999 * 3 - 100);
+    assert(array_reserve(&view, 10000) == 0);
+    assert(array_append_n(&view, (int[]){ 1, 2 }, 2) == 0);
+    assert(array_delete_range(&view, 1, 1) == 0);
+    assert(array_shrink_to_fit(&view) == 0);
+    assert(array_sort(&view) == 0);
+    array_append(&view, 1);
+    array_delete_at(&view, 1);
+    assert(view.count == 5000);
+    array_destroy(&view);
+    assert(view.data == NULL && view.count == 0);
+
+    // Copy-on-write: edits stay private, including growth past the mapping
+    Array copy;
+    assert(array_open_mmap(&copy, path, ARRAY_MAP_COPY_ON_WRITE) == 1);
+    assert(array_is_read_only(&copy) == 0);
+    array_delete_at(&copy, 1);
+    for (int i = 0; i < 3000; i++) {
+        array_append(&copy, 1000000 + i);
+    }
+    assert(copy.count == 7999);
+    assert(array_get(&copy, 1) == -97);
+    assert(array_get(&copy, 7999) == 1002999);
+    assert(array_is_sorted(&copy) == 1);
+    array_destroy(&copy);
+
+    assert(array_open_mmap(&view, path, ARRAY_MAP_READONLY) == 1);
+    assert(view.count == 5000 && array_get(&view, 1) == -100); // File untouched
+    array_destroy(&view);
+
+    // Empty arrays round-trip too
+    Array empty;
+    assert(array_init(&empty) == 1);
+    assert(array_save(&empty, bad_path) == 1);
+    assert(array_open_mmap(&view, bad_path, ARRAY_MAP_COPY_ON_WRITE) == 1);
+    assert(view.count == 0);
+    array_append(&view, 7);
+    assert(array_get(&view, 1) == 7);
+    array_destroy(&view);
+    array_destroy(&empty);
+
+    // Truncated file, foreign file and missing file are refused
+    FILE *file = fopen(path, "rb");
+    FILE *bad = fopen(bad_path, "wb");
+    assert(file != NULL && bad != NULL);
+    char buffer[ARRAY_FILE_HEADER_SIZE + 40];
+    assert(fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer));
+    assert(fwrite(buffer, 1, sizeof(buffer) - 2, bad) == sizeof(buffer) - 2);
+    fclose(file);
+    fclose(bad);
+    assert(array_open_mmap(&view, bad_path, ARRAY_MAP_READONLY) == 0);
+    buffer[0] = 'X';
+    bad = fopen(bad_path, "wb");
+    assert(bad != NULL);
+    assert(fwrite(buffer, 1, sizeof(buffer), bad) == sizeof(buffer));
+    fclose(bad);
+    assert(array_open_mmap(&view, bad_path, ARRAY_MAP_READONLY) == 0);
+    assert(array_open_mmap(&view, "/tmp/does/not/exist.bin", ARRAY_MAP_READONLY) == 0);
+
+    remove(path);
+    remove(bad_path);
+    array_destroy(&arr);
+    printf("Persistence tests passed.\n");
+}
+
+// Checks array_format / array_fprint layouts, ranges, truncation and the int renderer
+static void test_formatting(void) {
+    printf("Testing array_format and array_fprint...\n");
+    char text[256];
+    char expected[256];
+
+    // format_int agrees with printf across the int range
+    int samples[] = { 0, 7, -7, 10, 99, 100, -100, 12345, 1000000000, INT_MAX, INT_MIN, INT_MIN + 1 };
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+        size_t length = format_int(text, samples[i]);
+        text[length] = '\0';
+        snprintf(expected, sizeof(expected), "%d", samples[i]);
+        assert(strcmp(text, expected) == 0);
+    }
+
+    Array arr;
+    assert(array_init(&arr) == 1);
+    assert(array_format(&arr, text, sizeof(text), NULL) == strlen("Array elements: | \n"));
+    assert(strcmp(text, "Array elements: | \n") == 0); // Same text array_print always gave
+    int values[] = { 3, -1, 40, INT_MIN, 5 };
+    assert(array_append_n(&arr, values, 5) == 1);
+    assert(array_format(&arr, text, sizeof(text), NULL) > 0);
+    snprintf(expected, sizeof(expected), "Array elements: | 3 | -1 | 40 | %d | 5 | \n", INT_MIN);
+    assert(strcmp(text, expected) == 0);
+
+    // Custom layout with a range and truncation
+    struct FormatOptions options;
+    format_options_default(&options);
+    options.prefix = "[";
+    options.suffix = "]";
+    assert(array_format(&arr, text, sizeof(text), &options) == strlen(text));
+    snprintf(expected, sizeof(expected), "[3, -1, 40, %d, 5]", INT_MIN);
+    assert(strcmp(text, expected) == 0);
+    options.start = 1;
+    options.limit = 2;
+    options.truncated = ", ...";
+    array_format(&arr, text, sizeof(text), &options);
+    assert(strcmp(text, "[-1, 40, ...]") == 0);
+    options.start = 3;
+    options.limit = 2; // Exactly reaches the end: no marker
+    array_format(&arr, text, sizeof(text), &options);
+    snprintf(expected, sizeof(expected), "[%d, 5]", INT_MIN);
+    assert(strcmp(text, expected) == 0);
+    options.start = 10; // Past the end
+    array_format(&arr, text, sizeof(text), &options);
+    assert(strcmp(text, "[]") == 0);
+
+    // Small buffers truncate like snprintf and report the full length
+    format_options_default(&options);
+    char small[6];
+    snprintf(expected, sizeof(expected), "3, -1, 40, %d, 5", INT_MIN);
+    assert(array_format(&arr, small, sizeof(small), &options) == strlen(expected));
+    assert(strcmp(small, "3, -1") == 0);
+    assert(array_format(&arr, NULL, 0, &options) == strlen(expected)); // Just measures
+
+    // A large array through a FILE* matches the buffer rendering byte for byte
+    for (int i = 0; i < 20000; i++) {
+        array_append(&arr, i * 7919 - 50000000);
+    }
+    size_t length = array_format(&arr, NULL, 0, NULL);
+    char *whole = malloc(length + 1);
+    char *read_back = malloc(length + 1);
+    assert(whole != NULL && read_back != NULL);
+    assert(array_format(&arr, whole, length + 1, NULL) == length);
+    FILE *file = tmpfile();
+    assert(file != NULL);
+    assert(array_fprint(&arr, file, NULL) == 1);
+    assert((size_t)ftell(file) == length);
+    rewind(file);
+    assert(fread(read_back, 1, length, file) == length);
+    assert(memcmp(whole, read_back, length) == 0);
+    fclose(file);
+    free(whole);
+    free(read_back);
+    array_destroy(&arr);
+    printf("Formatting tests passed.\n");
+}
+
+void test_inline_storage() {
+    printf("Testing inline (small-buffer) storage...\n");
+    Array arr;
+    assert(array_init_inline(&arr) == 1);
+    assert(arr.storage == ARRAY_STORAGE_INLINE && arr.data == arr.inline_data);
+    assert(arr.capacity == ARRAY_INLINE_CAPACITY && array_is_empty(&arr));
+
+    // Up to ARRAY_INLINE_CAPACITY elements nothing is allocated
+    for (int i = 0; i < ARRAY_INLINE_CAPACITY; i++) {
+        array_append(&arr, 50 - i);
+    }
+    assert(arr.data == arr.inline_data && arr.count == ARRAY_INLINE_CAPACITY);
+    assert(array_get(&arr, 1) == 50 && array_find(&arr, 45) == 6);
+    assert(array_sort(&arr) == 1 && array_get(&arr, 1) == 43);
+    array_delete_at(&arr, 1);
+    assert(array_shrink_to_fit(&arr) == 1 && arr.data == arr.inline_data); // Nothing to give back
+    array_append(&arr, 51);
+    assert(arr.data == arr.inline_data && array_is_sorted(&arr) == 1);
+
+    // One more spills to the heap with everything in place
+    array_append(&arr, 52);
+    assert(arr.storage == ARRAY_STORAGE_HEAP && arr.data != arr.inline_data);
+    assert(arr.capacity == 2 * ARRAY_INLINE_CAPACITY && arr.count == ARRAY_INLINE_CAPACITY + 1);
+    for (int i = 1; i <= 7; i++) {
+        assert(array_get(&arr, i) == 43 + i);
+    }
+    assert(array_get(&arr, 8) == 51 && array_get(&arr, 9) == 52 && array_is_sorted(&arr) == 1);
+    assert(array_shrink_to_fit(&arr) == 1 && arr.capacity == 9);
+    array_destroy(&arr);
+    assert(arr.data == NULL && arr.count == 0);
+
+    // Batch operations spill in one step; destroy after a spill frees the heap buffer
+    int values[20];
+    for (int i = 0; i < 20; i++) {
+        values[i] = i;
+    }
+    assert(array_init_inline(&arr) == 1);
+    assert(array_append_n(&arr, values, 3) == 1);
+    assert(array_insert_range(&arr, 2, values + 10, 2) == 1); // 0 10 11 1 2
+    assert(arr.data == arr.inline_data && array_get(&arr, 3) == 11);
+    assert(array_insert_range(&arr, 1, values, 20) == 1);
+    assert(arr.storage == ARRAY_STORAGE_HEAP && arr.count == 25);
+    assert(array_get(&arr, 20) == 19 && array_get(&arr, 22) == 10 && array_get(&arr, 25) == 2);
+    array_destroy(&arr);
+
+#ifdef __linux__
+    // Straight from inline to a mapping
+    assert(array_init_inline(&arr) == 1);
+    array_append(&arr, 7);
+    assert(array_reserve(&arr, ARRAY_HUGE_THRESHOLD / sizeof(int)) == 1);
+    assert(arr.storage == ARRAY_STORAGE_MAPPED && array_get(&arr, 1) == 7);
+    array_destroy(&arr);
+#endif
+    printf("Inline storage tests passed.\n");
+}
+
+// Callbacks for the one-pass helpers
+static int times_ten(int value, void *ctx) {
+    (void)ctx;
+    return value * 10;
+}
+
+static int is_multiple(int value, void *ctx) {
+    return value % *(int *)ctx == 0;
+}
+
+static long long add_value(long long acc, int value, void *ctx) {
+    (*(int *)ctx)++; // Counts the calls
+    return acc + value;
+}
+
+void test_iteration() {
+    printf("Testing array iterators and map/filter/fold...\n");
+    Array arr;
+    assert(array_init(&arr) == 1);
+    ArrayIterator it;
+    array_iter_init(&it, &arr);
+    assert(array_iter_valid(&it) == 0);
+    assert(array_iter_get(&it) == INT_MIN);
+    assert(array_iter_erase(&it) == 0);
+    for (int i = 1; i <= 5; i++) {
+        assert(array_iter_insert_after(&it, i) == 1); // Past the end: appends 1..5 in order
+    }
+    assert(arr.count == 5 && array_iter_valid(&it) == 0);
+
+    // One pass that rewrites, inserts after odd values and erases multiples of 4
+    array_iter_init(&it, &arr);
+    assert(array_iter_position(&it) == 1);
+    while (array_iter_valid(&it)) {
+        int value = array_iter_get(&it);
+        if (value % 4 == 0) {
+            assert(array_iter_erase(&it) == 1); // Now on the next element
+            continue;
+        }
+        assert(array_iter_set(&it, value * 100) == 1);
+        if (value % 2 == 1) {
+            assert(array_iter_insert_after(&it, -value) == 1);
+            array_iter_next(&it); // Step over the inserted element
+        }
+        array_iter_next(&it);
+    }
+    // 100 -1 200 300 -3 500 -5
+    int expected[] = { 100, -1, 200, 300, -3, 500, -5 };
+    assert(arr.count == 7);
+    for (int i = 0; i < 7; i++) {
+        assert(array_get(&arr, i + 1) == expected[i]);
+    }
+
+    // Sorted mode survives an in-order set and leaves on an out-of-order one
+    array_sort(&arr); // -5 -3 -1 100 200 300 500
+    array_iter_init(&it, &arr);
+    array_iter_next(&it);
+    assert(array_iter_set(&it, -4) == 1 && array_is_sorted(&arr) == 1);
+    assert(array_iter_set(&it, 1000) == 1 && array_is_sorted(&arr) == 0);
+
+    // map / filter / fold
+    array_destroy(&arr);
+    assert(array_init(&arr) == 1);
+    for (int i = 1; i <= 10; i++) {
+        array_append(&arr, i);
+    }
+    array_sort(&arr); // Enter sorted mode
+    assert(array_map(&arr, times_ten, NULL) == 1); // 10 20 ... 100
+    assert(array_get(&arr, 10) == 100 && array_is_sorted(&arr) == 1);
+    int divisor = 20;
+    assert(array_filter(&arr, is_multiple, &divisor) == 1); // 20 40 60 80 100
+    assert(arr.count == 5 && array_get(&arr, 1) == 20 && array_get(&arr, 5) == 100);
+    assert(array_is_sorted(&arr) == 1);
+    int calls = 0;
+    assert(array_fold(&arr, 1, add_value, &calls) == 301);
+    assert(calls == 5);
+    assert(array_map(NULL, times_ten, NULL) == 0);
+    assert(array_filter(&arr, NULL, NULL) == 0);
+
+    array_destroy(&arr);
+    printf("Array iterator tests passed.\n");
+}
+
 int main() {
     Array array;           // Allocate the struct itself on the stack
     Array *arr = &array;   // Create a pointer pointing to it
 
     // --- Initialization ---
-    // Using start_array based on your previous image for init function name
-    if (!start_array(arr)) {
+    if (!array_init(arr)) {
         printf("Failed to initialize dynamic array.\n");
         return 1; // Exit if initialization failed
     }
@@ -32,18 +640,18 @@ int main() {
     for (int i = 0; i < 15; i++) {
         array_append(arr, i * 10); // Use array_append
         // Check state after each append
-        assert(arr->count == i + 1);
+        assert(arr->count == (size_t)i + 1);
         // Verify the last added element using array_get (assuming 1-based index)
         assert(array_get(arr, i + 1) == i * 10);
     }
-    printf("Elements added successfully. Count: %d, Capacity: %d\n", arr->count, arr->capacity);
+    printf("Elements added successfully. Count: %zu, Capacity: %zu\n", arr->count, arr->capacity);
     // Optional: Print the array to see the content
     array_print(arr);
 
     // --- Test Resizing ---
     printf("Testing array resizing (implicitly tested by append)...\n");
     assert(arr->capacity >= 15); // Ensure capacity increased during appends
-    printf("Array resized successfully (Capacity is now %d).\n", arr->capacity);
+    printf("Array resized successfully (Capacity is now %zu).\n", arr->capacity);
 
     // --- Test Getting Elements ---
     printf("Testing array_get...\n");
@@ -67,25 +675,69 @@ int main() {
     array_delete_at(arr, 5); // Delete 1-based index 5
     assert(arr->count == 14);
     assert(array_find(arr, value_at_index_5) == -1); // Should not find 40 anymore
-    printf("Deleted element at index 5. Count: %d\n", arr->count);
+    printf("Deleted element at index 5. Count: %zu\n", arr->count);
 
     // Delete from the beginning
     int first_value = array_get(arr, 1); // Get value before deleting
     array_delete_at(arr, 1); // Delete 1-based index 1
     assert(arr->count == 13);
     assert(array_find(arr, first_value) == -1);
-    printf("Deleted element at index 1. Count: %d\n", arr->count);
+    printf("Deleted element at index 1. Count: %zu\n", arr->count);
 
     // Delete from the end
     int last_value = array_get(arr, arr->count); // Get value before deleting (count is now 13)
     array_delete_at(arr, arr->count); // Delete last element (1-based index is current count)
     assert(arr->count == 12);
     assert(array_find(arr, last_value) == -1);
-    printf("Deleted element at end. Count: %d\n", arr->count);
+    printf("Deleted element at end. Count: %zu\n", arr->count);
 
     printf("Elements deleted successfully.\n");
     array_print(arr);
 
+    // --- Test Bulk Operations ---
+    printf("Testing bulk operations (append_n, insert_range, delete_range, reserve)...\n");
+    // Array is now: 10 20 30 50 60 70 80 90 100 110 120 130
+    int batch[] = {1000, 1001, 1002, 1003};
+    assert(array_append_n(arr, batch, 4) == 1);
+    assert(arr->count == 16);
+    assert(array_get(arr, 13) == 1000);
+    assert(array_get(arr, 16) == 1003);
+
+    int middle[] = {-1, -2, -3};
+    assert(array_insert_range(arr, 2, middle, 3) == 1); // 10 -1 -2 -3 20 ...
+    assert(arr->count == 19);
+    assert(array_get(arr, 1) == 10);
+    assert(array_get(arr, 2) == -1);
+    assert(array_get(arr, 4) == -3);
+    assert(array_get(arr, 5) == 20);
+    assert(array_insert_range(arr, 1, middle, 1) == 1); // Insert at the front
+    assert(array_get(arr, 1) == -1);
+    assert(array_insert_range(arr, arr->count + 1, batch, 1) == 1); // Insert at the end
+    assert(array_get(arr, arr->count) == 1000);
+    assert(array_insert_range(arr, arr->count + 2, batch, 1) == 0); // Past the end
+    assert(arr->count == 21);
+
+    assert(array_delete_range(arr, 3, 3) == 1); // Removes -1 -2 -3 after the 10
+    assert(arr->count == 18);
+    assert(array_get(arr, 2) == 10);
+    assert(array_get(arr, 3) == 20);
+    assert(array_delete_range(arr, 17, 5) == 0); // Runs past the end, nothing removed
+    assert(arr->count == 18);
+    assert(array_delete_range(arr, 14, 5) == 1); // Removes the 1000..1003 batch and trailing 1000
+    assert(arr->count == 13);
+    assert(array_find(arr, 1000) == -1);
+    assert(array_delete_range(arr, 1, 1) == 1); // Removes the leading -1
+    assert(array_get(arr, 1) == 10);
+    assert(array_get(arr, 12) == 130);
+
+    assert(array_reserve(arr, 1000) == 1);
+    assert(arr->capacity >= 1000);
+    assert(arr->count == 12);
+    assert(array_shrink_to_fit(arr) == 1);
+    assert(arr->capacity == 12);
+    assert(array_get(arr, 12) == 130);
+    printf("Bulk operation tests passed.\n");
+
     // --- Test Destroy (was array_clear) ---
     printf("Destroying array using array_destroy...\n");
     array_destroy(arr); // Use array_destroy
@@ -97,7 +749,7 @@ int main() {
     // --- Test Edge Cases on Destroyed/Empty Array ---
     printf("Testing edge cases on empty/destroyed array...\n");
     // Re-initialize to test deleting from empty after destroy
-    if (!start_array(arr)) { return 1; } // Re-initialize for safety checks
+    if (!array_init(arr)) { return 1; } // Re-initialize for safety checks
     array_delete_at(arr, 1); // Deleting from an empty array (should print msg & return)
     assert(arr->count == 0); // Count should remain 0
     assert(array_get(arr, 1) == INT_MIN);    // Accessing invalid index 1
@@ -106,6 +758,16 @@ int main() {
     printf("Edge cases handled successfully.\n");
 
 
+    test_growth_policies();
+    test_scan_kernels();
+    test_sorted_mode();
+    test_int_max_positions();
+    test_self_aliasing();
+    test_persistence();
+    test_formatting();
+    test_iteration();
+    test_inline_storage();
+
     printf("\nAll dynamic array tests passed (if no assertions failed).\n");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h>
+
+#include "array_index.h" // Include the header for the hash index
+
+// Helper: the index must answer exactly what the array scans answer
+static void check_against_array(ArrayIndex *index, Array *arr, int lo, int hi) {
+    for (int v = lo; v <= hi; v++) {
+        assert(array_index_find(index, v) == array_find(arr, v));
+        assert(array_index_count(index, v) == array_count(arr, v));
+        assert(array_index_contains(index, v) == (array_find(arr, v) != -1));
+    }
+}
+
+void test_build_and_find() {
+    printf("Testing array_index_build and lookups...\n");
+    Array arr;
+    ArrayIndex index;
+    array_init(&arr);
+
+    // Empty array
+    assert(array_index_build(&index, &arr) == 1);
+    assert(array_index_size(&index) == 0);
+    assert(array_index_find(&index, 0) == -1);
+    assert(array_index_count(&index, 0) == 0);
+    array_index_destroy(&index);
+
+    // Duplicates, negatives and the int extremes; first occurrences win
+    int values[] = { 5, -3, 5, INT_MIN, 7, INT_MAX, -3, 5, 0 };
+    array_append_n(&arr, values, 9);
+    assert(array_index_build(&index, &arr) == 1);
+    assert(array_index_size(&index) == 6);
+    assert(array_index_find(&index, 5) == 1);
+    assert(array_index_find(&index, -3) == 2);
+    assert(array_index_find(&index, INT_MIN) == 4);
+    assert(array_index_find(&index, INT_MAX) == 6);
+    assert(array_index_find(&index, 0) == 9);
+    assert(array_index_find(&index, 6) == -1);
+    assert(array_index_count(&index, 5) == 3);
+    assert(array_index_contains(&index, 7) == 1);
+    assert(array_index_contains(&index, 8) == 0);
+    check_against_array(&index, &arr, -10, 10);
+
+    // A first occurrence past INT_MAX (faked in the slot) is reported as -1, like array_find
+    for (size_t i = 0; i < index.capacity; i++) {
+        if (index.slots[i].distance != 0 && index.slots[i].key == 7) {
+            index.slots[i].position = (size_t)INT_MAX + 1;
+        }
+    }
+    assert(array_index_find(&index, 7) == -1);
+    assert(array_index_contains(&index, 7) == 1);
+    array_index_destroy(&index);
+    assert(index.slots == NULL && index.capacity == 0);
+    assert(array_index_find(&index, 5) == -1); // Destroyed index finds nothing
+
+    // Many keys sharing low bits, so probe sequences collide and get displaced
+    array_destroy(&arr);
+    array_init(&arr);
+    for (int i = 0; i < 5000; i++) {
+        array_append(&arr, i * 4096);
+    }
+    assert(array_index_build(&index, &arr) == 1);
+    assert(array_index_size(&index) == 5000);
+    for (int i = 0; i < 5000; i++) {
+        assert(array_index_find(&index, i * 4096) == i + 1);
+        assert(array_index_find(&index, i * 4096 + 1) == -1);
+    }
+    array_index_destroy(&index);
+    array_destroy(&arr);
+    printf("Build and find tests passed.\n");
+}
+
+void test_append_and_delete() {
+    printf("Testing array_index_append and array_index_delete_at...\n");
+    Array arr;
+    ArrayIndex index;
+    array_init(&arr);
+    assert(array_index_build(&index, &arr) == 1);
+
+    // Dedup loop: only unseen values are appended; the table grows along the way
+    srand(12345);
+    for (int i = 0; i < 20000; i++) {
+        int value = rand() % 3000 - 1500;
+        if (array_index_find(&index, value) == -1) {
+            assert(array_index_append(&index, value) == 1);
+        }
+    }
+    assert(array_index_size(&index) == array_size(&arr));
+    for (size_t i = 1; i <= array_size(&arr); i++) {
+        assert(array_index_count(&index, array_get(&arr, (int)i)) == 1); // No duplicates left
+        assert(array_index_find(&index, array_get(&arr, (int)i)) == (int)i);
+    }
+    check_against_array(&index, &arr, -1600, 1600);
+
+    // Now with duplicates: append and delete at random spots, checking against the scans
+    for (int i = 0; i < 3000; i++) {
+        int value = rand() % 40;
+        assert(array_index_append(&index, value) == 1);
+    }
+    for (int round = 0; round < 4000; round++) {
+        int r = rand() % 4;
+        if (r == 0 && array_size(&arr) > 0) {
+            assert(array_index_delete_at(&index, (int)array_size(&arr)) == 1); // Last element
+        } else if (r == 1 && array_size(&arr) > 0) {
+            assert(array_index_delete_at(&index, rand() % (int)array_size(&arr) + 1) == 1);
+        } else {
+            assert(array_index_append(&index, rand() % 60 - 10) == 1);
+        }
+        if (round % 500 == 0) {
+            check_against_array(&index, &arr, -20, 60);
+        }
+    }
+    check_against_array(&index, &arr, -1600, 1600);
+
+    // Deleting the first occurrence moves the position to the next one
+    array_index_destroy(&index);
+    array_destroy(&arr);
+    array_init(&arr);
+    int values[] = { 1, 2, 1, 3, 1 };
+    array_append_n(&arr, values, 5);
+    assert(array_index_build(&index, &arr) == 1); // Rebuilt after the direct changes
+    assert(array_index_delete_at(&index, 1) == 1); // {2, 1, 3, 1}
+    assert(array_index_find(&index, 1) == 2 && array_index_count(&index, 1) == 2);
+    assert(array_index_find(&index, 3) == 3);
+    assert(array_index_delete_at(&index, 2) == 1); // {2, 3, 1}
+    assert(array_index_find(&index, 1) == 3);
+    assert(array_index_delete_at(&index, 1) == 1); // {3, 1}
+    assert(array_index_find(&index, 2) == -1 && array_index_size(&index) == 2);
+    assert(array_index_delete_at(&index, 0) == 0); // Prints "Index out of bounds"
+    assert(array_index_delete_at(&index, 3) == 0);
+    check_against_array(&index, &arr, 0, 4);
+
+    array_index_destroy(&index);
+    array_destroy(&arr);
+    printf("Append and delete tests passed.\n");
+}
+
+int main() {
+    test_build_and_find();
+    test_append_and_delete();
+
+    printf("\nAll array index tests passed (if no assertions failed)!\n");
+    return 0;
+}
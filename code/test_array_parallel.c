@@ -0,0 +1,236 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h>
+#include <stdatomic.h>
+
+#include "array_parallel.h" // Include the header for the parallel operations
+
+#define THREADS 4
+#define LARGE (ARRAY_PARALLEL_THRESHOLD * 5 + 12345) // Many chunks, ragged last one
+
+// Callbacks (all safe to run on several threads at once)
+static void count_visit(int value, size_t index, void *ctx) {
+    atomic_llong *totals = ctx;
+    atomic_fetch_add(&totals[0], value);
+    atomic_fetch_add(&totals[1], (long long)index);
+}
+
+static long long add_value(long long acc, int value, void *ctx) {
+    (void)ctx;
+    return acc + value;
+}
+
+static long long add_partials(long long left, long long right, void *ctx) {
+    (void)ctx;
+    return left + right;
+}
+
+static long long max_value(long long acc, int value, void *ctx) {
+    (void)ctx;
+    return value > acc ? value : acc;
+}
+
+static long long max_partials(long long left, long long right, void *ctx) {
+    (void)ctx;
+    return right > left ? right : left;
+}
+
+static int double_value(int value, void *ctx) {
+    (void)ctx;
+    return value * 2;
+}
+
+static int negate(int value, void *ctx) {
+    (void)ctx;
+    return -value;
+}
+
+static int is_multiple(int value, void *ctx) {
+    return value % *(int *)ctx == 0;
+}
+
+static void task_mark(void *arg, size_t chunk) {
+    atomic_int *hits = arg;
+    atomic_fetch_add(&hits[chunk], 1);
+}
+
+// Helper: fills 'arr' with 'n' pseudo-random values in [-range, range), with duplicates
+static void fill_random(Array *arr, size_t n, int range, unsigned int seed) {
+    srand(seed);
+    for (size_t i = 0; i < n; i++) {
+        array_append(arr, rand() % (2 * range) - range);
+    }
+}
+
+void test_thread_pool() {
+    printf("Testing thread pool...\n");
+    struct ThreadPool pool;
+    assert(thread_pool_init(&pool, THREADS) == 1);
+    assert(thread_pool_size(&pool) == THREADS);
+    assert(thread_pool_size(NULL) == 1);
+
+    // Every chunk runs exactly once, job after job
+    enum { CHUNKS = 1000 };
+    atomic_int *hits = calloc(CHUNKS, sizeof(atomic_int));
+    assert(hits != NULL);
+    for (int job = 1; job <= 50; job++) {
+        thread_pool_run(&pool, task_mark, hits, (size_t)(job % 7 == 0 ? 1 : CHUNKS));
+    }
+    assert(hits[0] == 50);
+    for (int c = 1; c < CHUNKS; c++) {
+        assert(hits[c] == 50 - 7); // Jobs 7, 14, ..., 49 had one chunk
+    }
+    thread_pool_run(&pool, task_mark, hits, 0); // No-op
+    assert(hits[0] == 50);
+    thread_pool_destroy(&pool);
+
+    // Inline pool and the default size
+    assert(thread_pool_init(&pool, 1) == 1);
+    thread_pool_run(&pool, task_mark, hits, 3);
+    assert(hits[2] == 44);
+    thread_pool_destroy(&pool);
+    assert(thread_pool_init(&pool, 0) == 1);
+    assert(thread_pool_size(&pool) >= 1);
+    thread_pool_destroy(&pool);
+    free(hits);
+    printf("Thread pool tests passed.\n");
+}
+
+void test_for_each_and_reduce() {
+    printf("Testing parallel for_each and reduce...\n");
+    struct ThreadPool pool;
+    assert(thread_pool_init(&pool, THREADS) == 1);
+    Array arr;
+    assert(array_init(&arr) == 1);
+    fill_random(&arr, LARGE, 1000000, 7);
+
+    atomic_llong totals[2];
+    atomic_init(&totals[0], 0);
+    atomic_init(&totals[1], 0);
+    assert(array_parallel_for_each(&pool, &arr, count_visit, totals) == 1);
+    long long expected_sum = array_fold(&arr, 0, add_value, NULL);
+    assert(totals[0] == expected_sum);
+    assert(totals[1] == (long long)LARGE * (LARGE + 1) / 2); // Each 1-based index once
+
+    assert(array_parallel_reduce(&pool, &arr, 0, add_value, add_partials, NULL) == expected_sum);
+    assert(array_parallel_reduce(&pool, &arr, LLONG_MIN, max_value, max_partials, NULL) ==
+           array_fold(&arr, LLONG_MIN, max_value, NULL));
+    assert(array_parallel_reduce(NULL, &arr, 0, add_value, add_partials, NULL) == expected_sum); // Serial
+    assert(array_parallel_reduce(&pool, &arr, 5, NULL, add_partials, NULL) == 5);
+    assert(array_parallel_for_each(&pool, NULL, count_visit, totals) == 0);
+
+    // Small arrays take the serial path and give the same answers
+    Array small;
+    assert(array_init(&small) == 1);
+    for (int i = 1; i <= 100; i++) {
+        array_append(&small, i);
+    }
+    assert(array_parallel_reduce(&pool, &small, 0, add_value, add_partials, NULL) == 5050);
+    atomic_store(&totals[1], 0);
+    assert(array_parallel_for_each(&pool, &small, count_visit, totals) == 1);
+    assert(totals[1] == 5050);
+
+    array_destroy(&small);
+    array_destroy(&arr);
+    thread_pool_destroy(&pool);
+    printf("Parallel for_each/reduce tests passed.\n");
+}
+
+void test_transform_and_filter() {
+    printf("Testing parallel transform and filter...\n");
+    struct ThreadPool pool;
+    assert(thread_pool_init(&pool, THREADS) == 1);
+    Array arr, ref;
+    assert(array_init(&arr) == 1);
+    assert(array_init(&ref) == 1);
+    fill_random(&arr, LARGE, 1000000, 11);
+    fill_random(&ref, LARGE, 1000000, 11);
+
+    assert(array_parallel_transform(&pool, &arr, double_value, NULL) == 1);
+    assert(array_map(&ref, double_value, NULL) == 1);
+    for (size_t i = 0; i < LARGE; i++) {
+        assert(arr.data[i] == ref.data[i]);
+    }
+
+    // Stable: the survivors come out in their original order
+    int divisor = 3;
+    assert(array_parallel_filter(&pool, &arr, is_multiple, &divisor) == 1);
+    assert(array_filter(&ref, is_multiple, &divisor) == 1);
+    assert(arr.count == ref.count && arr.count > 0 && arr.count < LARGE);
+    for (size_t i = 0; i < arr.count; i++) {
+        assert(arr.data[i] == ref.data[i]);
+    }
+    assert(array_parallel_filter(&pool, &arr, NULL, NULL) == 0);
+
+    // Sorted mode: kept by an order-preserving map and by filtering, left on a reversal
+    array_destroy(&arr);
+    assert(array_init(&arr) == 1);
+    for (int i = 0; i < LARGE; i++) {
+        array_append(&arr, i);
+    }
+    array_sort(&arr);
+    assert(array_parallel_transform(&pool, &arr, double_value, NULL) == 1);
+    assert(array_is_sorted(&arr) == 1);
+    divisor = 4;
+    assert(array_parallel_filter(&pool, &arr, is_multiple, &divisor) == 1);
+    assert(arr.count == (LARGE + 1) / 2 && array_is_sorted(&arr) == 1);
+    assert(array_parallel_transform(&pool, &arr, negate, NULL) == 1);
+    assert(array_is_sorted(&arr) == 0);
+
+    array_destroy(&ref);
+    array_destroy(&arr);
+    thread_pool_destroy(&pool);
+    printf("Parallel transform/filter tests passed.\n");
+}
+
+void test_sort() {
+    printf("Testing parallel sort...\n");
+    struct ThreadPool pool;
+    assert(thread_pool_init(&pool, THREADS) == 1);
+    // Sizes that give odd and even numbers of merge rounds and a ragged last chunk
+    size_t sizes[] = { ARRAY_PARALLEL_THRESHOLD, ARRAY_PARALLEL_THRESHOLD * 2 + 1, LARGE, 1000 };
+    for (int s = 0; s < 4; s++) {
+        Array arr, ref;
+        assert(array_init(&arr) == 1);
+        assert(array_init(&ref) == 1);
+        int range = (s == 1) ? 50 : INT_MAX / 2; // s == 1: heavy duplicates
+        fill_random(&arr, sizes[s], range, 100 + s);
+        fill_random(&ref, sizes[s], range, 100 + s);
+        assert(array_parallel_sort(&pool, &arr) == 1);
+        assert(array_sort(&ref) == 1);
+        assert(array_is_sorted(&arr) == 1);
+        for (size_t i = 0; i < sizes[s]; i++) {
+            assert(arr.data[i] == ref.data[i]);
+        }
+        array_destroy(&ref);
+        array_destroy(&arr);
+    }
+
+    // array_sort_range leaves everything outside the range alone
+    Array arr;
+    assert(array_init(&arr) == 1);
+    int values[] = { 9, 8, 7, 6, 5, 4, 3 };
+    assert(array_append_n(&arr, values, 7) == 1);
+    assert(array_sort_range(&arr, 2, 4) == 1); // 9 5 6 7 8 4 3
+    assert(array_get(&arr, 1) == 9 && array_get(&arr, 2) == 5 && array_get(&arr, 5) == 8);
+    assert(array_get(&arr, 6) == 4 && array_is_sorted(&arr) == 0);
+    assert(array_sort_range(&arr, 5, 4) == 0); // Runs past the end
+    assert(array_sort_range(&arr, 0, 1) == 0);
+    assert(array_sort_range(&arr, 1, 7) == 1 && array_is_sorted(&arr) == 1); // Whole array
+    array_destroy(&arr);
+
+    assert(array_parallel_sort(&pool, NULL) == 0);
+    thread_pool_destroy(&pool);
+    printf("Parallel sort tests passed.\n");
+}
+
+int main() {
+    test_thread_pool();
+    test_for_each_and_reduce();
+    test_transform_and_filter();
+    test_sort();
+
+    printf("\nAll parallel array tests passed (if no assertions failed)!\n");
+    return 0;
+}
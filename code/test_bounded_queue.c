@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h> // For sched_yield while a queue is full or empty
+
+#include "bounded_queue.h" // Include the header for the SPSC and MPMC queues
+
+#define SPSC_ITEMS 1000000
+#define MPMC_THREADS 4         // Producers, and as many consumers
+#define MPMC_PER_PRODUCER 200000
+
+void test_spsc_single_thread() {
+    printf("Testing SPSC queue on one thread...\n");
+    struct SpscQueue q;
+    assert(spsc_queue_init(&q, 5) == 1);
+    assert(spsc_queue_capacity(&q) == 8); // Rounded up to a power of two
+    int value = 777;
+    assert(spsc_queue_pop(&q, &value) == false);
+    assert(value == 777);
+
+    // Fill, overflow, drain in FIFO order; repeat so the indices wrap the buffer
+    for (int lap = 0; lap < 3; lap++) {
+        for (int i = 0; i < 8; i++) {
+            assert(spsc_queue_push(&q, lap * 100 + i) == true);
+        }
+        assert(spsc_queue_push(&q, -1) == false); // Full
+        assert(spsc_queue_size(&q) == 8);
+        for (int i = 0; i < 8; i++) {
+            assert(spsc_queue_pop(&q, &value) == true && value == lap * 100 + i);
+        }
+        assert(spsc_queue_size(&q) == 0);
+    }
+
+    // Batches straddle the end of the buffer and stop at the capacity
+    int values[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    int out[12];
+    assert(spsc_queue_push_n(&q, values, 5) == 5);
+    assert(spsc_queue_pop_n(&q, out, 3) == 3 && out[2] == 3);
+    assert(spsc_queue_push_n(&q, values, 12) == 6); // Only 6 slots free
+    assert(spsc_queue_pop_n(&q, out, 12) == 8);
+    assert(out[0] == 4 && out[1] == 5 && out[2] == 1 && out[7] == 6);
+    assert(spsc_queue_pop_n(&q, out, 4) == 0);
+
+    spsc_queue_destroy(&q);
+    assert(q.slots == NULL);
+    printf("SPSC single-thread tests passed.\n");
+}
+
+static void *spsc_producer(void *arg) {
+    struct SpscQueue *q = arg;
+    int batch[37];
+    int next = 0;
+    while (next < SPSC_ITEMS) {
+        if (next % 3 == 0) {
+            // Mix single pushes with batches
+            while (!spsc_queue_push(q, next)) {
+                sched_yield(); // Let the consumer run (matters on a single core)
+            }
+            next++;
+            continue;
+        }
+        int n = SPSC_ITEMS - next < 37 ? SPSC_ITEMS - next : 37;
+        for (int i = 0; i < n; i++) {
+            batch[i] = next + i;
+        }
+        size_t done = 0;
+        while (done < (size_t)n) {
+            size_t pushed = spsc_queue_push_n(q, batch + done, (size_t)n - done);
+            if (pushed == 0) {
+                sched_yield();
+            }
+            done += pushed;
+        }
+        next += n;
+    }
+    return NULL;
+}
+
+void test_spsc_threads() {
+    printf("Testing SPSC queue with a producer and a consumer thread...\n");
+    struct SpscQueue q;
+    assert(spsc_queue_init(&q, 64) == 1); // Small, so both sides hit full and empty often
+    pthread_t producer;
+    assert(pthread_create(&producer, NULL, spsc_producer, &q) == 0);
+
+    int expected = 0;
+    int out[16];
+    while (expected < SPSC_ITEMS) {
+        size_t n = spsc_queue_pop_n(&q, out, (size_t)(expected % 16) + 1);
+        if (n == 0) {
+            sched_yield();
+        }
+        for (size_t i = 0; i < n; i++) {
+            assert(out[i] == expected); // Strict FIFO, nothing lost or duplicated
+            expected++;
+        }
+    }
+    pthread_join(producer, NULL);
+    assert(spsc_queue_size(&q) == 0);
+    spsc_queue_destroy(&q);
+    printf("SPSC threaded tests passed.\n");
+}
+
+void test_mpmc_single_thread() {
+    printf("Testing MPMC queue on one thread...\n");
+    struct MpmcQueue q;
+    assert(mpmc_queue_init(&q, 1) == 1);
+    assert(mpmc_queue_capacity(&q) == 2); // Minimum capacity
+    mpmc_queue_destroy(&q);
+
+    assert(mpmc_queue_init(&q, 4) == 1);
+    int value = 555;
+    assert(mpmc_queue_pop(&q, &value) == false && value == 555);
+    for (int lap = 0; lap < 5; lap++) {
+        for (int i = 0; i < 4; i++) {
+            assert(mpmc_queue_push(&q, lap * 10 + i) == true);
+        }
+        assert(mpmc_queue_push(&q, -1) == false); // Full
+        assert(mpmc_queue_size(&q) == 4);
+        for (int i = 0; i < 4; i++) {
+            assert(mpmc_queue_pop(&q, &value) == true && value == lap * 10 + i);
+        }
+        assert(mpmc_queue_pop(&q, &value) == false);
+    }
+    mpmc_queue_destroy(&q);
+    assert(q.slots == NULL);
+    printf("MPMC single-thread tests passed.\n");
+}
+
+struct MpmcArgs {
+    struct MpmcQueue *q;
+    int id;
+    atomic_int *consumed; // Shared count of popped values
+    char *seen;           // One flag per value
+    int *last_seen;       // Consumer: last value seen from each producer
+};
+
+static void *mpmc_producer(void *arg) {
+    struct MpmcArgs *args = arg;
+    int base = args->id * MPMC_PER_PRODUCER;
+    for (int i = 0; i < MPMC_PER_PRODUCER; i++) {
+        while (!mpmc_queue_push(args->q, base + i)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *mpmc_consumer(void *arg) {
+    struct MpmcArgs *args = arg;
+    const int total = MPMC_THREADS * MPMC_PER_PRODUCER;
+    int value;
+    while (atomic_load(args->consumed) < total) {
+        if (!mpmc_queue_pop(args->q, &value)) {
+            sched_yield();
+            continue;
+        }
+        assert(value >= 0 && value < total);
+        assert(args->seen[value] == 0);
+        args->seen[value] = 1; // Each value is popped once, so no two threads share a flag
+        int producer = value / MPMC_PER_PRODUCER;
+        assert(value > args->last_seen[producer]); // One producer's values stay in order
+        args->last_seen[producer] = value;
+        atomic_fetch_add(args->consumed, 1);
+    }
+    return NULL;
+}
+
+void test_mpmc_threads() {
+    printf("Testing MPMC queue with %d producers and %d consumers...\n", MPMC_THREADS, MPMC_THREADS);
+    struct MpmcQueue q;
+    assert(mpmc_queue_init(&q, 128) == 1);
+    const int total = MPMC_THREADS * MPMC_PER_PRODUCER;
+    char *seen = calloc((size_t)total, 1);
+    assert(seen != NULL);
+    atomic_int consumed;
+    atomic_init(&consumed, 0);
+
+    pthread_t producers[MPMC_THREADS], consumers[MPMC_THREADS];
+    struct MpmcArgs producer_args[MPMC_THREADS], consumer_args[MPMC_THREADS];
+    int last_seen[MPMC_THREADS][MPMC_THREADS];
+    for (int t = 0; t < MPMC_THREADS; t++) {
+        for (int p = 0; p < MPMC_THREADS; p++) {
+            last_seen[t][p] = -1;
+        }
+        consumer_args[t] = (struct MpmcArgs){ &q, t, &consumed, seen, last_seen[t] };
+        producer_args[t] = (struct MpmcArgs){ &q, t, &consumed, seen, NULL };
+        assert(pthread_create(&consumers[t], NULL, mpmc_consumer, &consumer_args[t]) == 0);
+        assert(pthread_create(&producers[t], NULL, mpmc_producer, &producer_args[t]) == 0);
+    }
+    for (int t = 0; t < MPMC_THREADS; t++) {
+        pthread_join(producers[t], NULL);
+        pthread_join(consumers[t], NULL);
+    }
+
+    assert(atomic_load(&consumed) == total);
+    for (int i = 0; i < total; i++) {
+        assert(seen[i] == 1);
+    }
+    int value;
+    assert(mpmc_queue_pop(&q, &value) == false);
+    free(seen);
+    mpmc_queue_destroy(&q);
+    printf("MPMC threaded tests passed.\n");
+}
+
+int main() {
+    test_spsc_single_thread();
+    test_spsc_threads();
+    test_mpmc_single_thread();
+    test_mpmc_threads();
+
+    printf("\nAll bounded queue tests passed (if no assertions failed)!\n");
+    return 0;
+}
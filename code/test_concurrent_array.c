@@ -0,0 +1,188 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h> // Needed for INT_MIN checks
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "concurrent_array.h" // Include the header for the concurrent array
+#include "array_simd.h"       // To check the scan level picked by the worker threads
+
+#define WRITERS 4
+#define PER_WRITER 50000
+
+#define FIRST_FINDERS 4
+
+static ConcurrentArray probe;
+static pthread_barrier_t finders_ready;
+
+// Looks up values as soon as all finders are released, so the very first scans in the
+// process (which pick the SIMD level) happen on several threads at once
+static void *first_finder(void *arg) {
+    int id = (int)(size_t)arg;
+    pthread_barrier_wait(&finders_ready);
+    for (int i = 0; i < 200; i++) {
+        int value = (id * 200 + i) % 5000;
+        assert(concurrent_array_find(&probe, value) == value + 1);
+        ConcurrentArraySnapshot snap = concurrent_array_snapshot(&probe);
+        assert(concurrent_array_snapshot_find(&snap, -1 - value) == -1);
+    }
+    return NULL;
+}
+
+// Must run before anything else scans: the first calls come from worker threads
+void test_first_find_from_threads() {
+    printf("Testing first scans from %d threads at once...\n", FIRST_FINDERS);
+    assert(concurrent_array_init(&probe) == 1);
+    for (int i = 0; i < 5000; i++) {
+        concurrent_array_append(&probe, i);
+    }
+    pthread_t threads[FIRST_FINDERS];
+    assert(pthread_barrier_init(&finders_ready, NULL, FIRST_FINDERS) == 0);
+    for (int t = 0; t < FIRST_FINDERS; t++) {
+        assert(pthread_create(&threads[t], NULL, first_finder, (void *)(size_t)t) == 0);
+    }
+    for (int t = 0; t < FIRST_FINDERS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_barrier_destroy(&finders_ready);
+    printf("  level %s\n", array_simd_level_name(array_simd_level()));
+    concurrent_array_destroy(&probe);
+    printf("First-scan tests passed.\n");
+}
+
+void test_single_thread() {
+    printf("Testing concurrent array on one thread...\n");
+    ConcurrentArray arr;
+    assert(concurrent_array_init(&arr) == 1);
+    assert(concurrent_array_size(&arr) == 0);
+    assert(concurrent_array_get(&arr, 1) == INT_MIN);
+    assert(concurrent_array_find(&arr, 5) == -1);
+
+    // Cross several segment boundaries (1024, 3072, 7168)
+    for (int i = 0; i < 5000; i++) {
+        assert(concurrent_array_append(&arr, i * 2) == (size_t)i + 1);
+    }
+    int batch[4000];
+    for (int i = 0; i < 4000; i++) {
+        batch[i] = -i;
+    }
+    assert(concurrent_array_append_n(&arr, batch, 4000) == 5001); // Straddles 7168
+    assert(concurrent_array_append_n(&arr, batch, 0) == 0);
+    assert(concurrent_array_size(&arr) == 9000);
+
+    assert(concurrent_array_get(&arr, 1) == 0);
+    assert(concurrent_array_get(&arr, 1025) == 2048);
+    assert(concurrent_array_get(&arr, 5000) == 9998);
+    assert(concurrent_array_get(&arr, 5001) == 0);
+    assert(concurrent_array_get(&arr, 9000) == -3999);
+    assert(concurrent_array_get(&arr, 9001) == INT_MIN);
+    assert(concurrent_array_find(&arr, 9998) == 5000);
+    assert(concurrent_array_find(&arr, -3999) == 9000);
+    assert(concurrent_array_find(&arr, 1) == -1);
+
+    // A snapshot keeps its length while appends continue
+    ConcurrentArraySnapshot snap = concurrent_array_snapshot(&arr);
+    concurrent_array_append(&arr, 777);
+    assert(snap.count == 9000);
+    assert(concurrent_array_snapshot_get(&snap, 9001) == INT_MIN);
+    assert(concurrent_array_snapshot_find(&snap, 777) == -1);
+    assert(concurrent_array_find(&arr, 777) == 9001);
+
+    // Walking the segments visits every element in order
+    size_t seen = 0, length;
+    const int *run;
+    for (size_t s = 0; (run = concurrent_array_snapshot_segment(&snap, s, &length)) != NULL; s++) {
+        for (size_t i = 0; i < length; i++, seen++) {
+            assert(run[i] == concurrent_array_snapshot_get(&snap, seen + 1));
+        }
+    }
+    assert(seen == 9000);
+
+    concurrent_array_destroy(&arr);
+    assert(concurrent_array_size(&arr) == 0);
+    printf("Single-thread tests passed.\n");
+}
+
+static ConcurrentArray shared;
+static atomic_int writers_done;
+
+// Appends its own values: id * PER_WRITER + i, in batches of 1 and 10
+static void *writer(void *arg) {
+    int id = (int)(size_t)arg;
+    int base = id * PER_WRITER;
+    for (int i = 0; i < PER_WRITER;) {
+        if (i % 100 == 0 && i + 10 <= PER_WRITER) {
+            int batch[10];
+            for (int j = 0; j < 10; j++) {
+                batch[j] = base + i + j;
+            }
+            concurrent_array_append_n(&shared, batch, 10);
+            i += 10;
+        } else {
+            concurrent_array_append(&shared, base + i);
+            i++;
+        }
+    }
+    atomic_fetch_add(&writers_done, 1);
+    return NULL;
+}
+
+// Takes snapshots while writers run; every visible element must be a real value
+static void *reader(void *arg) {
+    (void)arg;
+    size_t last_count = 0;
+    while (atomic_load(&writers_done) < WRITERS) {
+        ConcurrentArraySnapshot snap = concurrent_array_snapshot(&shared);
+        assert(snap.count >= last_count); // Visibility only grows
+        last_count = snap.count;
+        if (snap.count > 0) {
+            int v = concurrent_array_snapshot_get(&snap, snap.count);
+            assert(v >= 0 && v < WRITERS * PER_WRITER);
+        }
+    }
+    return NULL;
+}
+
+void test_concurrent() {
+    printf("Testing concurrent array with %d writers and a reader...\n", WRITERS);
+    assert(concurrent_array_init(&shared) == 1);
+    atomic_store(&writers_done, 0);
+
+    pthread_t threads[WRITERS + 1];
+    for (int t = 0; t < WRITERS; t++) {
+        assert(pthread_create(&threads[t], NULL, writer, (void *)(size_t)t) == 0);
+    }
+    assert(pthread_create(&threads[WRITERS], NULL, reader, NULL) == 0);
+    for (int t = 0; t <= WRITERS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // Every value appears exactly once, and each writer's values stay in its order
+    assert(concurrent_array_size(&shared) == (size_t)WRITERS * PER_WRITER);
+    char *seen = calloc(WRITERS * PER_WRITER, 1);
+    int last[WRITERS];
+    for (int t = 0; t < WRITERS; t++) {
+        last[t] = -1;
+    }
+    assert(seen != NULL);
+    for (size_t i = 1; i <= (size_t)WRITERS * PER_WRITER; i++) {
+        int v = concurrent_array_get(&shared, i);
+        assert(v >= 0 && v < WRITERS * PER_WRITER && !seen[v]);
+        seen[v] = 1;
+        assert(v > last[v / PER_WRITER]);
+        last[v / PER_WRITER] = v;
+    }
+    free(seen);
+    concurrent_array_destroy(&shared);
+    printf("Concurrent tests passed.\n");
+}
+
+int main() {
+    test_first_find_from_threads(); // First, so no scan has picked the SIMD level yet
+    test_single_thread();
+    test_concurrent();
+
+    printf("\nAll concurrent array tests passed (if no assertions failed)!\n");
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h> // Needed for INT_MIN checks
+
+#include "deque.h" // Include the header for the ring-buffer deque
+
+// Helper: checks the deque holds exactly expected[0..n) front to back, both by index
+// and through the segments
+static void check_contents(Deque *dq, const int *expected, size_t n) {
+    assert(deque_size(dq) == n);
+    for (size_t i = 0; i < n; i++) {
+        assert(deque_get(dq, i + 1) == expected[i]);
+    }
+    DequeSegment segments[2];
+    size_t used = deque_segments(dq, segments);
+    size_t seen = 0;
+    for (size_t s = 0; s < used; s++) {
+        for (size_t i = 0; i < segments[s].count; i++) {
+            assert(segments[s].data[i] == expected[seen++]);
+        }
+    }
+    assert(seen == n);
+}
+
+void test_push_pop_both_ends() {
+    printf("Testing deque push/pop at both ends...\n");
+    Deque dq;
+    assert(deque_init(&dq, 3) == 1);
+    assert(dq.capacity == 4); // Rounded up to a power of two
+    assert(deque_is_empty(&dq) == 1);
+
+    assert(deque_push_back(&dq, 2) == 1);  // 2
+    assert(deque_push_back(&dq, 3) == 1);  // 2 3
+    assert(deque_push_front(&dq, 1) == 1); // 1 2 3 (front wraps to the last slot)
+    assert(deque_push_front(&dq, 0) == 1); // 0 1 2 3
+    int expected[] = { 0, 1, 2, 3 };
+    check_contents(&dq, expected, 4);
+    assert(deque_peek_front(&dq) == 0);
+    assert(deque_peek_back(&dq) == 3);
+
+    assert(deque_push_back(&dq, 4) == 1); // Full and wrapped: grows and unwraps
+    assert(dq.capacity == DEQUE_DEFAULT_CAPACITY);
+    int grown[] = { 0, 1, 2, 3, 4 };
+    check_contents(&dq, grown, 5);
+
+    assert(deque_pop_front(&dq) == 0);
+    assert(deque_pop_back(&dq) == 4);
+    assert(deque_pop_back(&dq) == 3);
+    assert(deque_pop_front(&dq) == 1);
+    assert(deque_pop_front(&dq) == 2);
+    assert(deque_is_empty(&dq) == 1);
+    assert(deque_pop_front(&dq) == INT_MIN); // Underflow
+    assert(deque_pop_back(&dq) == INT_MIN);
+    assert(deque_peek_front(&dq) == INT_MIN);
+    assert(deque_get(&dq, 1) == INT_MIN);
+
+    deque_destroy(&dq);
+    assert(dq.data == NULL && dq.capacity == 0);
+    printf("Push/pop tests passed.\n");
+}
+
+void test_queue_usage() {
+    printf("Testing deque as a FIFO queue with wrap-around and growth...\n");
+    Deque dq;
+    assert(deque_init(&dq, 0) == 1);
+    int next_in = 0, next_out = 0;
+
+    // Uneven enqueue/dequeue pattern keeps the front moving around the buffer
+    for (int round = 0; round < 2000; round++) {
+        int pushes = round % 7 + 1;
+        for (int i = 0; i < pushes; i++) {
+            assert(deque_push_back(&dq, next_in++) == 1);
+        }
+        int pops = round % 5 + 1;
+        for (int i = 0; i < pops && !deque_is_empty(&dq); i++) {
+            assert(deque_pop_front(&dq) == next_out++);
+        }
+        assert(deque_size(&dq) == (size_t)(next_in - next_out));
+        assert((dq.capacity & (dq.capacity - 1)) == 0);
+    }
+    while (!deque_is_empty(&dq)) {
+        assert(deque_pop_front(&dq) == next_out++);
+    }
+    assert(next_in == next_out);
+
+    // Reusable after destroy
+    deque_destroy(&dq);
+    assert(deque_push_front(&dq, 9) == 1);
+    assert(deque_peek_back(&dq) == 9);
+    deque_clear(&dq);
+    assert(deque_is_empty(&dq) == 1);
+    deque_destroy(&dq);
+    printf("Queue usage tests passed.\n");
+}
+
+void test_bulk_and_segments() {
+    printf("Testing deque bulk operations and segments...\n");
+    Deque dq;
+    assert(deque_init(&dq, 8) == 1);
+    DequeSegment segments[2];
+    assert(deque_segments(&dq, segments) == 0);
+
+    // Move the front near the end of the buffer, then bulk-enqueue across it
+    int values[20];
+    for (int i = 0; i < 20; i++) {
+        values[i] = i * 10;
+    }
+    assert(deque_push_back_n(&dq, values, 6) == 1);
+    int out[32];
+    assert(deque_pop_front_n(&dq, out, 5) == 5); // Front is slot 5
+    assert(out[0] == 0 && out[4] == 40);
+    assert(deque_push_back_n(&dq, values + 6, 4) == 1); // 50 | 60 70 wrap | 80 90
+    int expected[] = { 50, 60, 70, 80, 90 };
+    check_contents(&dq, expected, 5);
+    assert(deque_segments(&dq, segments) == 2);
+    assert(segments[0].count == 3 && segments[1].count == 2);
+    assert(segments[1].data == dq.data);
+
+    // Bulk dequeue across the wrap point
+    assert(deque_pop_front_n(&dq, out, 4) == 4);
+    assert(out[0] == 50 && out[2] == 70 && out[3] == 80);
+    assert(deque_segments(&dq, segments) == 1);
+
+    // A batch bigger than the free space grows once and stays in order
+    assert(deque_push_back_n(&dq, values, 20) == 1);
+    assert(deque_size(&dq) == 21);
+    assert(deque_get(&dq, 1) == 90);
+    assert(deque_get(&dq, 21) == 190);
+    assert(deque_push_back_n(&dq, values, 0) == 1);
+    assert(deque_pop_front_n(&dq, out, 100) == 21); // Only 21 available
+    assert(out[20] == 190);
+    assert(deque_pop_front_n(&dq, out, 1) == 0);
+
+    assert(deque_reserve(&dq, 1000) == 1);
+    assert(dq.capacity == 1024);
+    deque_destroy(&dq);
+    printf("Bulk and segment tests passed.\n");
+}
+
+int main() {
+    test_push_pop_both_ends();
+    test_queue_usage();
+    test_bulk_and_segments();
+
+    printf("\nAll deque tests passed (if no assertions failed)!\n");
+    return 0;
+}
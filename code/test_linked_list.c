@@ -2,8 +2,10 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <stdbool.h> // For bool return types
+#include <string.h> // For strcmp in the formatting tests
 
 #include "linked_list.h" // Include the header for your linked list
+#include <unistd.h> // For lseek on the serialization temp file
 
 // Helper function to check node data at a specific index (0-based)
 // Returns -1 if index is out of bounds, otherwise returns data.
@@ -194,11 +196,544 @@ void test_reverse() {
     list_destroy(&head);
 }
 
+void test_pooled_list() {
+    printf("Testing pooled list operations...\n");
+    struct NodePool pool;
+    assert(list_pool_init(&pool, 4) == 1); // Small chunks so several get allocated
+
+    struct Node *head = NULL;
+    list_init(&head);
+    for (int i = 0; i < 10; i++) {
+        list_pool_append(&pool, &head, i); // 0 -> 1 -> ... -> 9
+    }
+    list_pool_prepend(&pool, &head, -1);            // -1 -> 0 -> ... -> 9
+    assert(list_pool_insert_at(&pool, &head, 100, 5) == true);
+    assert(list_length(head) == 12);
+    assert(pool.live == 12);
+    assert(get_data_at(head, 0) == -1);
+    assert(get_data_at(head, 5) == 100);
+    assert(get_data_at(head, 11) == 9);
+
+    // Nodes of one pool-backed list are packed into the same chunks
+    struct Node *first_appended = head->next;   // Holds 0
+    struct Node *second_appended = first_appended->next; // Holds 1
+    assert((char *)second_appended - (char *)first_appended == (ptrdiff_t)pool.node_size);
+
+    assert(list_pool_delete_first(&pool, &head) == true);
+    assert(list_pool_delete_last(&pool, &head) == true);
+    assert(list_pool_delete_at(&pool, &head, 4) == true); // Removes the 100
+    assert(list_pool_delete_at(&pool, &head, 50) == false);
+    assert(list_length(head) == 9);
+    assert(pool.live == 9);
+    assert(list_find(head, 100) == NULL);
+
+    // Freed nodes are recycled before any new memory is carved out
+    char *bump_before = pool.bump;
+    list_pool_prepend(&pool, &head, 42);
+    assert(pool.bump == bump_before);
+    assert(get_data_at(head, 0) == 42);
+
+    // The read-only functions work unchanged on pooled lists
+    list_reverse(&head);
+    assert(get_data_at(head, 0) == 8);
+    assert(list_set_at(head, 0, 80) == true);
+    assert(list_find(head, 80) != NULL);
+
+    list_pool_destroy(&pool, &head);
+    assert(head == NULL);
+    assert(pool.live == 0);
+
+    // Dropping a whole list in O(chunks)
+    for (int i = 0; i < 100; i++) {
+        list_pool_prepend(&pool, &head, i);
+    }
+    node_pool_reset(&pool);
+    list_init(&head);
+    assert(pool.live == 0);
+    list_pool_append(&pool, &head, 7); // Reuses a kept chunk
+    assert(list_length(head) == 1);
+
+    node_pool_destroy(&pool);
+    list_init(&head);
+    printf("Pooled list tests passed.\n");
+}
+
+void test_linked_list_handle() {
+    printf("Testing LinkedList handle API...\n");
+    struct LinkedList list;
+    linked_list_init(&list);
+    assert(linked_list_is_empty(&list));
+    assert(linked_list_delete_first(&list) == false);
+    assert(linked_list_delete_last(&list) == false);
+
+    // Large append loop stays linear thanks to the cached tail
+    for (int i = 0; i < 100000; i++) {
+        assert(linked_list_append(&list, i) == true);
+    }
+    assert(linked_list_length(&list) == 100000);
+    assert(list.tail->data == 99999);
+    linked_list_destroy(&list);
+    assert(list.head == NULL && list.tail == NULL && list.length == 0);
+
+    linked_list_append(&list, 20);           // 20
+    linked_list_prepend(&list, 10);          // 10 -> 20
+    assert(linked_list_insert_at(&list, 30, 2) == true); // Append via insert: 10 -> 20 -> 30
+    assert(list.tail->data == 30);
+    assert(linked_list_insert_at(&list, 15, 1) == true); // 10 -> 15 -> 20 -> 30
+    assert(linked_list_insert_at(&list, 99, 9) == false);
+    assert(linked_list_length(&list) == 4);
+    assert(get_data_at(list.head, 1) == 15);
+
+    assert(linked_list_set_at(&list, 3, 33) == true); // Tail fast path
+    assert(list.tail->data == 33);
+    assert(linked_list_find(&list, 33) == list.tail);
+    assert(linked_list_set_at(&list, 4, 0) == false);
+
+    assert(linked_list_delete_last(&list) == true); // 10 -> 15 -> 20
+    assert(list.tail->data == 20);
+    assert(list.tail->next == NULL);
+    assert(linked_list_delete_at(&list, 1) == true); // 10 -> 20
+    assert(list.tail->data == 20);
+    assert(linked_list_delete_at(&list, 5) == false);
+
+    linked_list_reverse(&list); // 20 -> 10
+    assert(list.head->data == 20);
+    assert(list.tail->data == 10);
+    linked_list_append(&list, 5); // Tail stays correct after reverse: 20 -> 10 -> 5
+    assert(get_data_at(list.head, 2) == 5);
+    assert(linked_list_length(&list) == 3);
+    assert(list_length(list.head) == 3); // Cached length matches a real walk
+
+    assert(linked_list_delete_first(&list) == true);
+    assert(linked_list_delete_first(&list) == true);
+    assert(linked_list_delete_first(&list) == true);
+    assert(list.head == NULL && list.tail == NULL);
+    assert(linked_list_is_empty(&list));
+    linked_list_destroy(&list);
+
+    // Pooled handle
+    struct NodePool pool;
+    assert(list_pool_init(&pool, 0) == 1);
+    linked_list_init_pooled(&list, &pool);
+    for (int i = 0; i < 10; i++) {
+        linked_list_append(&list, i);
+    }
+    assert(pool.live == 10);
+    linked_list_print(&list);
+    linked_list_destroy(&list);
+    assert(pool.live == 0);
+    node_pool_destroy(&pool);
+
+    printf("LinkedList handle tests passed.\n");
+}
+
+void test_serialization() {
+    printf("Testing list serialization...\n");
+    enum SerialEncoding encodings[] = { SERIAL_RAW, SERIAL_VARINT, SERIAL_DELTA_VARINT };
+    size_t capacity = serial_max_size(5000);
+    unsigned char *buffer = malloc(capacity);
+    assert(buffer != NULL);
+
+    // Round trip through a memory buffer; 5000 values span several blocks
+    struct Node *head = NULL;
+    for (int i = 0; i < 5000; i++) {
+        list_append(&head, (i % 7 == 0) ? -i * 1000 : i); // Mix of small and large magnitudes
+    }
+    list_append(&head, 2147483647);
+    list_append(&head, -2147483647 - 1); // Deltas between extremes wrap around
+    size_t sizes[3];
+    for (int e = 0; e < 3; e++) {
+        struct SerialStream out;
+        serial_stream_buffer(&out, buffer, capacity);
+        assert(list_serialize(head, &out, encodings[e]) == true);
+        sizes[e] = out.pos;
+
+        struct SerialStream in;
+        serial_stream_buffer(&in, buffer, out.pos);
+        struct Node *copy = NULL;
+        list_append(&copy, 42); // Deserialize appends after existing nodes
+        assert(list_deserialize(&copy, &in) == true);
+        assert(in.pos == out.pos);
+        assert(list_length(copy) == 5003);
+        assert(get_data_at(copy, 0) == 42);
+        struct Node *a = head, *b = copy->next;
+        while (a != NULL) {
+            assert(a->data == b->data);
+            a = a->next;
+            b = b->next;
+        }
+        list_destroy(&copy);
+    }
+    assert(sizes[1] < sizes[0]); // Varint beats 4 bytes per value on mostly small data
+    list_destroy(&head);
+
+    // Sorted data: delta coding needs about one byte per value
+    for (int i = 0; i < 3000; i++) {
+        list_append(&head, 1000000 + i * 3);
+    }
+    struct SerialStream out;
+    serial_stream_buffer(&out, buffer, capacity);
+    assert(list_serialize(head, &out, SERIAL_DELTA_VARINT) == true);
+    assert(out.pos < 3000 + 64);
+    list_destroy(&head);
+
+    // Truncated or corrupt data is rejected and leaves the target list unchanged
+    struct Node *target = NULL;
+    list_append(&target, 7);
+    for (size_t cut = 0; cut < out.pos; cut += out.pos / 7 + 1) {
+        struct SerialStream in;
+        serial_stream_buffer(&in, buffer, cut);
+        assert(list_deserialize(&target, &in) == false);
+        assert(list_length(target) == 1);
+    }
+    buffer[10] ^= 0xFF; // Block count
+    struct SerialStream in;
+    serial_stream_buffer(&in, buffer, out.pos);
+    assert(list_deserialize(&target, &in) == false);
+    assert(list_length(target) == 1);
+    list_destroy(&target);
+
+    // Writing into a buffer that is too small fails instead of overflowing
+    serial_stream_buffer(&out, buffer, 16);
+    list_append(&head, 1);
+    assert(list_serialize(head, &out, SERIAL_RAW) == false); // Needs 8 + 12 + 8 bytes
+    assert(out.error == 1 && out.pos <= 16);
+    list_destroy(&head);
+    free(buffer);
+
+    // Two lists back to back through a file descriptor, into pooled handles
+    FILE *file = tmpfile();
+    assert(file != NULL);
+    int fd = fileno(file);
+    struct LinkedList first, second;
+    linked_list_init(&first);
+    linked_list_init(&second);
+    for (int i = 0; i < 2500; i++) {
+        linked_list_append(&first, i * i);
+    }
+    linked_list_append(&second, -1);
+    struct SerialStream stream;
+    serial_stream_fd(&stream, fd);
+    assert(linked_list_serialize(&first, &stream, SERIAL_VARINT) == true);
+    assert(linked_list_serialize(&second, &stream, SERIAL_DELTA_VARINT) == true);
+    assert(lseek(fd, 0, SEEK_SET) == 0);
+
+    struct NodePool pool;
+    assert(list_pool_init(&pool, 0) == 1);
+    struct LinkedList a, b;
+    linked_list_init_pooled(&a, &pool);
+    linked_list_init_pooled(&b, &pool);
+    serial_stream_fd(&stream, fd);
+    assert(linked_list_deserialize(&a, &stream) == true);
+    assert(linked_list_deserialize(&b, &stream) == true);
+    assert(linked_list_length(&a) == 2500 && a.tail->data == 2499 * 2499);
+    assert(linked_list_length(&b) == 1 && b.head->data == -1);
+    assert(pool.live == 2501);
+    assert(linked_list_deserialize(&b, &stream) == false); // Nothing left: truncated
+    assert(linked_list_serialize(&b, &stream, SERIAL_RAW) == false); // Errors are sticky
+    linked_list_destroy(&a);
+    linked_list_destroy(&b);
+    node_pool_destroy(&pool);
+    linked_list_destroy(&first);
+    linked_list_destroy(&second);
+    fclose(file);
+    printf("List serialization tests passed.\n");
+}
+
+void test_formatting() {
+    printf("Testing list_format and list_fprint...\n");
+    char text[128];
+    struct Node *head = NULL;
+    assert(list_format(head, text, sizeof(text), NULL) == strlen("List: NULL\n"));
+    assert(strcmp(text, "List: NULL\n") == 0); // Same text list_print always gave
+
+    for (int i = 1; i <= 5; i++) {
+        list_append(&head, i * -11);
+    }
+    list_format(head, text, sizeof(text), NULL);
+    assert(strcmp(text, "List: -11 -> -22 -> -33 -> -44 -> -55 -> NULL\n") == 0);
+
+    struct FormatOptions options;
+    format_options_default(&options);
+    options.separator = " ";
+    list_format(head, text, sizeof(text), &options);
+    assert(strcmp(text, "-11 -22 -33 -44 -55") == 0);
+    options.start = 1;
+    options.limit = 3;
+    options.truncated = " ...";
+    assert(list_format(head, text, sizeof(text), &options) == strlen("-22 -33 -44 ..."));
+    assert(strcmp(text, "-22 -33 -44 ...") == 0);
+
+    // Default layout with a limit keeps the list_print look
+    options = (struct FormatOptions){ "List: ", " -> ", 1, "... -> ", "NULL", 0, 2 };
+    list_format(head, text, sizeof(text), &options);
+    assert(strcmp(text, "List: -11 -> -22 -> ... -> NULL") == 0);
+
+    char small[4];
+    assert(list_format(head, small, sizeof(small), NULL) == strlen("List: -11 -> -22 -> -33 -> -44 -> -55 -> NULL\n"));
+    assert(strcmp(small, "Lis") == 0);
+
+    FILE *file = tmpfile();
+    assert(file != NULL);
+    assert(list_fprint(head, file, &options) == true);
+    rewind(file);
+    char read_back[128] = { 0 };
+    assert(fread(read_back, 1, sizeof(read_back) - 1, file) == strlen(text));
+    assert(strcmp(read_back, text) == 0);
+    fclose(file);
+    list_destroy(&head);
+    printf("List formatting tests passed.\n");
+}
+
+// Helper: true if the chain is in ascending order and has 'expected' nodes
+static bool is_sorted_chain(struct Node *head, int expected) {
+    int count = 0;
+    for (struct Node *n = head; n != NULL; n = n->next) {
+        if (n->next != NULL && n->next->data < n->data) {
+            return false;
+        }
+        count++;
+    }
+    return count == expected;
+}
+
+void test_sort_and_relink() {
+    printf("Testing list sort, merge, split, concat and splice...\n");
+    struct Node *head;
+    list_init(&head);
+    list_sort(&head); // Empty list is fine
+    assert(head == NULL);
+
+    // Random values with many duplicates; nodes are relinked, never reallocated
+    struct NodePool pool;
+    assert(list_pool_init(&pool, 0) == 1);
+    srand(4242);
+    for (int i = 0; i < 10007; i++) {
+        list_pool_append(&pool, &head, rand() % 500);
+    }
+    size_t live = pool.live;
+    list_sort(&head);
+    assert(is_sorted_chain(head, 10007));
+    assert(pool.live == live);
+    list_pool_destroy(&pool, &head);
+
+    // Stable: equal values keep their original node order
+    int values[] = { 7, 3, 9, 7, 1, 3 };
+    for (int i = 0; i < 6; i++) {
+        list_append(&head, values[i]);
+    }
+    struct Node *first_seven = head;
+    struct Node *second_seven = head->next->next->next;
+    list_sort(&head); // 1 -> 3 -> 3 -> 7 -> 7 -> 9
+    assert(get_data_at(head, 0) == 1 && get_data_at(head, 5) == 9);
+    assert(head->next->next->next == first_seven && first_seven->next == second_seven);
+
+    // Merge two sorted lists; 'src' ends up empty
+    struct Node *other;
+    list_init(&other);
+    list_append(&other, 0);
+    list_append(&other, 7);
+    list_append(&other, 10);
+    list_merge(&head, &other); // 0 -> 1 -> 3 -> 3 -> 7 -> 7 -> 7 -> 9 -> 10
+    assert(other == NULL);
+    assert(is_sorted_chain(head, 9));
+    assert(get_data_at(head, 0) == 0 && get_data_at(head, 8) == 10);
+    assert(head->next->next->next->next == first_seven); // Ties: dest's nodes first
+
+    // Split, then put the pieces back in another order
+    assert(list_split_at(&head, 10, &other) == false);
+    assert(list_split_at(&head, 4, &other) == true); // 0 1 3 3 | 7 7 7 9 10
+    assert(list_length(head) == 4 && list_length(other) == 5);
+    assert(other == first_seven);
+    list_concat(&other, &head); // 7 7 7 9 10 0 1 3 3
+    assert(head == NULL && list_length(other) == 9);
+    assert(get_data_at(other, 5) == 0);
+    assert(list_split_at(&other, 9, &head) == true && head == NULL); // Split at the end
+
+    list_append(&head, 100);
+    list_append(&head, 200);
+    assert(list_splice_at(&other, 10, &head) == false);
+    assert(list_splice_at(&other, 5, &head) == true); // 7 7 7 9 10 100 200 0 1 3 3
+    assert(head == NULL && list_length(other) == 11);
+    assert(get_data_at(other, 4) == 10 && get_data_at(other, 5) == 100 && get_data_at(other, 7) == 0);
+    list_append(&head, -5);
+    assert(list_splice_at(&other, 0, &head) == true); // Splice at the front
+    assert(get_data_at(other, 0) == -5 && list_length(other) == 12);
+    list_destroy(&other);
+
+    // Handle versions keep tail and length in sync
+    struct LinkedList a, b;
+    linked_list_init(&a);
+    linked_list_init(&b);
+    for (int i = 20; i > 0; i--) {
+        linked_list_append(&a, i % 7);
+    }
+    linked_list_sort(&a);
+    assert(is_sorted_chain(a.head, 20) && a.tail->data == 6 && a.tail->next == NULL);
+    for (int i = 0; i < 5; i++) {
+        linked_list_append(&b, 2 * i + 1); // 1 3 5 7 9
+    }
+    assert(linked_list_merge(&a, &b) == true);
+    assert(linked_list_is_empty(&b) && b.tail == NULL);
+    assert(linked_list_length(&a) == 25 && is_sorted_chain(a.head, 25) && a.tail->data == 9);
+
+    assert(linked_list_split_at(&a, 26, &b) == false);
+    assert(linked_list_split_at(&a, 10, &b) == true);
+    assert(linked_list_length(&a) == 10 && a.tail->next == NULL);
+    assert(linked_list_length(&b) == 15 && b.tail->data == 9);
+    assert(linked_list_split_at(&a, 5, &b) == false); // 'rest' must be empty
+    assert(linked_list_concat(&b, &a) == true); // b's 15 then a's 10
+    assert(linked_list_is_empty(&a) && linked_list_length(&b) == 25);
+    assert(b.tail->data == get_data_at(b.head, 24));
+    assert(linked_list_split_at(&b, 0, &a) == true); // Everything moves
+    assert(linked_list_is_empty(&b) && linked_list_length(&a) == 25);
+    assert(linked_list_append(&b, 42) == true);
+    assert(linked_list_splice_at(&a, 25, &b) == true); // At the end: O(1) through the tail
+    assert(a.tail->data == 42 && linked_list_length(&a) == 26);
+    assert(linked_list_append(&b, 43) == true);
+    assert(linked_list_splice_at(&a, 3, &b) == true);
+    assert(get_data_at(a.head, 3) == 43 && linked_list_length(&a) == 27 && a.tail->data == 42);
+
+    // Lists with different allocators cannot trade nodes
+    struct NodePool other_pool;
+    struct LinkedList pooled;
+    assert(list_pool_init(&other_pool, 0) == 1);
+    linked_list_init_pooled(&pooled, &other_pool);
+    linked_list_append(&pooled, 1);
+    assert(linked_list_concat(&a, &pooled) == false); // Prints an error
+    assert(linked_list_merge(&a, &pooled) == false);
+    assert(linked_list_length(&pooled) == 1 && linked_list_length(&a) == 27);
+
+    linked_list_destroy(&pooled);
+    node_pool_destroy(&other_pool);
+    node_pool_destroy(&pool);
+    linked_list_destroy(&a);
+    linked_list_destroy(&b);
+    printf("Sort and relink tests passed.\n");
+}
+
+// Callbacks for the one-pass helpers
+static int negate(int value, void *ctx) {
+    (void)ctx;
+    return -value;
+}
+
+static bool is_even(int value, void *ctx) {
+    (void)ctx;
+    return value % 2 == 0;
+}
+
+static long long add_value(long long acc, int value, void *ctx) {
+    (void)ctx;
+    return acc + value;
+}
+
+void test_cursors() {
+    printf("Testing list cursors and map/filter/fold...\n");
+    struct Node *head;
+    list_init(&head);
+    struct ListCursor cursor;
+    list_cursor_init(&cursor, &head);
+    assert(list_cursor_valid(&cursor) == false);
+    assert(list_cursor_get(&cursor) == INT_MIN);
+    assert(list_cursor_set(&cursor, 1) == false);
+    assert(list_cursor_erase(&cursor) == false);
+    for (int i = 0; i < 6; i++) {
+        assert(list_cursor_insert_after(&cursor, i) == true); // Builds 0 -> 1 -> ... -> 5
+    }
+    assert(list_length(head) == 6 && get_data_at(head, 5) == 5);
+
+    // One pass: square, erase multiples of 3, insert after 4
+    list_cursor_init(&cursor, &head);
+    while (list_cursor_valid(&cursor)) {
+        int value = list_cursor_get(&cursor);
+        if (value % 3 == 0) {
+            int position = cursor.position;
+            assert(list_cursor_erase(&cursor) == true);
+            assert(cursor.position == position);
+            continue;
+        }
+        assert(list_cursor_set(&cursor, value * value) == true);
+        if (value == 4) {
+            assert(list_cursor_insert_after(&cursor, -4) == true);
+            list_cursor_next(&cursor);
+        }
+        list_cursor_next(&cursor);
+    }
+    // 1 -> 4 -> 16 -> -4 -> 25
+    assert(list_length(head) == 5);
+    assert(get_data_at(head, 0) == 1 && get_data_at(head, 2) == 16);
+    assert(get_data_at(head, 3) == -4 && get_data_at(head, 4) == 25);
+    assert(list_cursor_next(&cursor) == false); // Stays past the end
+
+    // map / filter / fold on a bare chain
+    list_map(head, negate, NULL); // -1 -4 -16 4 -25
+    assert(list_fold(head, 0, add_value, NULL) == -42);
+    assert(list_filter(&head, is_even, NULL) == 2); // -4 -16 4
+    assert(list_length(head) == 3 && get_data_at(head, 0) == -4 && get_data_at(head, 2) == 4);
+    list_destroy(&head);
+
+    // Handle cursor keeps tail and length right through erases and inserts at the end
+    struct LinkedList list;
+    linked_list_init(&list);
+    for (int i = 0; i < 10; i++) {
+        linked_list_append(&list, i);
+    }
+    linked_list_cursor_init(&cursor, &list);
+    while (list_cursor_valid(&cursor)) {
+        if (list_cursor_get(&cursor) >= 8) {
+            list_cursor_erase(&cursor); // Takes out the tail node(s)
+        } else {
+            list_cursor_next(&cursor);
+        }
+    }
+    assert(linked_list_length(&list) == 8 && list.tail->data == 7);
+    assert(list_cursor_insert_after(&cursor, 42) == true); // Past the end: new tail
+    assert(list.tail->data == 42 && list.tail->next == NULL && linked_list_length(&list) == 9);
+    linked_list_cursor_init(&cursor, &list);
+    assert(list_cursor_erase(&cursor) == true); // Head
+    assert(list.head->data == 1 && linked_list_length(&list) == 8);
+    for (int i = 0; i < 7; i++) {
+        list_cursor_next(&cursor);
+    }
+    assert(list_cursor_get(&cursor) == 42);
+    assert(list_cursor_insert_after(&cursor, 43) == true); // After the tail
+    assert(list.tail->data == 43);
+    assert(linked_list_filter(&list, is_even, NULL) == 5); // 2 4 6 42
+    assert(linked_list_length(&list) == 4 && list.tail->data == 42 && list.tail->next == NULL);
+    assert(linked_list_filter(&list, is_even, NULL) == 0);
+    linked_list_destroy(&list);
+
+    // Pooled cursor returns erased nodes to the pool
+    struct NodePool pool;
+    assert(list_pool_init(&pool, 0) == 1);
+    list_init(&head);
+    list_pool_cursor_init(&cursor, &pool, &head);
+    for (int i = 0; i < 4; i++) {
+        list_cursor_insert_after(&cursor, i);
+    }
+    assert(pool.live == 4);
+    list_pool_cursor_init(&cursor, &pool, &head);
+    list_cursor_erase(&cursor);
+    assert(pool.live == 3);
+    assert(list_pool_filter(&pool, &head, is_even, NULL) == 2); // Drops 1 and 3
+    assert(pool.live == 1 && head->data == 2);
+    list_pool_destroy(&pool, &head);
+    node_pool_destroy(&pool);
+    printf("Cursor tests passed.\n");
+}
+
 int main() {
     test_insertion();
     test_deletion();
     test_find_set_length();
     test_reverse();
+    test_pooled_list();
+    test_linked_list_handle();
+    test_serialization();
+    test_formatting();
+    test_sort_and_relink();
+    test_cursors();
 
     printf("\nAll linked list tests passed (if no assertions failed)!\n");
     return 0;
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+
+#include "lockfree_stack.h" // Include the header for the lock-free stack
+
+#define THREADS 4
+#define PER_THREAD 100000
+
+void test_single_thread() {
+    printf("Testing lock-free stack push/pop on one thread...\n");
+    struct LockFreeStack stack;
+    lockfree_stack_init(&stack);
+    int value = 12345;
+
+    assert(lockfree_stack_is_empty(&stack) == 1);
+    assert(lockfree_stack_pop(&stack, &value) == false);
+    assert(value == 12345); // Untouched on failure
+
+    assert(lockfree_stack_push(&stack, 10) == true);
+    assert(lockfree_stack_push(&stack, 20) == true);
+    assert(lockfree_stack_push(&stack, 30) == true);
+    assert(lockfree_stack_is_empty(&stack) == 0);
+    assert(lockfree_stack_pop(&stack, &value) == true && value == 30);
+    assert(lockfree_stack_pop(&stack, &value) == true && value == 20);
+
+    // Popped nodes are recycled instead of freed
+    assert(lockfree_stack_push(&stack, 40) == true);
+    assert(lockfree_stack_push(&stack, 50) == true);
+    assert(atomic_load(&stack.allocated) == 3);
+    assert(lockfree_stack_pop(&stack, &value) == true && value == 50);
+    assert(lockfree_stack_pop(&stack, &value) == true && value == 40);
+    assert(lockfree_stack_pop(&stack, &value) == true && value == 10);
+    assert(lockfree_stack_is_empty(&stack) == 1);
+
+    lockfree_stack_destroy(&stack);
+    printf("Single-thread tests passed.\n");
+}
+
+struct WorkerArgs {
+    struct LockFreeStack *stack;
+    int id;
+    int *popped;      // Values this thread popped
+    int popped_count;
+};
+
+// Pushes its own range of values, popping one for every two pushes
+static void *worker(void *arg) {
+    struct WorkerArgs *args = arg;
+    int base = args->id * PER_THREAD;
+    for (int i = 0; i < PER_THREAD; i++) {
+        assert(lockfree_stack_push(args->stack, base + i) == true);
+        int value;
+        if (i % 2 == 1 && lockfree_stack_pop(args->stack, &value)) {
+            args->popped[args->popped_count++] = value;
+        }
+    }
+    return NULL;
+}
+
+void test_concurrent() {
+    printf("Testing lock-free stack with %d threads...\n", THREADS);
+    struct LockFreeStack stack;
+    lockfree_stack_init(&stack);
+
+    pthread_t threads[THREADS];
+    struct WorkerArgs args[THREADS];
+    for (int t = 0; t < THREADS; t++) {
+        args[t].stack = &stack;
+        args[t].id = t;
+        args[t].popped = malloc(PER_THREAD * sizeof(int));
+        args[t].popped_count = 0;
+        assert(args[t].popped != NULL);
+        assert(pthread_create(&threads[t], NULL, worker, &args[t]) == 0);
+    }
+    for (int t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // Every pushed value must come out exactly once: popped by a worker or drained here
+    char *seen = calloc(THREADS * PER_THREAD, 1);
+    assert(seen != NULL);
+    for (int t = 0; t < THREADS; t++) {
+        for (int i = 0; i < args[t].popped_count; i++) {
+            int v = args[t].popped[i];
+            assert(v >= 0 && v < THREADS * PER_THREAD && !seen[v]);
+            seen[v] = 1;
+        }
+        free(args[t].popped);
+    }
+    int v;
+    while (lockfree_stack_pop(&stack, &v)) {
+        assert(v >= 0 && v < THREADS * PER_THREAD && !seen[v]);
+        seen[v] = 1;
+    }
+    for (int i = 0; i < THREADS * PER_THREAD; i++) {
+        assert(seen[i] == 1);
+    }
+    free(seen);
+
+    lockfree_stack_destroy(&stack);
+    printf("Concurrent tests passed.\n");
+}
+
+int main() {
+    test_single_thread();
+    test_concurrent();
+
+    printf("\nAll lock-free stack tests passed (if no assertions failed)!\n");
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h> // For memmove on the reference array
+#include <stdbool.h>
+
+#include "skip_list.h" // Include the header for the skip list
+
+// Helper: every level must be sorted and every width must match the level-0 distance
+static void check_structure(struct SkipList *list) {
+    int length = 0;
+    for (struct SkipNode *n = list->head[0].next; n != NULL; n = n->links[0].next) {
+        length++;
+    }
+    assert(length == list->length);
+    for (int lvl = 0; lvl < list->level; lvl++) {
+        struct SkipLink *links = list->head;
+        int rank = 0; // 1-based rank of the node owning 'links' (0 = head)
+        for (;;) {
+            struct SkipNode *next = links[lvl].next;
+            int target = rank + links[lvl].width;
+            if (next == NULL) {
+                assert(target == list->length + 1); // Spans to the end
+                break;
+            }
+            assert(skip_list_get_at(list, target - 1) == next->data);
+            assert(lvl < next->level);
+            rank = target;
+            links = next->links;
+        }
+    }
+}
+
+// Helper: index of the first element >= value in a sorted array
+static int reference_rank(const int *ref, int count, int value) {
+    int i = 0;
+    while (i < count && ref[i] < value) {
+        i++;
+    }
+    return i;
+}
+
+void test_basic_operations() {
+    printf("Testing skip list insert, find and positions...\n");
+    struct SkipList list;
+    skip_list_init(&list);
+    assert(skip_list_is_empty(&list));
+    assert(skip_list_find(&list, 1) == NULL);
+    assert(skip_list_get_at(&list, 0) == INT_MIN);
+    assert(skip_list_delete(&list, 1) == false);
+    assert(skip_list_delete_at(&list, 0) == false);
+    assert(skip_list_rank(&list, 5) == 0);
+
+    int values[] = { 50, 20, 80, 20, 10, 90, 60 };
+    for (int i = 0; i < 7; i++) {
+        assert(skip_list_insert(&list, values[i]) == true);
+    }
+    // 10 20 20 50 60 80 90
+    assert(skip_list_length(&list) == 7);
+    assert(skip_list_get_at(&list, 0) == 10);
+    assert(skip_list_get_at(&list, 3) == 50);
+    assert(skip_list_get_at(&list, 6) == 90);
+    assert(skip_list_get_at(&list, 7) == INT_MIN);
+    assert(skip_list_rank(&list, 20) == 1);
+    assert(skip_list_rank(&list, 21) == 3);
+    assert(skip_list_rank(&list, 100) == 7);
+    assert(skip_list_find(&list, 60) != NULL && skip_list_find(&list, 60)->data == 60);
+    assert(skip_list_find(&list, 61) == NULL);
+    assert(skip_list_lower_bound(&list, 55)->data == 60);
+    assert(skip_list_next(skip_list_lower_bound(&list, 55))->data == 80);
+    assert(skip_list_lower_bound(&list, 91) == NULL);
+
+    // Equal values keep insertion order: the first 20 found is the first one inserted
+    struct SkipNode *first_twenty = skip_list_find(&list, 20);
+    assert(skip_list_insert(&list, 20) == true);
+    assert(skip_list_find(&list, 20) == first_twenty);
+
+    int out[8];
+    assert(skip_list_range(&list, 15, 60, out, 8) == 5);
+    assert(out[0] == 20 && out[2] == 20 && out[3] == 50 && out[4] == 60);
+    assert(skip_list_range(&list, 15, 60, out, 2) == 2); // Capped by max_count
+    assert(skip_list_range(&list, 61, 79, out, 8) == 0);
+    assert(skip_list_count_range(&list, 15, 60) == 5);
+    assert(skip_list_count_range(&list, INT_MIN, INT_MAX) == 8);
+    assert(skip_list_count_range(&list, 60, 15) == 0);
+
+    assert(skip_list_delete(&list, 20) == true); // 10 20 20 50 60 80 90
+    assert(skip_list_count_range(&list, 20, 20) == 2);
+    assert(skip_list_delete_at(&list, 0) == true); // 20 20 50 60 80 90
+    assert(skip_list_delete_at(&list, 5) == true); // 20 20 50 60 80
+    assert(skip_list_delete_at(&list, 5) == false);
+    assert(skip_list_get_at(&list, 0) == 20 && skip_list_get_at(&list, 4) == 80);
+    check_structure(&list);
+
+    printf("Expected: SkipList: 20 -> 20 -> 50 -> 60 -> 80 -> NULL\nActual:   ");
+    fflush(stdout);
+    skip_list_print(&list);
+
+    skip_list_destroy(&list);
+    assert(skip_list_is_empty(&list) && list.head[0].next == NULL);
+    assert(skip_list_insert(&list, 7) == true); // Still usable after destroy
+    assert(skip_list_get_at(&list, 0) == 7);
+    skip_list_destroy(&list);
+    printf("Basic skip list tests passed.\n");
+}
+
+void test_against_reference() {
+    printf("Testing skip list against a sorted array...\n");
+    enum { MAX_ELEMENTS = 20000 };
+    int *ref = malloc(MAX_ELEMENTS * sizeof(int));
+    assert(ref != NULL);
+    int count = 0;
+    struct SkipList list;
+    skip_list_init(&list);
+    srand(777);
+
+    for (int step = 0; step < 60000; step++) {
+        int op = rand() % 10;
+        int value = rand() % 5000;
+        if (op < 6 && count < MAX_ELEMENTS) {
+            int pos = reference_rank(ref, count, value + 1); // After equal values
+            memmove(ref + pos + 1, ref + pos, (size_t)(count - pos) * sizeof(int));
+            ref[pos] = value;
+            count++;
+            assert(skip_list_insert(&list, value) == true);
+        } else if (op < 8) {
+            int pos = reference_rank(ref, count, value);
+            bool present = pos < count && ref[pos] == value;
+            if (present) {
+                memmove(ref + pos, ref + pos + 1, (size_t)(count - pos - 1) * sizeof(int));
+                count--;
+            }
+            assert(skip_list_delete(&list, value) == present);
+        } else if (count > 0) {
+            int pos = rand() % count;
+            memmove(ref + pos, ref + pos + 1, (size_t)(count - pos - 1) * sizeof(int));
+            count--;
+            assert(skip_list_delete_at(&list, pos) == true);
+        }
+
+        if (step % 1000 == 0) {
+            assert(skip_list_length(&list) == count);
+            for (int i = 0; i < count; i += 37) {
+                assert(skip_list_get_at(&list, i) == ref[i]);
+            }
+            int probe = rand() % 5000;
+            assert(skip_list_rank(&list, probe) == reference_rank(ref, count, probe));
+            assert(skip_list_count_range(&list, probe, probe + 100) ==
+                   reference_rank(ref, count, probe + 101) - reference_rank(ref, count, probe));
+            check_structure(&list);
+        }
+    }
+
+    // Nodes of every height came from the pools and went back on delete
+    size_t live = 0;
+    for (int lvl = 0; lvl < SKIP_LIST_MAX_LEVEL; lvl++) {
+        live += list.pools[lvl].live;
+    }
+    assert(live == (size_t)count);
+
+    skip_list_destroy(&list);
+    free(ref);
+    printf("Reference skip list tests passed.\n");
+}
+
+void test_large_list() {
+    printf("Testing skip list with 1,000,000 elements...\n");
+    struct SkipList list;
+    skip_list_init(&list);
+    for (int i = 0; i < 1000000; i++) {
+        assert(skip_list_insert(&list, (int)((unsigned long long)i * 2654435761ull % 1000000ull)) == true);
+    }
+    // The multiplier is odd and coprime to 10^6, so every value 0..999999 appears once
+    for (int i = 0; i < 1000000; i += 9973) {
+        assert(skip_list_get_at(&list, i) == i);
+        assert(skip_list_rank(&list, i) == i);
+    }
+    assert(list.level > 5 && list.level <= SKIP_LIST_MAX_LEVEL);
+    skip_list_destroy(&list);
+    printf("Large skip list tests passed.\n");
+}
+
+int main() {
+    test_basic_operations();
+    test_against_reference();
+    test_large_list();
+
+    printf("\nAll skip list tests passed (if no assertions failed)!\n");
+    return 0;
+}
@@ -88,12 +88,175 @@ void test_empty_stack_operations() {
     printf("Empty stack operations tests passed.\n");
 }
 
+void test_array_stack() {
+    printf("Testing array-backed stack...\n");
+    struct Stack stack;
+    struct Stack *stack_p = &stack;
+    assert(stack_init_array(stack_p, 2) == 1); // Tiny buffer so pushes have to grow it
+    assert(stack_p->kind == STACK_ARRAY);
+    assert(stack_is_empty(stack_p) == 1);
+    assert(stack_peek(stack_p) == INT_MIN);
+    assert(stack_pop(stack_p) == INT_MIN);
+
+    for (int i = 0; i < 1000; i++) {
+        stack_push(stack_p, i);
+        assert(stack_peek(stack_p) == i);
+    }
+    assert(stack_size(stack_p) == 1000);
+    assert(stack_p->capacity >= 1000);
+    for (int i = 999; i >= 0; i--) {
+        assert(stack_pop(stack_p) == i);
+    }
+    assert(stack_is_empty(stack_p) == 1);
+
+    assert(stack_reserve(stack_p, 5000) == 1);
+    assert(stack_p->capacity >= 5000);
+
+    stack_destroy(stack_p);
+    assert(stack_p->items == NULL);
+    assert(stack_is_empty(stack_p) == 1);
+    stack_push(stack_p, 7); // Still usable after destroy
+    assert(stack_pop(stack_p) == 7);
+    stack_destroy(stack_p);
+    printf("Array-backed stack tests passed.\n");
+}
+
+void test_bulk_operations() {
+    printf("Testing stack_push_n and stack_pop_n...\n");
+    for (int kind = 0; kind < 2; kind++) {
+        struct Stack stack;
+        struct Stack *stack_p = &stack;
+        if (kind == 0) {
+            stack_init(stack_p);
+        } else {
+            assert(stack_init_array(stack_p, 0) == 1);
+        }
+
+        int values[] = { 1, 2, 3, 4, 5 };
+        stack_push(stack_p, 0);
+        assert(stack_push_n(stack_p, values, 5) == 1); // 0 1 2 3 4 5 (5 on top)
+        assert(stack_push_n(stack_p, values, 0) == 1);
+        assert(stack_size(stack_p) == 6);
+        assert(stack_peek(stack_p) == 5);
+        assert(stack_reserve(stack_p, 100) == 1);      // No-op for linked stacks
+
+        int out[10];
+        assert(stack_pop_n(stack_p, out, 3) == 3);     // Pop order: 5 4 3
+        assert(out[0] == 5 && out[1] == 4 && out[2] == 3);
+        assert(stack_size(stack_p) == 3);
+        assert(stack_peek(stack_p) == 2);
+
+        assert(stack_pop_n(stack_p, out, 10) == 3);    // Only 3 left: 2 1 0
+        assert(out[0] == 2 && out[1] == 1 && out[2] == 0);
+        assert(stack_is_empty(stack_p) == 1);
+        assert(stack_pop_n(stack_p, out, 1) == 0);
+
+        stack_destroy(stack_p);
+    }
+    printf("Bulk operation tests passed.\n");
+}
+
+void test_serialization() {
+    printf("Testing stack serialization...\n");
+    size_t capacity = serial_max_size(3000);
+    unsigned char *buffer = malloc(capacity);
+    assert(buffer != NULL);
+
+    // Every writer kind into every reader kind, onto a non-empty stack
+    for (int from = 0; from < 2; from++) {
+        for (int to = 0; to < 2; to++) {
+            struct Stack source, target;
+            if (from == 0) stack_init(&source); else assert(stack_init_array(&source, 0) == 1);
+            if (to == 0) stack_init(&target); else assert(stack_init_array(&target, 4) == 1);
+            for (int i = 0; i < 3000; i++) {
+                stack_push(&source, i - 1500);
+            }
+            stack_push(&target, 99999);
+
+            struct SerialStream out;
+            serial_stream_buffer(&out, buffer, capacity);
+            assert(stack_serialize(&source, &out, from ? SERIAL_DELTA_VARINT : SERIAL_VARINT) == 1);
+            assert(stack_size(&source) == 3000); // Not consumed
+
+            struct SerialStream in;
+            serial_stream_buffer(&in, buffer, out.pos);
+            assert(stack_deserialize(&target, &in) == 1);
+            assert(stack_size(&target) == 3001);
+            for (int i = 2999; i >= 0; i--) {
+                assert(stack_pop(&target) == i - 1500); // Same pop order as the source
+            }
+            assert(stack_pop(&target) == 99999);
+
+            // A truncated stream leaves the target untouched
+            stack_push(&target, 5);
+            serial_stream_buffer(&in, buffer, out.pos - 1);
+            assert(stack_deserialize(&target, &in) == 0);
+            assert(stack_size(&target) == 1 && stack_peek(&target) == 5);
+
+            stack_destroy(&source);
+            stack_destroy(&target);
+        }
+    }
+
+    // Empty stacks round-trip; a list stream is refused
+    struct Stack empty;
+    stack_init(&empty);
+    struct SerialStream out;
+    serial_stream_buffer(&out, buffer, capacity);
+    assert(stack_serialize(&empty, &out, SERIAL_RAW) == 1);
+    struct SerialStream in;
+    serial_stream_buffer(&in, buffer, out.pos);
+    assert(stack_deserialize(&empty, &in) == 1);
+    assert(stack_is_empty(&empty) == 1);
+    buffer[5] = SERIAL_KIND_LIST;
+    serial_stream_buffer(&in, buffer, out.pos);
+    assert(stack_deserialize(&empty, &in) == 0);
+    stack_destroy(&empty);
+    free(buffer);
+    printf("Stack serialization tests passed.\n");
+}
+
+void test_iteration() {
+    printf("Testing stack iterators...\n");
+    for (int kind = 0; kind < 2; kind++) {
+        struct Stack stack;
+        if (kind == 0) stack_init(&stack); else assert(stack_init_array(&stack, 0) == 1);
+        struct StackIterator it;
+        stack_iter_init(&it, &stack);
+        assert(stack_iter_valid(&it) == 0); // Empty
+        assert(stack_iter_get(&it) == INT_MIN);
+        assert(stack_iter_set(&it, 1) == 0);
+
+        for (int i = 1; i <= 5; i++) {
+            stack_push(&stack, i); // 5 on top
+        }
+        int expected = 5;
+        for (stack_iter_init(&it, &stack); stack_iter_valid(&it); stack_iter_next(&it)) {
+            assert(stack_iter_get(&it) == expected);
+            assert(stack_iter_set(&it, expected * 10) == 1); // Top-down, in one pass
+            expected--;
+        }
+        assert(expected == 0);
+        assert(stack_iter_next(&it) == 0); // Stays past the bottom
+        assert(stack_size(&stack) == 5);   // Nothing popped
+        for (int i = 5; i >= 1; i--) {
+            assert(stack_pop(&stack) == i * 10);
+        }
+        stack_destroy(&stack);
+    }
+    printf("Stack iterator tests passed.\n");
+}
+
 
 int main() {
     test_push_peek();       // Combined push and peek tests for clarity
     test_pop();
     test_is_empty();
     test_empty_stack_operations(); // Added specific tests for empty stack
+    test_array_stack();
+    test_bulk_operations();
+    test_serialization();
+    test_iteration();
 
     printf("\nAll stack tests passed (if no assertions failed)!\n");
     return 0;
@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h> // For strstr on the dump output
+
+#include "stats.h"       // Instrumentation (this test is built with -DDS_STATS)
+#include "array.h"       // Array container
+#include "linked_list.h" // Linked list container
+#include "stack.h"       // Stack container
+
+void test_array_counters() {
+    printf("Testing array reallocation and move counters...\n");
+    stats_reset();
+    Array arr;
+    assert(array_init(&arr));
+    for (int i = 0; i < 1000; i++) {
+        array_append(&arr, i);
+    }
+    // Default doubling from 10 to 1000+ takes exactly 7 reallocations
+    assert(stats_counter(STATS_ARRAY_REALLOCS) == 7);
+
+    uint64_t moved = stats_counter(STATS_ARRAY_BYTES_MOVED);
+    array_delete_at(&arr, 1); // Shifts the other 999 elements
+    assert(stats_counter(STATS_ARRAY_BYTES_MOVED) == moved + 999 * sizeof(int));
+
+    StatsHistogramData append;
+    stats_histogram(STATS_HIST_ARRAY_APPEND_NS, &append);
+    assert(append.count == 1000);
+
+    assert(array_find(&arr, 500) == 500);
+    assert(array_find(&arr, -1) == -1);
+    StatsHistogramData find;
+    stats_histogram(STATS_HIST_ARRAY_FIND_NS, &find);
+    assert(find.count == 2);
+
+    array_destroy(&arr);
+    printf("Array counter tests passed.\n");
+}
+
+void test_list_counters() {
+    printf("Testing list node and traversal counters...\n");
+    stats_reset();
+    struct Node *head;
+    list_init(&head);
+    for (int i = 0; i < 100; i++) {
+        list_append(&head, i);
+    }
+    assert(stats_counter(STATS_LIST_NODES_ALLOCATED) == 100);
+
+    assert(list_find(head, 0) != NULL);   // Walks 1 node
+    assert(list_find(head, 99) != NULL);  // Walks 100 nodes
+    assert(list_find(head, 500) == NULL); // Walks all 100 nodes, finds nothing
+    assert(stats_counter(STATS_LIST_NODES_VISITED) == 201);
+
+    StatsHistogramData length;
+    stats_histogram(STATS_HIST_LIST_FIND_LENGTH, &length);
+    assert(length.count == 3);
+    assert(length.sum == 201);
+    assert(length.max == 100);
+    assert(length.buckets[1] == 1); // The walk of 1
+    assert(length.buckets[7] == 2); // Both walks of 100 fall in [64, 127]
+    assert(stats_histogram_percentile(&length, 50) == 100); // Capped at the real max
+
+    list_destroy(&head);
+    assert(stats_counter(STATS_LIST_NODES_FREED) == 100);
+
+    // Pooled nodes are counted too, plus the chunk behind them
+    struct NodePool pool;
+    assert(list_pool_init(&pool, 16));
+    list_init(&head);
+    for (int i = 0; i < 20; i++) {
+        list_pool_prepend(&pool, &head, i);
+    }
+    assert(stats_counter(STATS_LIST_NODES_ALLOCATED) == 120);
+    assert(stats_counter(STATS_POOL_CHUNKS_ALLOCATED) == 2);
+    list_pool_destroy(&pool, &head);
+    node_pool_destroy(&pool);
+    printf("List counter tests passed.\n");
+}
+
+void test_stack_counters() {
+    printf("Testing stack node and growth counters...\n");
+    stats_reset();
+    struct Stack stack;
+    stack_init(&stack);
+    for (int i = 0; i < 10; i++) {
+        stack_push(&stack, i);
+    }
+    int values[5] = { 1, 2, 3, 4, 5 };
+    assert(stack_push_n(&stack, values, 5));
+    assert(stats_counter(STATS_STACK_NODES_ALLOCATED) == 15);
+    assert(stack_pop(&stack) == 5);
+    int out[4];
+    assert(stack_pop_n(&stack, out, 4) == 4);
+    stack_destroy(&stack); // Frees the remaining 10
+    assert(stats_counter(STATS_STACK_NODES_FREED) == 15);
+
+    assert(stack_init_array(&stack, 4));
+    for (int i = 0; i < 64; i++) {
+        stack_push(&stack, i);
+    }
+    assert(stats_counter(STATS_STACK_REALLOCS) == 4); // 4 -> 8 -> 16 -> 32 -> 64
+    stack_pop(&stack);
+
+    StatsHistogramData push;
+    StatsHistogramData pop;
+    stats_histogram(STATS_HIST_STACK_PUSH_NS, &push);
+    stats_histogram(STATS_HIST_STACK_POP_NS, &pop);
+    assert(push.count == 74); // push_n is not timed per element
+    assert(pop.count == 2);
+    stack_destroy(&stack);
+    printf("Stack counter tests passed.\n");
+}
+
+void test_dump() {
+    printf("Testing stats_dump and stats_reset...\n");
+    assert(stats_enabled());
+    stats_reset();
+    stats_add(STATS_ARRAY_REALLOCS, 3);
+    stats_record(STATS_HIST_ARRAY_FIND_NS, 0);
+    stats_record(STATS_HIST_ARRAY_FIND_NS, 1000);
+
+    char buffer[4096];
+    FILE *mem = fmemopen(buffer, sizeof(buffer), "w");
+    assert(mem != NULL);
+    stats_dump(mem, STATS_FORMAT_JSON);
+    fclose(mem);
+    assert(strstr(buffer, "\"array_reallocs\": 3") != NULL);
+    assert(strstr(buffer, "\"array_find_ns\": {\"count\": 2, \"sum\": 1000, \"max\": 1000") != NULL);
+    assert(strstr(buffer, "[0, 1], [512, 1]") != NULL); // 1000 is in [512, 1023]
+    assert(strstr(buffer, "stack_pop_ns") == NULL);     // Empty histograms are left out
+
+    mem = fmemopen(buffer, sizeof(buffer), "w");
+    assert(mem != NULL);
+    stats_dump(mem, STATS_FORMAT_TEXT);
+    fclose(mem);
+    assert(strstr(buffer, "array_reallocs") != NULL);
+    assert(strstr(buffer, "array_find_ns: count=2") != NULL);
+
+    stats_reset();
+    assert(stats_counter(STATS_ARRAY_REALLOCS) == 0);
+    StatsHistogramData find;
+    stats_histogram(STATS_HIST_ARRAY_FIND_NS, &find);
+    assert(find.count == 0 && find.max == 0);
+    printf("Dump tests passed.\n");
+}
+
+int main() {
+    test_array_counters();
+    test_list_counters();
+    test_stack_counters();
+    test_dump();
+    printf("\nAll stats tests passed!\n");
+    return 0;
+}
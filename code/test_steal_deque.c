@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h> // For sched_yield while a thief finds nothing (matters on a single core)
+#include <stdatomic.h>
+
+#include "steal_deque.h" // Include the header for the work-stealing deque
+
+#define THIEVES 3
+#define ITEMS 400000
+
+void test_single_thread() {
+    printf("Testing work-stealing deque on one thread...\n");
+    struct StealDeque q;
+    assert(steal_deque_init(&q, 4) == 1);
+    int value = -1;
+    assert(steal_deque_pop(&q, &value) == false);
+    assert(steal_deque_steal(&q, &value) == false);
+    assert(value == -1 && steal_deque_size(&q) == 0);
+
+    for (int i = 1; i <= 1000; i++) {
+        assert(steal_deque_push(&q, i) == true); // Grows 4 -> 8 -> ... -> 1024
+    }
+    assert(steal_deque_size(&q) == 1000);
+    assert(steal_deque_pop(&q, &value) == true && value == 1000);   // Owner: newest
+    assert(steal_deque_steal(&q, &value) == true && value == 1);    // Thief: oldest
+    assert(steal_deque_steal(&q, &value) == true && value == 2);
+    assert(steal_deque_pop(&q, &value) == true && value == 999);
+    assert(steal_deque_size(&q) == 996);
+
+    // Drain from both ends; they meet in the middle without losing or repeating anything
+    int expected_top = 3, expected_bottom = 998;
+    while (steal_deque_size(&q) > 0) {
+        if (steal_deque_size(&q) % 2 == 0) {
+            assert(steal_deque_steal(&q, &value) == true && value == expected_top++);
+        } else {
+            assert(steal_deque_pop(&q, &value) == true && value == expected_bottom--);
+        }
+    }
+    assert(expected_top == expected_bottom + 1);
+    assert(steal_deque_pop(&q, &value) == false);
+
+    // Wrap around the circular buffer many times without growing
+    for (int round = 0; round < 10000; round++) {
+        assert(steal_deque_push(&q, round) == true);
+        assert(steal_deque_push(&q, -round) == true);
+        assert(steal_deque_steal(&q, &value) == true && value == round);
+        assert(steal_deque_pop(&q, &value) == true && value == -round);
+    }
+    steal_deque_destroy(&q);
+
+    assert(steal_deque_init(&q, 0) == 1); // Default capacity
+    assert(steal_deque_push(&q, 42) == true);
+    assert(steal_deque_steal(&q, &value) == true && value == 42);
+    steal_deque_destroy(&q);
+    printf("Single-thread work-stealing deque tests passed.\n");
+}
+
+struct TheftArgs {
+    struct StealDeque *q;
+    atomic_int *taken; // Times each item was handed out
+    atomic_bool *done; // Set by the owner once it has pushed everything
+    long count;        // Items this thread took
+};
+
+static void *thief(void *arg) {
+    struct TheftArgs *a = arg;
+    int value;
+    for (;;) {
+        if (steal_deque_steal(a->q, &value)) {
+            atomic_fetch_add(&a->taken[value], 1);
+            a->count++;
+        } else if (atomic_load(a->done) && steal_deque_size(a->q) == 0) {
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+void test_owner_and_thieves() {
+    printf("Testing work-stealing deque with 1 owner and %d thieves...\n", THIEVES);
+    struct StealDeque q;
+    assert(steal_deque_init(&q, 2) == 1); // Tiny, so growth happens while thieves read
+    atomic_int *taken = calloc(ITEMS, sizeof(atomic_int));
+    assert(taken != NULL);
+    atomic_bool done;
+    atomic_init(&done, false);
+
+    pthread_t threads[THIEVES];
+    struct TheftArgs args[THIEVES];
+    for (int t = 0; t < THIEVES; t++) {
+        args[t] = (struct TheftArgs){ &q, taken, &done, 0 };
+        assert(pthread_create(&threads[t], NULL, thief, &args[t]) == 0);
+    }
+
+    // The owner pushes in bursts and pops some back itself, like a recursive task runner
+    long owner_count = 0;
+    int value;
+    for (int i = 0; i < ITEMS; i++) {
+        assert(steal_deque_push(&q, i) == true);
+        if (i % 3 == 0 && steal_deque_pop(&q, &value)) {
+            atomic_fetch_add(&taken[value], 1);
+            owner_count++;
+        }
+        if (i % 4096 == 0) {
+            sched_yield(); // Give the thieves a turn on a single core
+        }
+    }
+    while (steal_deque_pop(&q, &value)) {
+        atomic_fetch_add(&taken[value], 1);
+        owner_count++;
+    }
+    atomic_store(&done, true);
+
+    long total = owner_count;
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_join(threads[t], NULL);
+        total += args[t].count;
+    }
+    assert(total == ITEMS);
+    for (int i = 0; i < ITEMS; i++) {
+        assert(taken[i] == 1); // Every item exactly once
+    }
+    printf("Owner took %ld, thieves took %ld\n", owner_count, ITEMS - owner_count);
+
+    free(taken);
+    steal_deque_destroy(&q);
+    printf("Concurrent work-stealing deque tests passed.\n");
+}
+
+int main() {
+    test_single_thread();
+    test_owner_and_thieves();
+
+    printf("\nAll work-stealing deque tests passed (if no assertions failed)!\n");
+    return 0;
+}
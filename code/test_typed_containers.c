@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h> // For bool return types
+
+#include "typed_array.h" // DEFINE_ARRAY
+#include "typed_list.h"  // DEFINE_LIST
+#include "typed_stack.h" // DEFINE_STACK
+
+// A 24-byte record, stored inline by every generated container
+typedef struct Record {
+    long long id;
+    double score;
+    int flags;
+} Record;
+
+DEFINE_ARRAY(RecordArray, Record)
+DEFINE_LIST(RecordList, Record)
+DEFINE_STACK(RecordStack, Record)
+
+// Plain scalar instantiations must work too
+DEFINE_ARRAY(DoubleArray, double)
+DEFINE_STACK(CharStack, char)
+
+static Record make_record(long long id) {
+    Record r = { id, (double)id / 2, (int)(id % 3) };
+    return r;
+}
+
+// Records are equal when their ids are (padding makes memcmp unreliable)
+static int compare_ids(const Record *a, const Record *b) {
+    return (a->id > b->id) - (a->id < b->id);
+}
+
+static int compare_scores(const Record *a, const Record *b) {
+    return (a->score > b->score) - (a->score < b->score);
+}
+
+void test_typed_array() {
+    printf("Testing DEFINE_ARRAY with a struct element...\n");
+    RecordArray arr;
+    assert(RecordArray_init(&arr));
+    assert(RecordArray_is_empty(&arr));
+
+    for (long long i = 1; i <= 100; i++) {
+        assert(RecordArray_append(&arr, make_record(i)));
+    }
+    assert(RecordArray_size(&arr) == 100);
+    assert(RecordArray_capacity(&arr) >= 100);
+    assert(RecordArray_get(&arr, 1)->id == 1);
+    assert(RecordArray_get(&arr, 100)->score == 50.0);
+    assert(RecordArray_get(&arr, 0) == NULL);   // 1-based like array.h
+    assert(RecordArray_get(&arr, 101) == NULL);
+    assert((char *)RecordArray_get(&arr, 2) - (char *)RecordArray_get(&arr, 1) == sizeof(Record)); // Inline
+
+    Record key = make_record(42);
+    assert(RecordArray_find(&arr, &key, compare_ids) == 42);
+    key.id = 1000;
+    assert(RecordArray_find(&arr, &key, compare_ids) == -1);
+
+    // Bulk operations
+    Record batch[3] = { make_record(-1), make_record(-2), make_record(-3) };
+    assert(RecordArray_insert_range(&arr, 1, batch, 3));
+    assert(RecordArray_get(&arr, 1)->id == -1 && RecordArray_get(&arr, 4)->id == 1);
+    assert(RecordArray_delete_range(&arr, 1, 3));
+    assert(RecordArray_get(&arr, 1)->id == 1);
+    assert(RecordArray_delete_at(&arr, 100));
+    assert(RecordArray_size(&arr) == 99);
+    assert(!RecordArray_delete_at(&arr, 100));
+    assert(RecordArray_append_n(&arr, batch, 3));
+    assert(RecordArray_get(&arr, 102)->id == -3);
+    assert(RecordArray_set(&arr, 102, make_record(7)));
+    assert(RecordArray_get(&arr, 102)->id == 7);
+
+    // Sort by id; no compare function is refused and leaves the order alone
+    assert(RecordArray_sort(&arr, NULL) == 0);
+    assert(RecordArray_get(&arr, 102)->id == 7);
+    assert(RecordArray_sort(&arr, compare_ids));
+    for (size_t i = 2; i <= RecordArray_size(&arr); i++) {
+        assert(RecordArray_get(&arr, i - 1)->id <= RecordArray_get(&arr, i)->id);
+    }
+    assert(RecordArray_get(&arr, 1)->id == -2);
+    RecordArray_destroy(&arr);
+
+    assert(RecordArray_init(&arr));
+    for (long long i = 0; i < 50; i++) {
+        Record r = { i, (double)(i % 5), 0 };
+        assert(RecordArray_append(&arr, r));
+    }
+    assert(RecordArray_sort(&arr, compare_scores)); // Stable: equal scores keep id order
+    for (size_t i = 2; i <= 50; i++) {
+        Record *a = RecordArray_get(&arr, i - 1);
+        Record *b = RecordArray_get(&arr, i);
+        assert(a->score < b->score || (a->score == b->score && a->id < b->id));
+    }
+    assert(RecordArray_shrink_to_fit(&arr));
+    assert(RecordArray_capacity(&arr) == 50);
+    RecordArray_destroy(&arr);
+    assert(arr.data == NULL && RecordArray_size(&arr) == 0);
+
+    // Scalar element, NULL comparator compares bytes
+    DoubleArray doubles;
+    assert(DoubleArray_init(&doubles));
+    for (int i = 0; i < 20; i++) {
+        assert(DoubleArray_append(&doubles, i * 0.25));
+    }
+    double needle = 2.5;
+    assert(DoubleArray_find(&doubles, &needle, NULL) == 11);
+
+    // Bulk operations whose source is the array itself
+    assert(DoubleArray_shrink_to_fit(&doubles)); // Full, so the append must reallocate
+    assert(DoubleArray_append_n(&doubles, doubles.data, 20));
+    assert(DoubleArray_size(&doubles) == 40 && *DoubleArray_get(&doubles, 40) == 19 * 0.25);
+    assert(DoubleArray_delete_range(&doubles, 21, 20));
+    assert(DoubleArray_reserve(&doubles, 64)); // Spare room, so only the memmove shifts the source
+    assert(DoubleArray_insert_range(&doubles, 3, doubles.data + 1, 4)); // Straddles the gap
+    double expected[] = { 0, 0.25, 0.25, 0.5, 0.75, 1.0, 0.5, 0.75 };
+    for (size_t i = 0; i < 8; i++) {
+        assert(*DoubleArray_get(&doubles, i + 1) == expected[i]);
+    }
+    assert(DoubleArray_size(&doubles) == 24);
+    DoubleArray_destroy(&doubles);
+    printf("DEFINE_ARRAY tests passed.\n");
+}
+
+void test_typed_list() {
+    printf("Testing DEFINE_LIST with a struct element...\n");
+    struct RecordList list;
+    RecordList_init(&list);
+    assert(RecordList_is_empty(&list));
+    assert(!RecordList_delete_first(&list));
+    assert(!RecordList_delete_last(&list));
+
+    assert(RecordList_append(&list, make_record(2)));
+    assert(RecordList_prepend(&list, make_record(1)));
+    assert(RecordList_append(&list, make_record(4)));
+    assert(RecordList_insert_at(&list, make_record(3), 2));
+    assert(!RecordList_insert_at(&list, make_record(9), 9));
+    assert(RecordList_length(&list) == 4);
+    for (int i = 0; i < 4; i++) {
+        assert(RecordList_get_at(&list, i)->id == i + 1);
+    }
+    assert(list.tail->data.id == 4);
+    assert(RecordList_get_at(&list, 4) == NULL);
+
+    Record key = make_record(3);
+    struct RecordList_node *found = RecordList_find(&list, &key, compare_ids);
+    assert(found != NULL && found->data.score == 1.5);
+    key.id = 99;
+    assert(RecordList_find(&list, &key, compare_ids) == NULL);
+
+    assert(RecordList_set_at(&list, 0, make_record(10)));
+    assert(RecordList_get_at(&list, 0)->id == 10);
+
+    RecordList_reverse(&list); // 4 3 2 10
+    assert(RecordList_get_at(&list, 0)->id == 4);
+    assert(list.tail->data.id == 10);
+
+    assert(RecordList_delete_last(&list)); // 4 3 2
+    assert(list.tail->data.id == 2);
+    assert(RecordList_delete_at(&list, 1)); // 4 2
+    assert(RecordList_get_at(&list, 1)->id == 2);
+    assert(RecordList_delete_first(&list)); // 2
+    assert(list.head == list.tail && RecordList_length(&list) == 1);
+    RecordList_destroy(&list);
+    assert(list.head == NULL && list.tail == NULL && RecordList_is_empty(&list));
+
+    // Pooled: consecutive appends land next to each other
+    struct NodePool pool;
+    assert(RecordList_pool_init(&pool, 64));
+    RecordList_init_pooled(&list, &pool);
+    for (long long i = 0; i < 200; i++) {
+        assert(RecordList_append(&list, make_record(i)));
+    }
+    struct RecordList_node *a = list.head->next;
+    struct RecordList_node *b = a->next;
+    assert((char *)b - (char *)a == (ptrdiff_t)pool.node_size);
+    assert(pool.live == 200);
+    RecordList_destroy(&list);
+    assert(pool.live == 0);
+    node_pool_destroy(&pool);
+    printf("DEFINE_LIST tests passed.\n");
+}
+
+void test_typed_stack() {
+    printf("Testing DEFINE_STACK with a struct element...\n");
+    struct RecordStack stack;
+    assert(RecordStack_init(&stack, 2));
+    assert(RecordStack_is_empty(&stack));
+    assert(RecordStack_peek(&stack) == NULL);
+
+    for (long long i = 0; i < 10; i++) {
+        assert(RecordStack_push(&stack, make_record(i))); // Grows past the initial 2
+    }
+    assert(RecordStack_size(&stack) == 10);
+    assert(RecordStack_peek(&stack)->id == 9);
+
+    Record top;
+    assert(RecordStack_pop(&stack, &top));
+    assert(top.id == 9 && top.score == 4.5);
+
+    Record batch[3] = { make_record(100), make_record(101), make_record(102) };
+    assert(RecordStack_push_n(&stack, batch, 3));
+    assert(RecordStack_peek(&stack)->id == 102);
+
+    Record out[8];
+    assert(RecordStack_pop_n(&stack, out, 5) == 5); // Pop order: 102 101 100 8 7
+    assert(out[0].id == 102 && out[2].id == 100 && out[4].id == 7);
+    assert(RecordStack_pop_n(&stack, out, 8) == 7);
+    assert(RecordStack_is_empty(&stack));
+    assert(!RecordStack_pop(&stack, &top)); // Underflow
+    RecordStack_destroy(&stack);
+    assert(stack.items == NULL);
+
+    struct CharStack chars;
+    assert(CharStack_init(&chars, 0));
+    const char *text = "hello";
+    assert(CharStack_push_n(&chars, text, 5));
+    char c;
+    assert(CharStack_pop(&chars, &c) && c == 'o');
+    CharStack_destroy(&chars);
+    printf("DEFINE_STACK tests passed.\n");
+}
+
+int main() {
+    test_typed_array();
+    test_typed_list();
+    test_typed_stack();
+    printf("\nAll typed container tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h> // For bool return types
+#include <limits.h>  // For INT_MIN checks
+#include <string.h>  // For memmove in the model array
+
+#include "unrolled_list.h" // Include the header for the unrolled list
+
+// Helper: checks the list holds exactly expected[0..n) and its bookkeeping is consistent
+static void check_contents(struct UnrolledList *list, const int *expected, int n) {
+    assert(unrolled_list_length(list) == n);
+    int seen = 0;
+    struct UnrolledNode *last = NULL;
+    for (struct UnrolledNode *node = list->head; node != NULL; node = node->next) {
+        assert(node->count > 0 && node->count <= UNROLLED_NODE_CAPACITY); // No empty blocks
+        for (int i = 0; i < node->count; i++) {
+            assert(node->items[i] == expected[seen++]);
+        }
+        last = node;
+    }
+    assert(seen == n);
+    assert(list->tail == last);
+}
+
+void test_insertion() {
+    printf("Testing unrolled list insertion (prepend, append, insert_at)...\n");
+    struct UnrolledList list;
+    unrolled_list_init(&list);
+
+    unrolled_list_prepend(&list, 10);              // 10
+    unrolled_list_append(&list, 20);               // 10 -> 20
+    assert(unrolled_list_insert_at(&list, 15, 1) == true); // 10 -> 15 -> 20
+    int expected[] = { 10, 15, 20 };
+    check_contents(&list, expected, 3);
+
+    assert(unrolled_list_insert_at(&list, 99, 3) == true);  // Insert at end appends
+    assert(unrolled_list_get_at(&list, 3) == 99);
+    assert(unrolled_list_insert_at(&list, 100, 10) == false); // Out of bounds
+    assert(unrolled_list_length(&list) == 4);
+
+    // Fill well past one block so inserts split full blocks
+    unrolled_list_destroy(&list);
+    for (int i = 0; i < 100; i++) {
+        unrolled_list_append(&list, i);
+    }
+    assert(unrolled_list_insert_at(&list, -1, 5) == true);   // Split of the first block
+    assert(unrolled_list_insert_at(&list, -2, 100) == true); // Split of the last block
+    assert(unrolled_list_get_at(&list, 5) == -1);
+    assert(unrolled_list_get_at(&list, 6) == 5);
+    assert(unrolled_list_get_at(&list, 100) == -2);
+    assert(unrolled_list_get_at(&list, 101) == 99);
+    assert(unrolled_list_length(&list) == 102);
+
+    printf("Insertion tests passed.\n");
+    unrolled_list_destroy(&list);
+    assert(list.head == NULL && list.tail == NULL);
+}
+
+void test_deletion() {
+    printf("Testing unrolled list deletion...\n");
+    struct UnrolledList list;
+    unrolled_list_init(&list);
+    for (int i = 0; i < 5; i++) {
+        unrolled_list_append(&list, i * 10); // 0 10 20 30 40
+    }
+
+    assert(unrolled_list_delete_at(&list, 0) == true); // 10 20 30 40
+    assert(unrolled_list_delete_at(&list, 3) == true); // 10 20 30
+    assert(unrolled_list_delete_at(&list, 1) == true); // 10 30
+    int expected[] = { 10, 30 };
+    check_contents(&list, expected, 2);
+    assert(unrolled_list_delete_at(&list, 2) == false);
+
+    assert(unrolled_list_delete_at(&list, 0) == true);
+    assert(unrolled_list_delete_at(&list, 0) == true);
+    assert(list.head == NULL && list.tail == NULL); // Empty block was unlinked
+    assert(unrolled_list_delete_at(&list, 0) == false);
+
+    printf("Deletion tests passed.\n");
+    unrolled_list_destroy(&list);
+}
+
+void test_find_set_reverse() {
+    printf("Testing find, get_at, set_at, reverse...\n");
+    struct UnrolledList list;
+    unrolled_list_init(&list);
+    int expected[70];
+    for (int i = 0; i < 70; i++) {
+        unrolled_list_append(&list, i);
+        expected[i] = 69 - i;
+    }
+
+    assert(unrolled_list_find(&list, 0) == 0);
+    assert(unrolled_list_find(&list, 45) == 45); // Lives in the second block
+    assert(unrolled_list_find(&list, 1000) == -1);
+    assert(unrolled_list_set_at(&list, 45, 450) == true);
+    assert(unrolled_list_find(&list, 450) == 45);
+    assert(unrolled_list_set_at(&list, 45, 45) == true);
+    assert(unrolled_list_set_at(&list, 70, 1) == false);
+    assert(unrolled_list_get_at(&list, 70) == INT_MIN);
+
+    unrolled_list_reverse(&list);
+    check_contents(&list, expected, 70);
+    unrolled_list_append(&list, -5); // Tail is valid after reverse
+    assert(unrolled_list_get_at(&list, 70) == -5);
+    unrolled_list_print(&list);
+
+    printf("Find, set_at, reverse tests passed.\n");
+    unrolled_list_destroy(&list);
+}
+
+void test_random_against_array() {
+    printf("Testing random operations against a plain array...\n");
+    struct UnrolledList list;
+    unrolled_list_init(&list);
+    int model[2000];
+    int n = 0;
+    unsigned seed = 7;
+
+    for (int step = 0; step < 20000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = seed >> 8;
+        int op = (int)(r % 4);
+        if (n == 0 || (op < 2 && n < 2000)) {
+            int pos = (int)((r >> 4) % (unsigned)(n + 1));
+            if (op == 0 && pos == 0) {
+                assert(unrolled_list_prepend(&list, step) == true);
+            } else {
+                assert(unrolled_list_insert_at(&list, step, pos) == true);
+            }
+            memmove(model + pos + 1, model + pos, (size_t)(n - pos) * sizeof(int));
+            model[pos] = step;
+            n++;
+        } else {
+            int pos = (int)((r >> 4) % (unsigned)n);
+            assert(unrolled_list_delete_at(&list, pos) == true);
+            memmove(model + pos, model + pos + 1, (size_t)(n - pos - 1) * sizeof(int));
+            n--;
+        }
+    }
+    check_contents(&list, model, n);
+
+    printf("Random operation tests passed.\n");
+    unrolled_list_destroy(&list);
+}
+
+int main() {
+    test_insertion();
+    test_deletion();
+    test_find_set_reverse();
+    test_random_against_array();
+
+    printf("\nAll unrolled list tests passed (if no assertions failed)!\n");
+    return 0;
+}
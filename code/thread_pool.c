@@ -0,0 +1,150 @@
+#include "thread_pool.h" // Include the header file
+#include <stdio.h>       // For fprintf
+#include <stdlib.h>      // For malloc, free
+#include <unistd.h>      // For sysconf
+
+// Helper: claims and runs chunks of the current job until none are left
+static void run_chunks(struct ThreadPool *pool, ThreadPoolTask task, void *arg, size_t chunks) {
+    for (;;) {
+        size_t chunk = atomic_fetch_add_explicit(&pool->next_chunk, 1, memory_order_relaxed);
+        if (chunk >= chunks) {
+            return;
+        }
+        task(arg, chunk);
+    }
+}
+
+// Helper: worker loop. Sleeps until the generation changes, helps with that job, reports
+// back, and goes to sleep again.
+static void *worker_main(void *arg) {
+    struct ThreadPool *pool = arg;
+    unsigned long seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->stopping) {
+            pthread_cond_wait(&pool->job_ready, &pool->lock);
+        }
+        if (pool->stopping) {
+            break;
+        }
+        seen = pool->generation;
+        ThreadPoolTask task = pool->task;
+        void *task_arg = pool->arg;
+        size_t chunks = pool->chunks;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_chunks(pool, task, task_arg, chunks);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->running == 0) {
+            pthread_cond_signal(&pool->job_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+int thread_pool_init(struct ThreadPool *pool, size_t threads) {
+    if (pool == NULL) {
+        fprintf(stderr, "Error: Cannot initialize NULL thread pool pointer.\n");
+        return 0;
+    }
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (size_t)cpus : 1;
+    }
+    pool->workers = NULL;
+    pool->thread_count = 1;
+    pool->task = NULL;
+    pool->arg = NULL;
+    pool->chunks = 0;
+    atomic_init(&pool->next_chunk, 0);
+    pool->running = 0;
+    pool->generation = 0;
+    pool->stopping = false;
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        fprintf(stderr, "Error: Cannot create the thread pool lock.\n");
+        return 0;
+    }
+    if (pthread_cond_init(&pool->job_ready, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        fprintf(stderr, "Error: Cannot create the thread pool condition variables.\n");
+        return 0;
+    }
+    if (pthread_cond_init(&pool->job_done, NULL) != 0) {
+        pthread_cond_destroy(&pool->job_ready);
+        pthread_mutex_destroy(&pool->lock);
+        fprintf(stderr, "Error: Cannot create the thread pool condition variables.\n");
+        return 0;
+    }
+    if (threads == 1) {
+        return 1; // Inline pool, no workers to start
+    }
+
+    pool->workers = malloc((threads - 1) * sizeof(pthread_t));
+    if (pool->workers == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in thread_pool_init.\n");
+        thread_pool_destroy(pool);
+        return 0;
+    }
+    for (size_t i = 0; i < threads - 1; i++) {
+        if (pthread_create(&pool->workers[i], NULL, worker_main, pool) != 0) {
+            fprintf(stderr, "Error: Cannot start thread pool worker %zu.\n", i + 1);
+            thread_pool_destroy(pool); // Joins the ones already started
+            return 0;
+        }
+        pool->thread_count++;
+    }
+    return 1;
+}
+
+size_t thread_pool_size(struct ThreadPool *pool) {
+    return (pool == NULL) ? 1 : pool->thread_count;
+}
+
+void thread_pool_run(struct ThreadPool *pool, ThreadPoolTask task, void *arg, size_t chunks) {
+    if (task == NULL || chunks == 0) return; // Nothing to do
+    if (pool == NULL || pool->thread_count == 1 || chunks == 1) {
+        for (size_t chunk = 0; chunk < chunks; chunk++) {
+            task(arg, chunk); // Not worth waking anyone
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->arg = arg;
+    pool->chunks = chunks;
+    atomic_store_explicit(&pool->next_chunk, 0, memory_order_relaxed);
+    pool->running = pool->thread_count - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->job_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_chunks(pool, task, arg, chunks);
+
+    // Every worker checks in, even one that woke too late to find a chunk, so none of
+    // them can still be reading this job when the next one is posted
+    pthread_mutex_lock(&pool->lock);
+    while (pool->running > 0) {
+        pthread_cond_wait(&pool->job_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void thread_pool_destroy(struct ThreadPool *pool) {
+    if (pool == NULL) return; // Safety check
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->job_ready);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i + 1 < pool->thread_count; i++) {
+        pthread_join(pool->workers[i], NULL);
+    }
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->thread_count = 1;
+    pthread_cond_destroy(&pool->job_done);
+    pthread_cond_destroy(&pool->job_ready);
+    pthread_mutex_destroy(&pool->lock);
+}
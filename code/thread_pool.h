@@ -0,0 +1,58 @@
+#ifndef THREAD_POOL_H // Include guard start
+#define THREAD_POOL_H
+
+#include <pthread.h>   // For pthread_t, mutexes and condition variables
+#include <stdatomic.h> // For atomic_size_t
+#include <stdbool.h>   // For bool
+#include <stddef.h>    // For size_t
+
+// --- Structure Definitions ---
+
+// Fixed set of worker threads for data-parallel loops. A job is one function applied to
+// chunks 0 .. chunks-1; the threads (and the caller, who works too instead of sleeping)
+// claim chunks with an atomic counter until none are left, so a slow chunk never holds
+// up the others and there is no per-chunk queueing. thread_pool_run returns once every
+// chunk is done.
+//
+// The workers are started once by thread_pool_init and sleep on a condition variable
+// between jobs, so running a job costs one wake-up instead of creating threads.
+// One job runs at a time: call thread_pool_run from one thread, and never from inside a
+// task (it would wait for itself).
+
+// Runs chunk 'chunk' of a job; 'arg' is what was passed to thread_pool_run.
+typedef void (*ThreadPoolTask)(void *arg, size_t chunk);
+
+struct ThreadPool {
+    pthread_t *workers;          // thread_count - 1 threads; the caller is the last participant
+    size_t thread_count;
+    pthread_mutex_t lock;        // Guards everything below except next_chunk
+    pthread_cond_t job_ready;    // Workers wait here for a new generation
+    pthread_cond_t job_done;     // The caller waits here for 'running' to reach 0
+    ThreadPoolTask task;         // Current job
+    void *arg;
+    size_t chunks;
+    atomic_size_t next_chunk;    // Next chunk to claim
+    size_t running;              // Workers still busy with the current job
+    unsigned long generation;    // Bumped for every job so workers can tell a new one
+    bool stopping;               // Set by thread_pool_destroy
+};
+
+
+// --- Function Prototypes ---
+
+// Starts a pool that runs jobs on 'threads' threads including the caller (0 means one
+// per online CPU; 1 means no workers, jobs run inline). Returns 1 on success, 0 on
+// failure (nothing is left running).
+int thread_pool_init(struct ThreadPool *pool, size_t threads);
+
+// Number of threads a job runs on, including the caller. 1 for a NULL pool.
+size_t thread_pool_size(struct ThreadPool *pool);
+
+// Calls task(arg, chunk) once for every chunk in [0, chunks), spread over the pool, and
+// returns when all calls have finished. Chunks run in no particular order.
+void thread_pool_run(struct ThreadPool *pool, ThreadPoolTask task, void *arg, size_t chunks);
+
+// Stops and joins the workers. Does NOT free the ThreadPool struct itself.
+void thread_pool_destroy(struct ThreadPool *pool);
+
+#endif // THREAD_POOL_H // Include guard end
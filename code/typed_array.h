@@ -0,0 +1,253 @@
+#ifndef TYPED_ARRAY_H // Include guard start
+#define TYPED_ARRAY_H
+
+#include <stdio.h>  // For fprintf, printf
+#include <stdlib.h> // For malloc, realloc, free
+#include <string.h> // For memcpy, memmove, memcmp
+#include <stdint.h> // For SIZE_MAX, uintptr_t
+
+// --- Typed Dynamic Array Generator ---
+// DEFINE_ARRAY(name, T) emits a dynamic array that stores T values inline, with the same
+// API shape as array.h (1-based indices, 1/0 returns, "Index out of bounds" on bad indices):
+//
+//     typedef struct Point { double x, y, z; } Point;
+//     DEFINE_ARRAY(PointArray, Point)
+//
+//     PointArray points;
+//     PointArray_init(&points);
+//     PointArray_append(&points, (Point){ 1, 2, 3 });
+//     Point *p = PointArray_get(&points, 1);
+//
+// Everything is 'static inline', so use the macro once per element type in each .c file
+// (or in a shared header). Differences from array.h, since T is not an int:
+//   - _get returns a pointer to the element (NULL if out of bounds) instead of a sentinel
+//   - _append returns 1/0 instead of exiting on allocation failure
+//   - like array.h's bulk operations, _append_n / _insert_range accept 'values' that
+//     point into the array itself
+//   - _find / _sort take a comparison function; _find with NULL compares bytes (memcmp),
+//     which is only correct for types without padding; _sort rejects NULL
+
+#define TYPED_ARRAY_INITIAL_CAPACITY 8
+
+#define DEFINE_ARRAY(name, T)                                                                  \
+    typedef struct name {                                                                      \
+        T *data;                                                                               \
+        size_t capacity;                                                                       \
+        size_t count;                                                                          \
+    } name;                                                                                    \
+                                                                                               \
+    /* Returns <0, 0 or >0 like strcmp; only 0 matters for _find */                           \
+    typedef int (*name##_compare_fn)(const T *a, const T *b);                                 \
+                                                                                               \
+    static inline int name##_init(name *arr) {                                                 \
+        arr->data = malloc(TYPED_ARRAY_INITIAL_CAPACITY * sizeof(T));                          \
+        arr->count = 0;                                                                        \
+        if (arr->data == NULL) {                                                               \
+            fprintf(stderr, "Error: Memory allocation failed for " #name " data.\n");          \
+            arr->capacity = 0;                                                                 \
+            return 0;                                                                          \
+        }                                                                                      \
+        arr->capacity = TYPED_ARRAY_INITIAL_CAPACITY;                                          \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Helper: resizes the buffer to exactly 'new_capacity' elements */                        \
+    static inline int name##_set_capacity(name *arr, size_t new_capacity) {                    \
+        T *new_data = realloc(arr->data, new_capacity * sizeof(T));                            \
+        if (new_data == NULL) {                                                                \
+            fprintf(stderr, "Error: Memory allocation failed while resizing " #name ".\n");    \
+            return 0; /* Old buffer is still valid */                                          \
+        }                                                                                      \
+        arr->data = new_data;                                                                  \
+        arr->capacity = new_capacity;                                                          \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_reserve(name *arr, size_t min_capacity) {                         \
+        if (min_capacity <= arr->capacity) {                                                   \
+            return 1;                                                                          \
+        }                                                                                      \
+        if (min_capacity > SIZE_MAX / sizeof(T)) {                                             \
+            fprintf(stderr, "Error: Requested capacity exceeds " #name " limits.\n");          \
+            return 0;                                                                          \
+        }                                                                                      \
+        size_t next = arr->capacity > 0 ? arr->capacity : 1;                                   \
+        while (next < min_capacity) {                                                          \
+            next = (next > SIZE_MAX / sizeof(T) / 2) ? min_capacity : next * 2;                \
+        }                                                                                      \
+        return name##_set_capacity(arr, next);                                                 \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_shrink_to_fit(name *arr) {                                        \
+        size_t new_capacity = arr->count > 0 ? arr->count : 1; /* Keep data non-NULL */        \
+        return new_capacity == arr->capacity ? 1 : name##_set_capacity(arr, new_capacity);     \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_append(name *arr, T value) {                                      \
+        if (arr->count == arr->capacity && !name##_reserve(arr, arr->count + 1)) {             \
+            return 0;                                                                          \
+        }                                                                                      \
+        arr->data[arr->count++] = value;                                                       \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* 0-based slot 'values' points at inside the array's own elements, or SIZE_MAX */         \
+    static inline size_t name##_alias_offset(name *arr, const T *values) {                     \
+        uintptr_t p = (uintptr_t)values;                                                       \
+        uintptr_t lo = (uintptr_t)arr->data;                                                   \
+        if (arr->data == NULL || p < lo || p >= lo + arr->count * sizeof(T)) {                 \
+            return SIZE_MAX;                                                                   \
+        }                                                                                      \
+        return (size_t)(p - lo) / sizeof(T);                                                   \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_append_n(name *arr, const T *values, size_t n) {                  \
+        size_t alias = name##_alias_offset(arr, values);                                       \
+        if (n > SIZE_MAX / sizeof(T) - arr->count || !name##_reserve(arr, arr->count + n)) {   \
+            return 0;                                                                          \
+        }                                                                                      \
+        if (alias != SIZE_MAX) {                                                               \
+            values = arr->data + alias; /* _reserve may have moved the buffer */               \
+        }                                                                                      \
+        if (n > 0) {                                                                           \
+            memcpy(arr->data + arr->count, values, n * sizeof(T));                             \
+        }                                                                                      \
+        arr->count += n;                                                                       \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Inserts n values so the first lands at 1-based 'index' (count + 1 appends) */          \
+    static inline int name##_insert_range(name *arr, size_t index, const T *values, size_t n) { \
+        if (index < 1 || index > arr->count + 1) {                                             \
+            printf("Index out of bounds\n");                                                   \
+            return 0;                                                                          \
+        }                                                                                      \
+        if (n == 0) {                                                                          \
+            return 1;                                                                          \
+        }                                                                                      \
+        size_t alias = name##_alias_offset(arr, values);                                       \
+        if (n > SIZE_MAX / sizeof(T) - arr->count || !name##_reserve(arr, arr->count + n)) {   \
+            return 0;                                                                          \
+        }                                                                                      \
+        size_t start = index - 1;                                                              \
+        memmove(arr->data + start + n, arr->data + start, (arr->count - start) * sizeof(T));   \
+        if (alias == SIZE_MAX) {                                                               \
+            memcpy(arr->data + start, values, n * sizeof(T));                                  \
+        } else { /* From the array itself: the part before the gap stayed, the rest moved */   \
+            size_t before = (alias < start) ? ((start - alias < n) ? start - alias : n) : 0;   \
+            memcpy(arr->data + start, arr->data + alias, before * sizeof(T));                  \
+            memcpy(arr->data + start + before, arr->data + alias + before + n,                 \
+                   (n - before) * sizeof(T));                                                  \
+        }                                                                                      \
+        arr->count += n;                                                                       \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_delete_range(name *arr, size_t index, size_t n) {                 \
+        if (index < 1 || index > arr->count || n > arr->count - (index - 1)) {                 \
+            printf("Index out of bounds\n");                                                   \
+            return 0;                                                                          \
+        }                                                                                      \
+        size_t start = index - 1;                                                              \
+        memmove(arr->data + start, arr->data + start + n,                                      \
+                (arr->count - start - n) * sizeof(T));                                         \
+        arr->count -= n;                                                                       \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_delete_at(name *arr, size_t index) {                              \
+        return name##_delete_range(arr, index, 1);                                             \
+    }                                                                                          \
+                                                                                               \
+    /* Returns a pointer to the element at 1-based 'index', or NULL if out of bounds */        \
+    static inline T *name##_get(name *arr, size_t index) {                                     \
+        if (index < 1 || index > arr->count) {                                                 \
+            printf("Index out of bounds\n");                                                   \
+            return NULL;                                                                       \
+        }                                                                                      \
+        return &arr->data[index - 1];                                                          \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_set(name *arr, size_t index, T value) {                           \
+        T *slot = name##_get(arr, index);                                                      \
+        if (slot == NULL) {                                                                    \
+            return 0;                                                                          \
+        }                                                                                      \
+        *slot = value;                                                                         \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Returns the 1-based index of the first element equal to *value, or -1 */               \
+    static inline long long name##_find(name *arr, const T *value, name##_compare_fn compare) { \
+        for (size_t i = 0; i < arr->count; i++) {                                              \
+            int diff = compare != NULL ? compare(&arr->data[i], value)                         \
+                                       : memcmp(&arr->data[i], value, sizeof(T));              \
+            if (diff == 0) {                                                                   \
+                return (long long)i + 1;                                                       \
+            }                                                                                  \
+        }                                                                                      \
+        return -1;                                                                             \
+    }                                                                                          \
+                                                                                               \
+    /* Stable bottom-up merge sort through one scratch buffer. Returns 1, or 0 on alloc */     \
+    /* failure or a NULL compare (bytes do not order values, so there is no fallback) */       \
+    static inline int name##_sort(name *arr, name##_compare_fn compare) {                      \
+        if (compare == NULL) {                                                                 \
+            fprintf(stderr, "Error: " #name "_sort needs a compare function.\n");              \
+            return 0;                                                                          \
+        }                                                                                      \
+        size_t n = arr->count;                                                                 \
+        if (n < 2) {                                                                           \
+            return 1;                                                                          \
+        }                                                                                      \
+        T *scratch = malloc(n * sizeof(T));                                                    \
+        if (scratch == NULL) {                                                                 \
+            fprintf(stderr, "Error: Memory allocation failed in " #name "_sort.\n");           \
+            return 0;                                                                          \
+        }                                                                                      \
+        T *from = arr->data;                                                                   \
+        T *to = scratch;                                                                       \
+        for (size_t width = 1; width < n; width *= 2) {                                        \
+            for (size_t lo = 0; lo < n; lo += 2 * width) {                                     \
+                size_t mid = lo + width < n ? lo + width : n;                                  \
+                size_t hi = mid + width < n ? mid + width : n;                                 \
+                size_t i = lo, j = mid, k = lo;                                                \
+                while (i < mid && j < hi) {                                                    \
+                    to[k++] = compare(&from[j], &from[i]) < 0 ? from[j++] : from[i++];         \
+                }                                                                              \
+                while (i < mid) to[k++] = from[i++];                                           \
+                while (j < hi) to[k++] = from[j++];                                            \
+            }                                                                                  \
+            T *swap = from;                                                                    \
+            from = to;                                                                         \
+            to = swap;                                                                         \
+        }                                                                                      \
+        if (from != arr->data) {                                                               \
+            memcpy(arr->data, from, n * sizeof(T));                                            \
+        }                                                                                      \
+        free(scratch);                                                                         \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    static inline size_t name##_size(name *arr) {                                              \
+        return arr->count;                                                                     \
+    }                                                                                          \
+                                                                                               \
+    static inline size_t name##_capacity(name *arr) {                                          \
+        return arr->capacity;                                                                  \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_is_empty(name *arr) {                                             \
+        return arr->count == 0;                                                                \
+    }                                                                                          \
+                                                                                               \
+    /* Frees the buffer; does NOT free the struct itself */                                    \
+    static inline void name##_destroy(name *arr) {                                             \
+        free(arr->data);                                                                       \
+        arr->data = NULL;                                                                      \
+        arr->capacity = 0;                                                                     \
+        arr->count = 0;                                                                        \
+    }
+
+
+#endif // TYPED_ARRAY_H // Include guard end
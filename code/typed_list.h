@@ -0,0 +1,250 @@
+#ifndef TYPED_LIST_H // Include guard start
+#define TYPED_LIST_H
+
+#include <stdio.h>     // For fprintf
+#include <stdlib.h>    // For malloc, free
+#include <string.h>    // For memcmp
+#include <stdbool.h>   // For bool return types
+#include "node_pool.h" // Optional pooled node allocation
+
+// --- Typed Linked List Generator ---
+// DEFINE_LIST(name, T) emits a singly linked list whose nodes hold a T inline, shaped like
+// struct LinkedList in linked_list.h (head/tail/length handle, 0-based positions, bool
+// returns, optional NodePool):
+//
+//     DEFINE_LIST(PointList, Point)
+//
+//     struct PointList list;
+//     PointList_init(&list);
+//     PointList_append(&list, (Point){ 1, 2, 3 });
+//     Point *first = PointList_get_at(&list, 0);
+//
+// Nodes are struct PointList_node { T data; next }. For nodes that sit next to each other
+// in memory, back the list with a pool from PointList_pool_init (link node_pool.c).
+// _find takes a comparison function; NULL compares bytes (memcmp), which is only correct
+// for types without padding.
+
+#define DEFINE_LIST(name, T)                                                                   \
+    struct name##_node {                                                                       \
+        T data;                                                                                \
+        struct name##_node *next;                                                              \
+    };                                                                                         \
+                                                                                               \
+    struct name {                                                                              \
+        struct name##_node *head;                                                              \
+        struct name##_node *tail; /* Last node, NULL when empty */                             \
+        int length;                                                                            \
+        struct NodePool *pool;    /* Node allocator, NULL for malloc/free */                   \
+    };                                                                                         \
+                                                                                               \
+    typedef int (*name##_compare_fn)(const T *a, const T *b);                                 \
+                                                                                               \
+    /* Helper: allocates a node from the list's pool or with malloc */                         \
+    static inline struct name##_node *name##_node_alloc(struct name *list) {                   \
+        struct name##_node *node = list->pool != NULL                                          \
+                                       ? (struct name##_node *)node_pool_alloc(list->pool)     \
+                                       : (struct name##_node *)malloc(sizeof(struct name##_node)); \
+        if (node == NULL) {                                                                    \
+            fprintf(stderr, "Error: Memory allocation failed for " #name " node.\n");          \
+        }                                                                                      \
+        return node;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    /* Helper: gives a node back to the list's pool or to free */                              \
+    static inline void name##_node_release(struct name *list, struct name##_node *node) {      \
+        if (list->pool != NULL) {                                                              \
+            node_pool_free(list->pool, node);                                                  \
+        } else {                                                                               \
+            free(node);                                                                        \
+        }                                                                                      \
+    }                                                                                          \
+                                                                                               \
+    /* Initializes a pool whose nodes fit this list's node type */                             \
+    static inline int name##_pool_init(struct NodePool *pool, size_t nodes_per_chunk) {        \
+        return node_pool_init(pool, sizeof(struct name##_node), nodes_per_chunk);              \
+    }                                                                                          \
+                                                                                               \
+    static inline void name##_init(struct name *list) {                                        \
+        list->head = NULL;                                                                     \
+        list->tail = NULL;                                                                     \
+        list->length = 0;                                                                      \
+        list->pool = NULL;                                                                     \
+    }                                                                                          \
+                                                                                               \
+    static inline void name##_init_pooled(struct name *list, struct NodePool *pool) {          \
+        name##_init(list);                                                                     \
+        list->pool = pool;                                                                     \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_prepend(struct name *list, T value) {                            \
+        struct name##_node *node = name##_node_alloc(list);                                    \
+        if (node == NULL) {                                                                    \
+            return false;                                                                      \
+        }                                                                                      \
+        node->data = value;                                                                    \
+        node->next = list->head;                                                               \
+        list->head = node;                                                                     \
+        if (list->tail == NULL) {                                                              \
+            list->tail = node;                                                                 \
+        }                                                                                      \
+        list->length++;                                                                        \
+        return true;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_append(struct name *list, T value) {                             \
+        struct name##_node *node = name##_node_alloc(list);                                    \
+        if (node == NULL) {                                                                    \
+            return false;                                                                      \
+        }                                                                                      \
+        node->data = value;                                                                    \
+        node->next = NULL;                                                                     \
+        if (list->tail == NULL) {                                                              \
+            list->head = node;                                                                 \
+        } else {                                                                               \
+            list->tail->next = node;                                                           \
+        }                                                                                      \
+        list->tail = node;                                                                     \
+        list->length++;                                                                        \
+        return true;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    /* Helper: node at a 0-based position (must be < length) */                               \
+    static inline struct name##_node *name##_node_at(struct name *list, int position) {        \
+        if (position == list->length - 1) {                                                    \
+            return list->tail; /* O(1) for the last node */                                    \
+        }                                                                                      \
+        struct name##_node *node = list->head;                                                 \
+        for (int i = 0; i < position; i++) {                                                   \
+            node = node->next;                                                                 \
+        }                                                                                      \
+        return node;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_insert_at(struct name *list, T value, int position) {            \
+        if (position < 0 || position > list->length) {                                         \
+            fprintf(stderr, "Error: Position %d out of bounds for " #name "_insert_at.\n",      \
+                    position);                                                                 \
+            return false;                                                                      \
+        }                                                                                      \
+        if (position == 0) {                                                                   \
+            return name##_prepend(list, value);                                                \
+        }                                                                                      \
+        if (position == list->length) {                                                        \
+            return name##_append(list, value);                                                 \
+        }                                                                                      \
+        struct name##_node *node = name##_node_alloc(list);                                    \
+        if (node == NULL) {                                                                    \
+            return false;                                                                      \
+        }                                                                                      \
+        struct name##_node *prev = name##_node_at(list, position - 1);                         \
+        node->data = value;                                                                    \
+        node->next = prev->next;                                                               \
+        prev->next = node;                                                                     \
+        list->length++;                                                                        \
+        return true;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_delete_first(struct name *list) {                                \
+        struct name##_node *node = list->head;                                                 \
+        if (node == NULL) {                                                                    \
+            return false;                                                                      \
+        }                                                                                      \
+        list->head = node->next;                                                               \
+        if (list->head == NULL) {                                                              \
+            list->tail = NULL;                                                                 \
+        }                                                                                      \
+        name##_node_release(list, node);                                                       \
+        list->length--;                                                                        \
+        return true;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_delete_at(struct name *list, int position) {                     \
+        if (position < 0 || position >= list->length) {                                       \
+            return false; /* Empty list or out of bounds */                                    \
+        }                                                                                      \
+        if (position == 0) {                                                                   \
+            return name##_delete_first(list);                                                  \
+        }                                                                                      \
+        struct name##_node *prev = name##_node_at(list, position - 1);                         \
+        struct name##_node *node = prev->next;                                                 \
+        prev->next = node->next;                                                               \
+        if (list->tail == node) {                                                              \
+            list->tail = prev;                                                                 \
+        }                                                                                      \
+        name##_node_release(list, node);                                                       \
+        list->length--;                                                                        \
+        return true;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_delete_last(struct name *list) {                                 \
+        return name##_delete_at(list, list->length - 1);                                       \
+    }                                                                                          \
+                                                                                               \
+    /* Returns the first node equal to *value, or NULL */                                      \
+    static inline struct name##_node *name##_find(struct name *list, const T *value,           \
+                                                  name##_compare_fn compare) {                 \
+        for (struct name##_node *node = list->head; node != NULL; node = node->next) {         \
+            int diff = compare != NULL ? compare(&node->data, value)                           \
+                                       : memcmp(&node->data, value, sizeof(T));                \
+            if (diff == 0) {                                                                   \
+                return node;                                                                   \
+            }                                                                                  \
+        }                                                                                      \
+        return NULL;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    /* Returns a pointer to the value at a 0-based position, or NULL if out of bounds */       \
+    static inline T *name##_get_at(struct name *list, int position) {                          \
+        if (position < 0 || position >= list->length) {                                        \
+            return NULL;                                                                       \
+        }                                                                                      \
+        return &name##_node_at(list, position)->data;                                          \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_set_at(struct name *list, int position, T value) {               \
+        T *slot = name##_get_at(list, position);                                               \
+        if (slot == NULL) {                                                                    \
+            fprintf(stderr, "Error: Position %d out of bounds for " #name "_set_at.\n",         \
+                    position);                                                                 \
+            return false;                                                                      \
+        }                                                                                      \
+        *slot = value;                                                                         \
+        return true;                                                                           \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_length(struct name *list) {                                       \
+        return list->length;                                                                   \
+    }                                                                                          \
+                                                                                               \
+    static inline bool name##_is_empty(struct name *list) {                                    \
+        return list->length == 0;                                                              \
+    }                                                                                          \
+                                                                                               \
+    static inline void name##_reverse(struct name *list) {                                     \
+        struct name##_node *prev = NULL;                                                       \
+        struct name##_node *current = list->head;                                              \
+        list->tail = current;                                                                  \
+        while (current != NULL) {                                                              \
+            struct name##_node *next_node = current->next;                                     \
+            current->next = prev;                                                              \
+            prev = current;                                                                    \
+            current = next_node;                                                               \
+        }                                                                                      \
+        list->head = prev;                                                                     \
+    }                                                                                          \
+                                                                                               \
+    /* Frees all nodes (back to the pool if there is one); keeps the pool setting */           \
+    static inline void name##_destroy(struct name *list) {                                     \
+        struct name##_node *current = list->head;                                              \
+        while (current != NULL) {                                                              \
+            struct name##_node *next_node = current->next;                                     \
+            name##_node_release(list, current);                                                \
+            current = next_node;                                                               \
+        }                                                                                      \
+        list->head = NULL;                                                                     \
+        list->tail = NULL;                                                                     \
+        list->length = 0;                                                                      \
+    }
+
+
+#endif // TYPED_LIST_H // Include guard end
@@ -0,0 +1,144 @@
+#ifndef TYPED_STACK_H // Include guard start
+#define TYPED_STACK_H
+
+#include <stdio.h>  // For fprintf
+#include <stdlib.h> // For malloc, realloc, free
+#include <string.h> // For memcpy
+#include <stdint.h> // For SIZE_MAX
+#include <stddef.h> // For ptrdiff_t
+
+// --- Typed Stack Generator ---
+// DEFINE_STACK(name, T) emits an array-backed stack of T values stored inline, shaped like
+// the array kind of struct Stack in stack.h (amortized O(1) push, bulk push_n/pop_n):
+//
+//     DEFINE_STACK(PointStack, Point)
+//
+//     struct PointStack stack;
+//     PointStack_init(&stack, 0);
+//     PointStack_push(&stack, (Point){ 1, 2, 3 });
+//     Point top;
+//     PointStack_pop(&stack, &top);
+//
+// There is no INT_MIN-style sentinel for an arbitrary T, so _pop writes through a pointer
+// and returns 1/0, and _peek returns a pointer to the top (NULL when empty).
+// Only the array layout is generated: it is the one that keeps values inline.
+
+#define TYPED_STACK_DEFAULT_CAPACITY 16
+
+#define DEFINE_STACK(name, T)                                                                  \
+    struct name {                                                                              \
+        T *items;        /* items[count - 1] is the top */                                     \
+        size_t capacity;                                                                       \
+        size_t count;                                                                          \
+    };                                                                                         \
+                                                                                               \
+    /* 0 for initial_capacity means TYPED_STACK_DEFAULT_CAPACITY */                            \
+    static inline int name##_init(struct name *s, size_t initial_capacity) {                   \
+        if (initial_capacity == 0) {                                                           \
+            initial_capacity = TYPED_STACK_DEFAULT_CAPACITY;                                   \
+        }                                                                                      \
+        s->count = 0;                                                                          \
+        s->capacity = 0;                                                                       \
+        if (initial_capacity > SIZE_MAX / sizeof(T)) {                                         \
+            fprintf(stderr, "Error: Requested " #name " capacity is too large.\n");            \
+            s->items = NULL;                                                                   \
+            return 0;                                                                          \
+        }                                                                                      \
+        s->items = malloc(initial_capacity * sizeof(T));                                       \
+        if (s->items == NULL) {                                                                \
+            fprintf(stderr, "Error: Memory allocation failed in " #name "_init.\n");           \
+            return 0;                                                                          \
+        }                                                                                      \
+        s->capacity = initial_capacity;                                                        \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Grows (doubling) so at least 'min_capacity' values fit. Returns 1/0 */                  \
+    static inline int name##_reserve(struct name *s, size_t min_capacity) {                    \
+        if (min_capacity <= s->capacity) {                                                     \
+            return 1;                                                                          \
+        }                                                                                      \
+        if (min_capacity > SIZE_MAX / sizeof(T)) {                                             \
+            fprintf(stderr, "Error: Requested " #name " capacity is too large.\n");            \
+            return 0;                                                                          \
+        }                                                                                      \
+        size_t next = s->capacity > 0 ? s->capacity : TYPED_STACK_DEFAULT_CAPACITY;            \
+        while (next < min_capacity) {                                                          \
+            next = (next > SIZE_MAX / sizeof(T) / 2) ? min_capacity : next * 2;                \
+        }                                                                                      \
+        T *items = realloc(s->items, next * sizeof(T));                                        \
+        if (items == NULL) {                                                                   \
+            fprintf(stderr, "Error: Memory allocation failed while growing " #name ".\n");     \
+            return 0; /* Old buffer is still valid */                                          \
+        }                                                                                      \
+        s->items = items;                                                                      \
+        s->capacity = next;                                                                    \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_push(struct name *s, T value) {                                   \
+        if (s->count == s->capacity && !name##_reserve(s, s->count + 1)) {                     \
+            return 0;                                                                          \
+        }                                                                                      \
+        s->items[s->count++] = value;                                                          \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Pops the top into *out. Returns 1, or 0 on underflow */                                 \
+    static inline int name##_pop(struct name *s, T *out) {                                     \
+        if (s->count == 0) {                                                                   \
+            fprintf(stderr, "Error: Stack underflow on pop.\n");                               \
+            return 0;                                                                          \
+        }                                                                                      \
+        *out = s->items[--s->count];                                                           \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Returns a pointer to the top value, or NULL when empty */                               \
+    static inline T *name##_peek(struct name *s) {                                             \
+        return s->count > 0 ? &s->items[s->count - 1] : NULL;                                  \
+    }                                                                                          \
+                                                                                               \
+    static inline int name##_is_empty(struct name *s) {                                        \
+        return s->count == 0;                                                                  \
+    }                                                                                          \
+                                                                                               \
+    static inline size_t name##_size(struct name *s) {                                         \
+        return s->count;                                                                       \
+    }                                                                                          \
+                                                                                               \
+    /* Pushes values[0..n) in order, so values[n - 1] ends on top. All or nothing */           \
+    static inline int name##_push_n(struct name *s, const T *values, size_t n) {               \
+        if (n > SIZE_MAX / sizeof(T) - s->count || !name##_reserve(s, s->count + n)) {         \
+            return 0;                                                                          \
+        }                                                                                      \
+        if (n > 0) {                                                                           \
+            memcpy(s->items + s->count, values, n * sizeof(T));                                \
+        }                                                                                      \
+        s->count += n;                                                                         \
+        return 1;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Pops up to n values into out[] in pop order. Returns how many were popped */            \
+    static inline size_t name##_pop_n(struct name *s, T *out, size_t n) {                      \
+        if (n > s->count) {                                                                    \
+            n = s->count;                                                                      \
+        }                                                                                      \
+        T *top = s->items + s->count;                                                          \
+        for (size_t i = 0; i < n; i++) {                                                       \
+            out[i] = top[-1 - (ptrdiff_t)i];                                                   \
+        }                                                                                      \
+        s->count -= n;                                                                         \
+        return n;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Frees the buffer; does NOT free the struct itself */                                    \
+    static inline void name##_destroy(struct name *s) {                                        \
+        free(s->items);                                                                        \
+        s->items = NULL;                                                                       \
+        s->capacity = 0;                                                                       \
+        s->count = 0;                                                                          \
+    }
+
+
+#endif // TYPED_STACK_H // Include guard end
@@ -0,0 +1,269 @@
+#include "unrolled_list.h" // Include the header file
+#include <stdio.h>         // For printf, fprintf
+#include <stdlib.h>        // For aligned_alloc, free
+#include <string.h>        // For memmove, memcpy
+#include <limits.h>        // For INT_MIN
+
+// aligned_alloc needs the size to be a multiple of the alignment
+_Static_assert(sizeof(struct UnrolledNode) % UNROLLED_NODE_ALIGN == 0,
+               "UnrolledNode size must be a multiple of UNROLLED_NODE_ALIGN");
+
+// Helper: allocates an empty, cache-line aligned node
+static struct UnrolledNode* unrolled_node_new(void) {
+    struct UnrolledNode* node = aligned_alloc(UNROLLED_NODE_ALIGN, sizeof(struct UnrolledNode));
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for unrolled list node.\n");
+        return NULL;
+    }
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+// Helper: finds the node holding 0-based 'position' (must be < length).
+// Stores the element's offset within that node and the node before it (NULL for head).
+static struct UnrolledNode* unrolled_locate(struct UnrolledList *list, int position,
+                                            int *offset, struct UnrolledNode **prev_out) {
+    struct UnrolledNode* prev = NULL;
+    struct UnrolledNode* node = list->head;
+    while (position >= node->count) { // Skip whole blocks at a time
+        position -= node->count;
+        prev = node;
+        node = node->next;
+    }
+    *offset = position;
+    if (prev_out != NULL) {
+        *prev_out = prev;
+    }
+    return node;
+}
+
+// Initializes an empty list.
+void unrolled_list_init(struct UnrolledList *list) {
+    if (list == NULL) return; // Safety check
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+// Adds an element at the front, using spare room in the first block when there is some.
+bool unrolled_list_prepend(struct UnrolledList *list, int data) {
+    if (list == NULL) return false; // Safety check
+
+    struct UnrolledNode* head = list->head;
+    if (head == NULL || head->count == UNROLLED_NODE_CAPACITY) {
+        struct UnrolledNode* node = unrolled_node_new();
+        if (node == NULL) {
+            return false;
+        }
+        node->next = head;
+        list->head = node;
+        if (list->tail == NULL) {
+            list->tail = node;
+        }
+        head = node;
+    }
+    memmove(head->items + 1, head->items, (size_t)head->count * sizeof(int));
+    head->items[0] = data;
+    head->count++;
+    list->length++;
+    return true;
+}
+
+// Adds an element at the back, using spare room in the last block when there is some.
+bool unrolled_list_append(struct UnrolledList *list, int data) {
+    if (list == NULL) return false; // Safety check
+
+    struct UnrolledNode* tail = list->tail;
+    if (tail == NULL || tail->count == UNROLLED_NODE_CAPACITY) {
+        struct UnrolledNode* node = unrolled_node_new();
+        if (node == NULL) {
+            return false;
+        }
+        if (tail == NULL) {
+            list->head = node;
+        } else {
+            tail->next = node;
+        }
+        list->tail = node;
+        tail = node;
+    }
+    tail->items[tail->count++] = data;
+    list->length++;
+    return true;
+}
+
+// Inserts at a 0-based position, splitting the target block if it is full.
+bool unrolled_list_insert_at(struct UnrolledList *list, int data, int position) {
+    if (list == NULL || position < 0 || position > list->length) {
+        fprintf(stderr, "Error: Position %d out of bounds for unrolled_list_insert_at.\n", position);
+        return false;
+    }
+    if (position == list->length) {
+        return unrolled_list_append(list, data);
+    }
+
+    int offset;
+    struct UnrolledNode* node = unrolled_locate(list, position, &offset, NULL);
+
+    if (node->count == UNROLLED_NODE_CAPACITY) {
+        // Move the upper half into a new block right after this one
+        struct UnrolledNode* upper = unrolled_node_new();
+        if (upper == NULL) {
+            return false;
+        }
+        int half = UNROLLED_NODE_CAPACITY / 2;
+        upper->count = UNROLLED_NODE_CAPACITY - half;
+        memcpy(upper->items, node->items + half, (size_t)upper->count * sizeof(int));
+        node->count = half;
+        upper->next = node->next;
+        node->next = upper;
+        if (list->tail == node) {
+            list->tail = upper;
+        }
+        if (offset > half) {
+            node = upper;
+            offset -= half;
+        }
+    }
+
+    memmove(node->items + offset + 1, node->items + offset, (size_t)(node->count - offset) * sizeof(int));
+    node->items[offset] = data;
+    node->count++;
+    list->length++;
+    return true;
+}
+
+// Deletes the element at a 0-based position.
+bool unrolled_list_delete_at(struct UnrolledList *list, int position) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        fprintf(stderr, "Error: Position %d out of bounds for unrolled_list_delete_at.\n", position);
+        return false;
+    }
+
+    int offset;
+    struct UnrolledNode* prev;
+    struct UnrolledNode* node = unrolled_locate(list, position, &offset, &prev);
+    memmove(node->items + offset, node->items + offset + 1, (size_t)(node->count - offset - 1) * sizeof(int));
+    node->count--;
+    list->length--;
+
+    if (node->count == 0) {
+        // Unlink the empty block
+        if (prev == NULL) {
+            list->head = node->next;
+        } else {
+            prev->next = node->next;
+        }
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+        free(node);
+        return true;
+    }
+
+    // Fold a sparse block's successor into it so blocks stay at least half full
+    struct UnrolledNode* next = node->next;
+    if (next != NULL && node->count < UNROLLED_NODE_CAPACITY / 2 &&
+        node->count + next->count <= UNROLLED_NODE_CAPACITY) {
+        memcpy(node->items + node->count, next->items, (size_t)next->count * sizeof(int));
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        free(next);
+    }
+    return true;
+}
+
+// Finds the first occurrence of 'value' by scanning block after block.
+int unrolled_list_find(struct UnrolledList *list, int value) {
+    if (list == NULL) return -1; // Safety check
+
+    int base = 0;
+    for (struct UnrolledNode* node = list->head; node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            if (node->items[i] == value) {
+                return base + i;
+            }
+        }
+        base += node->count;
+    }
+    return -1; // Value not found
+}
+
+// Reads the element at a 0-based position.
+int unrolled_list_get_at(struct UnrolledList *list, int position) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        fprintf(stderr, "Error: Position %d out of bounds for unrolled_list_get_at.\n", position);
+        return INT_MIN;
+    }
+    int offset;
+    struct UnrolledNode* node = unrolled_locate(list, position, &offset, NULL);
+    return node->items[offset];
+}
+
+// Updates the element at a 0-based position.
+bool unrolled_list_set_at(struct UnrolledList *list, int position, int new_value) {
+    if (list == NULL || position < 0 || position >= list->length) {
+        fprintf(stderr, "Error: Position %d out of bounds for unrolled_list_set_at.\n", position);
+        return false;
+    }
+    int offset;
+    struct UnrolledNode* node = unrolled_locate(list, position, &offset, NULL);
+    node->items[offset] = new_value;
+    return true;
+}
+
+// Returns the number of elements.
+int unrolled_list_length(struct UnrolledList *list) {
+    return (list == NULL) ? 0 : list->length;
+}
+
+// Reverses the block chain, then each block's contents.
+void unrolled_list_reverse(struct UnrolledList *list) {
+    if (list == NULL) return; // Safety check
+
+    struct UnrolledNode* prev = NULL;
+    struct UnrolledNode* current = list->head;
+    list->tail = current;
+    while (current != NULL) {
+        struct UnrolledNode* next_node = current->next;
+        for (int i = 0, j = current->count - 1; i < j; i++, j--) {
+            int tmp = current->items[i];
+            current->items[i] = current->items[j];
+            current->items[j] = tmp;
+        }
+        current->next = prev;
+        prev = current;
+        current = next_node;
+    }
+    list->head = prev;
+}
+
+// Prints the elements of the list.
+void unrolled_list_print(struct UnrolledList *list) {
+    printf("List: ");
+    if (list != NULL) {
+        for (struct UnrolledNode* node = list->head; node != NULL; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                printf("%d -> ", node->items[i]);
+            }
+        }
+    }
+    printf("NULL\n");
+}
+
+// Frees every block.
+void unrolled_list_destroy(struct UnrolledList *list) {
+    if (list == NULL) return; // Safety check
+
+    struct UnrolledNode* current = list->head;
+    while (current != NULL) {
+        struct UnrolledNode* next_node = current->next;
+        free(current);
+        current = next_node;
+    }
+    unrolled_list_init(list);
+}
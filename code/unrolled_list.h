@@ -0,0 +1,70 @@
+#ifndef UNROLLED_LIST_H // Include guard start
+#define UNROLLED_LIST_H
+
+#include <stdio.h>   // For standard types/prototypes if needed
+#include <stdlib.h>  // For standard types/prototypes if needed
+#include <stdbool.h> // For bool return types
+
+// --- Structure Definitions ---
+
+// Unrolled linked list: each node stores a small block of ints instead of one, so a
+// traversal follows one pointer (and touches two cache lines) per block rather than
+// per element. Positions are 0-based like linked_list.h.
+
+// Elements per node. With the next pointer and count this makes a node exactly
+// 128 bytes (two 64-byte cache lines); nodes are allocated cache-line aligned.
+#define UNROLLED_NODE_CAPACITY 29
+#define UNROLLED_NODE_ALIGN 64
+
+struct UnrolledNode {
+    struct UnrolledNode *next;
+    int count;                          // Elements used in 'items'
+    int items[UNROLLED_NODE_CAPACITY];  // Elements in list order
+};
+
+struct UnrolledList {
+    struct UnrolledNode *head;
+    struct UnrolledNode *tail;
+    int length; // Total number of elements
+};
+
+
+// --- Function Prototypes ---
+
+// Initializes an empty list.
+void unrolled_list_init(struct UnrolledList *list);
+
+// Adds an element at the front / back. Return true on success, false on alloc failure.
+bool unrolled_list_prepend(struct UnrolledList *list, int data);
+bool unrolled_list_append(struct UnrolledList *list, int data);
+
+// Inserts at a 0-based position (position == length appends). A full node is split in
+// half, so inserts only ever move elements within one block.
+bool unrolled_list_insert_at(struct UnrolledList *list, int data, int position);
+
+// Deletes the element at a 0-based position. Sparse neighbours are merged to keep
+// nodes dense. Returns true on success, false if out of bounds.
+bool unrolled_list_delete_at(struct UnrolledList *list, int position);
+
+// Returns the 0-based position of the first element equal to 'value', or -1.
+int unrolled_list_find(struct UnrolledList *list, int value);
+
+// Reads / updates the element at a 0-based position.
+// unrolled_list_get_at returns INT_MIN if out of bounds.
+int unrolled_list_get_at(struct UnrolledList *list, int position);
+bool unrolled_list_set_at(struct UnrolledList *list, int position, int new_value);
+
+// Returns the number of elements (O(1)).
+int unrolled_list_length(struct UnrolledList *list);
+
+// Reverses the order of elements in-place (node order and each block).
+void unrolled_list_reverse(struct UnrolledList *list);
+
+// Prints the elements in the same format as list_print.
+void unrolled_list_print(struct UnrolledList *list);
+
+// Frees all nodes and leaves the list empty. Does NOT free the UnrolledList struct itself.
+void unrolled_list_destroy(struct UnrolledList *list);
+
+
+#endif // UNROLLED_LIST_H // Include guard end